@@ -9,6 +9,7 @@ ConsolePrint("Importing JS code for FixedElements...");
 
 // new version of window.fixed_elements
 window.domFixedElements = [];
+window.domFixedElementsChanged = new Set(); // ids of fixed elements whose Rects were not yet pushed to CEF
 
 /** Constructor */
 function FixedElement(node)
@@ -126,10 +127,9 @@ function FixedElement(node)
 
         if(changed)
         {
-            // Inform CEF that fixed element has been updated
-            // var debug = (window.domFixedElements[this.id] === undefined) ? "undefined" : "ok";
-            ConsolePrint("#fixElem#add#"+this.id+"#");
-            //   ConsolePrint("-----> #fixElem#add#"+this.id); // DEBUG
+            // Queue Rects for CEF, pushed together with other changed fixed elements at end of flush
+            window.domFixedElementsChanged.add(this.id);
+            RequestDOMRectsFlush();
 
 
             // Give feedback if other rects might have to get updated too
@@ -149,6 +149,9 @@ function FixedElement(node)
     
 
     this.node.setAttribute("fixedId", this.id);
+
+    // Observe node for size changes, fixed elements are always measured regardless of viewport proximity
+    TrackDOMRects(this, false);
     
     //// INFO: MutationObserver now automatically sets all attributes for children!
     // // Note corresponding fixed element ID in an attribute
@@ -250,7 +253,9 @@ function RemoveFixedElement(node)
         // Delete object in its list slot, slot will be left empty (undefined) at the moment
         if(id >= 0 && id < window.domFixedElements.length)
         {
+            UntrackDOMRects(fixedObj);
             delete window.domFixedElements[id];
+            window.domFixedElementsChanged.delete(id);
 
             ConsolePrint("#fixElem#rem#"+id);
             // console.log("Removed fixedObj with id="+id);
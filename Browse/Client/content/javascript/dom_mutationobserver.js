@@ -482,6 +482,9 @@ function DOMObject(node, nodeType)
             // Create empty DOMNode object on C++ side
             InformCEF(this, ['added']);
 
+            // Observe node for Rect changes
+            TrackDOMRects(this);
+
             // Setup of attributes
             this.checkVisibility();
             this.searchOverflows();
@@ -634,53 +637,331 @@ function CompareClientRectsData(rects1, rects2)
 }
 
 /**
- * Triggers update of DOMRects of each DOMObject by using DOMObjects updateRects() method
- * 
+ * Rect tracking
+ * Tracked objects (DOMObjects, OverflowElements and FixedElements) are observed by a ResizeObserver
+ * and, except fixed elements, by an IntersectionObserver. Objects whose Rects might have changed
+ * are collected in a dirty set, which is flushed once per animation frame. Only objects near the
+ * viewport are measured, the others are measured as soon as they approach the viewport.
+ * Without observer support, each flush simply measures all dirty objects.
+ */
+window.domRectsObjects = new Map(); // node -> tracked object
+window.domRectsDirty = new Set();
+window.domRectsFlushRequested = false;
+window.domRectsLastFlush = { duration: 0, measured: 0, deferred: 0 };
+
+window.domRectsResizeObserver = (typeof ResizeObserver === "function") ?
+    new ResizeObserver(
+        function(entries){
+            entries.forEach(function(entry){ MarkDOMRectsDirty(window.domRectsObjects.get(entry.target)); });
+        }
+    ) : null;
+
+// Nodes within one viewport size around the viewport count as near
+window.domRectsIntersectionObserver = (typeof IntersectionObserver === "function") ?
+    new IntersectionObserver(
+        function(entries){
+            entries.forEach(
+                function(entry){
+                    var obj = window.domRectsObjects.get(entry.target);
+                    if(obj === undefined)
+                        return;
+
+                    obj.nearViewport = entry.isIntersecting;
+
+                    // Measure objects which were skipped while being far away
+                    if(obj.nearViewport && obj.rectsDeferred)
+                    {
+                        MarkDOMRectsDirty(obj);
+                    }
+                }
+            );
+        },
+        { rootMargin: "100%" }
+    ) : null;
+
+/**
+ * Starts observation of object's node
+ *
+ * args:    obj : object with node and updateRects(), trackProximity : bool
+ * returns: void
+ */
+function TrackDOMRects(obj, trackProximity)
+{
+    if(obj === null || obj === undefined || obj.node === null || obj.node === undefined)
+        return;
+
+    obj.nearViewport = undefined; // unknown until first intersection callback, measured meanwhile
+    obj.rectsDeferred = false;
+    obj.trackProximity = trackProximity;
+    window.domRectsObjects.set(obj.node, obj);
+
+    if(window.domRectsResizeObserver !== null)
+        window.domRectsResizeObserver.observe(obj.node);
+
+    if(trackProximity !== false && window.domRectsIntersectionObserver !== null)
+        window.domRectsIntersectionObserver.observe(obj.node);
+}
+
+/**
+ * Stops observation of object's node
+ *
+ * args:    obj : tracked object
+ * returns: void
+ */
+function UntrackDOMRects(obj)
+{
+    if(obj === null || obj === undefined || obj.node === null || obj.node === undefined)
+        return;
+
+    window.domRectsObjects.delete(obj.node);
+    window.domRectsDirty.delete(obj);
+
+    if(window.domRectsResizeObserver !== null)
+        window.domRectsResizeObserver.unobserve(obj.node);
+
+    if(window.domRectsIntersectionObserver !== null)
+        window.domRectsIntersectionObserver.unobserve(obj.node);
+}
+
+/**
+ * Marks object's Rects as possibly changed and requests flush in next animation frame
+ *
+ * args:    obj : tracked object, searchOverflows : bool
+ * returns: void
+ */
+function MarkDOMRectsDirty(obj, searchOverflows)
+{
+    if(obj === null || obj === undefined)
+        return;
+
+    // Node of removed object has been attached again
+    if(obj.removed === true && obj.node.isConnected)
+    {
+        obj.removed = false;
+        if(!window.domRectsObjects.has(obj.node))
+            TrackDOMRects(obj, obj.trackProximity);
+    }
+
+    if(searchOverflows === true)
+        obj.overflowsDirty = true;
+
+    window.domRectsDirty.add(obj);
+    RequestDOMRectsFlush();
+}
+
+/**
+ * Requests flush in next animation frame, unless already requested
+ *
  * args:    -/-
  * returns: void
  */
-function UpdateDOMRects()
+function RequestDOMRectsFlush()
 {
-    // DEBUG
-    // ConsolePrint("UpdateDOMRects() called");
+    if(!window.domRectsFlushRequested)
+    {
+        window.domRectsFlushRequested = true;
+        window.requestAnimationFrame(FlushDOMRects);
+    }
+}
 
-    // Trigger update of Rects for every domObject
-    window.domTextInputs.forEach(
-        function (domObj) { if(domObj !== null && domObj !== undefined) domObj.updateRects(); }
-    );
-    window.domLinks.forEach(
-        function (domObj) { if(domObj !== null && domObj !== undefined) domObj.updateRects(); }
-    );
+function MarkAllDOMRectsDirty(searchOverflows)
+{
+    window.domRectsObjects.forEach(function(obj){ MarkDOMRectsDirty(obj, searchOverflows); });
+}
 
-    window.domSelectFields.forEach(
-        function (domObj) { if(domObj !== null && domObj !== undefined) domObj.updateRects(); }
-    );
+function IsFixedElementObject(obj)
+{
+    return (typeof FixedElement === "function") && (obj instanceof FixedElement);
+}
+
+/**
+ * Measures all dirty objects near the viewport, informs CEF about changed Rects only
+ *
+ * args:    -/-
+ * returns: void
+ */
+function FlushDOMRects()
+{
+    window.domRectsFlushRequested = false;
 
-    // ... and all OverflowElements
-    window.domOverflowElements.forEach(
-        function (overflowObj) {
-            if(overflowObj !== null && overflowObj !== undefined)
-                overflowObj.updateRects(); 
+    var start = performance.now();
+    var measured = 0;
+    var deferred = 0;
+
+    // Fixed elements first, as their Rects are cut out of the other Rects
+    var fixedChanged = false;
+    window.domRectsDirty.forEach(
+        function(obj){
+            if(IsFixedElementObject(obj))
+            {
+                window.domRectsDirty.delete(obj);
+                fixedChanged = obj.updateRects() || fixedChanged;
+                UntrackRemovedDOMRects(obj);
+                measured++;
+            }
         }
     );
 
-    // ... and all FixedElements
-    window.domFixedElements.forEach(
-        function(fixedObj){ if(fixedObj !== undefined && fixedObj !== null){fixedObj.updateRects();} }
-    );
+    // Changed fixed elements may cover other nodes
+    if(fixedChanged)
+    {
+        window.domRectsObjects.forEach(
+            function(obj){ if(!IsFixedElementObject(obj)) window.domRectsDirty.add(obj); }
+        );
+    }
 
-   
+    var dirty = Array.from(window.domRectsDirty);
+    window.domRectsDirty.clear();
+    dirty.forEach(
+        function(obj){
+            // Removed nodes are always measured, so their Rects vanish on CEF side
+            if(obj.nearViewport === false && obj.node.isConnected)
+            {
+                obj.rectsDeferred = true;
+                deferred++;
+                return;
+            }
 
-   // TODO: Deprecated?
-    // Update visibility of each DOM object
-    window.domTextInputs.forEach(
-        function (domObj) { domObj.searchOverflows(); domObj.checkVisibility(); }
+            obj.rectsDeferred = false;
+            if(obj.overflowsDirty && typeof obj.searchOverflows === "function")
+            {
+                obj.searchOverflows();
+            }
+            obj.overflowsDirty = false;
+            obj.updateRects();
+            UntrackRemovedDOMRects(obj);
+            measured++;
+        }
     );
-    window.domLinks.forEach(
-        function (domObj) { domObj.searchOverflows(); domObj.checkVisibility(); }
+
+    // Push geometry which changed during this flush
+    PushFixedElements();
+    PushPageSize();
+
+    window.domRectsLastFlush = { duration: performance.now() - start, measured: measured, deferred: deferred };
+}
+
+/**
+ * Stops observation of removed object after its Rects have been cleared by flush
+ *
+ * args:    obj : tracked object
+ * returns: void
+ */
+function UntrackRemovedDOMRects(obj)
+{
+    if(obj.removed === true && !obj.node.isConnected)
+        UntrackDOMRects(obj);
+}
+
+/**
+ * Informs CEF about Rects of all fixed elements which changed since last push, in one message
+ * Format: #fixElem#upd#id#t;l;b;r;t;l;b;r#id#t;l;b;r#
+ *
+ * args:    -/-
+ * returns: void
+ */
+function PushFixedElements()
+{
+    if(window.domFixedElementsChanged === undefined || window.domFixedElementsChanged.size === 0)
+        return;
+
+    var encodedCommand = "#fixElem#upd#";
+    window.domFixedElementsChanged.forEach(
+        function(id){
+            var fixedObj = window.domFixedElements[id];
+            if(fixedObj === null || fixedObj === undefined)
+                return;
+
+            var values = [];
+            fixedObj.rects.forEach(function(rect){ values.push(rect[0], rect[1], rect[2], rect[3]); });
+            encodedCommand += id + "#" + values.join(";") + "#";
+        }
     );
+    window.domFixedElementsChanged.clear();
 
+    ConsolePrint(encodedCommand);
+}
+
+/**
+ * Page size tracking
+ * Root and body are observed by a ResizeObserver, so changes of document size request a flush.
+ * Size is compared at every flush anyway, as zooming or new content may change it as well.
+ * Without ResizeObserver support, size is polled at low rate instead.
+ */
+window.pageSizeLastPushed = { width: -1, height: -1 };
+window.pageSizeObservedBody = null;
+window.pageSizePollInterval = 1000; // milliseconds, only used without ResizeObserver
 
+window.pageSizeResizeObserver = (typeof ResizeObserver === "function") ?
+    new ResizeObserver(function(entries){ RequestDOMRectsFlush(); }) : null;
+
+if(window.pageSizeResizeObserver === null)
+    window.setInterval(PushPageSize, window.pageSizePollInterval);
+
+/**
+ * Informs CEF about page size, if it changed since last push
+ * Format: #pageSize#width#height#
+ *
+ * args:    -/-
+ * returns: void
+ */
+function PushPageSize()
+{
+    if(!document.documentElement || document.body === null || document.body === undefined)
+        return;
+
+    // Body might be replaced during lifetime of document
+    if(window.pageSizeResizeObserver !== null && window.pageSizeObservedBody !== document.body)
+    {
+        if(window.pageSizeObservedBody === null)
+            window.pageSizeResizeObserver.observe(document.documentElement);
+        else
+            window.pageSizeResizeObserver.unobserve(window.pageSizeObservedBody);
+        window.pageSizeResizeObserver.observe(document.body);
+        window.pageSizeObservedBody = document.body;
+    }
+
+    var width = document.body.scrollWidth;
+    var height = document.body.scrollHeight;
+    if(width !== window.pageSizeLastPushed.width || height !== window.pageSizeLastPushed.height)
+    {
+        window.pageSizeLastPushed = { width: width, height: height };
+        ConsolePrint("#pageSize#"+width+"#"+height+"#");
+    }
+}
+
+/**
+ * Triggers update of DOMRects of each tracked object, coalesced into the next animation frame
+ * 
+ * args:    -/-
+ * returns: void
+ */
+function UpdateDOMRects()
+{
+    // DEBUG
+    // ConsolePrint("UpdateDOMRects() called");
+
+    MarkAllDOMRectsDirty(true);
+
+    // Flush also without tracked objects, as it pushes page size
+    RequestDOMRectsFlush();
+}
+
+/**
+ * Synchronously updates DOMRects of each DOMObject, OverflowElement and FixedElement
+ * NOTE: Forces layout once per node, only used as reference in benchmarks
+ * 
+ * args:    -/-
+ * returns: void
+ */
+function UpdateAllDOMRectsNow()
+{
+    var update = function(obj){ if(obj !== null && obj !== undefined) obj.updateRects(); };
+    window.domTextInputs.forEach(update);
+    window.domLinks.forEach(update);
+    window.domSelectFields.forEach(update);
+    window.domOverflowElements.forEach(update);
+    window.domFixedElements.forEach(update);
 }
 
 // TODO: Use this function in UpdateChildrensDOMRects?
@@ -696,7 +977,7 @@ function UpdateNodesRect(node)
             var obj = GetDOMObject(type, id);
             if(obj !== undefined && obj !== null)
             {
-                obj.updateRects();
+                MarkDOMRectsDirty(obj);
             }
         }
 
@@ -706,7 +987,7 @@ function UpdateNodesRect(node)
             var overflowObj = GetOverflowElement(overflowId);
             if(overflowObj !== undefined && overflowObj !== null)
             {
-                overflowObj.updateRects();
+                MarkDOMRectsDirty(overflowObj);
             }
         }
 
@@ -724,9 +1005,8 @@ function UpdateChildrensDOMRects(parent)
                 var domObj = GetDOMObject(nodeType, nodeID);
                 if(domObj !== undefined && domObj !== null)
                 {
-                    domObj.searchOverflows(); 
                     // domObj.checkVisibility(); 
-                    domObj.updateRects();
+                    MarkDOMRectsDirty(domObj, true);
                 } 
             }
 
@@ -735,7 +1015,7 @@ function UpdateChildrensDOMRects(parent)
                 var overflowObj = GetOverflowElement(overflowId);
                 if(overflowObj !== undefined && overflowObj !== null)
                 {
-                    overflowObj.updateRects();
+                    MarkDOMRectsDirty(overflowObj);
                 }
             }
 
@@ -877,8 +1157,9 @@ function RemoveDOMObject(node)
         var obj = GetDOMObject(type, id);
         if(obj !== null && obj !== undefined)
         {
-            obj.updateRects();
-            // console.log("Updated rects in ordner to let rect vanish, due to removal of object!");
+            // Next flush lets Rects vanish and stops observation, unless node is attached again
+            obj.removed = true;
+            MarkDOMRectsDirty(obj);
         }
 
 
@@ -1124,7 +1405,7 @@ function OverflowElement(node)
                             var nodeID = child.getAttribute("nodeID");
                         if(((domObj = GetDOMObject(nodeType, nodeID)) !== undefined) && domObj !== null)
                             {
-                                domObj.updateRects();
+                                MarkDOMRectsDirty(domObj);
                             } 
                         }
 
@@ -1132,7 +1413,7 @@ function OverflowElement(node)
                         {
                             if(((overflowObj = GetOverflowElement(overflowId)) !== undefined) && overflowObj !== null)
                             {
-                                overflowObj.updateRects();
+                                MarkDOMRectsDirty(overflowObj);
                             }
                         }
                     }
@@ -1161,6 +1442,7 @@ function CreateOverflowElement(node)
 
         var id = window.domOverflowElements.length - 1;
         node.setAttribute("overflowId", id);
+        TrackDOMRects(overflowObj);
 
         outStr += (id + "#");
         ConsolePrint(outStr);
@@ -1217,6 +1499,7 @@ function RemoveOverflowElement(id)
         });
         /* END OF HACK */
 
+        UntrackDOMRects(window.domOverflowElements[id]);
         window.domOverflowElements[id].node.removeAttribute("overflowId");
         delete window.domOverflowElements[id]; // TODO: Keep list space empty or fill when new OE is created?
 
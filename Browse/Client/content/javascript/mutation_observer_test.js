@@ -64,11 +64,15 @@ function LoggingMediator()
     this.registerFunction = function(f)
     {
         this.logFunction = f;
+
+        // Only pages with registered log function receive logging data
+        window.cefQuery({ request: "logging:subscribe", persistent : false, onSuccess : function(response) {}, onFailure : function(error_code, error_message){} });
     }
 
     /* Unregister the log function with this function */
     this.unregisterFunction = function() {
         this.logFunction = null;
+        window.cefQuery({ request: "logging:unsubscribe", persistent : false, onSuccess : function(response) {}, onFailure : function(error_code, error_message){} });
     }
 
 	/* This function is called by CEF's renderer process */
@@ -0,0 +1,261 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+
+#include "Benchmark.h"
+#include "src/Input/GazeTrace.h"
+#include "src/Utils/Logger.h"
+#include "src/Global.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+
+Benchmark::Benchmark(std::string suiteDirectory, std::string outputDirectory)
+{
+	_outputDirectory = outputDirectory;
+
+	// Make suite directory absolute, as it becomes part of URLs
+#ifdef _WIN32
+	char buffer[_MAX_PATH];
+	if (_fullpath(buffer, suiteDirectory.c_str(), _MAX_PATH) != NULL) { suiteDirectory = buffer; }
+	std::replace(suiteDirectory.begin(), suiteDirectory.end(), '\\', '/');
+#else
+	char* pPath = realpath(suiteDirectory.c_str(), NULL);
+	if (pPath != NULL)
+	{
+		suiteDirectory = pPath;
+		free(pPath);
+	}
+#endif
+	if (!suiteDirectory.empty() && suiteDirectory.back() != '/') { suiteDirectory += '/'; }
+	_suiteDirectory = suiteDirectory;
+
+	// Read page files, skipping empty lines and comments
+	std::ifstream file(_suiteDirectory + BENCHMARK_SUITE_FILE);
+	std::string line;
+	while (std::getline(file, line))
+	{
+		line.erase(std::remove(line.begin(), line.end(), '\r'), line.end());
+		if (!line.empty() && line[0] != '#')
+		{
+			_pages.push_back(line);
+		}
+	}
+	LogInfo("Benchmark: Suite in ", _suiteDirectory, " has ", _pages.size(), " pages.");
+}
+
+bool Benchmark::NextPage()
+{
+	if (_pageIndex < _pages.size()) { _pageIndex++; }
+	return _pageIndex < _pages.size();
+}
+
+std::string Benchmark::GetPageURL() const
+{
+	std::string path = _suiteDirectory + _pages.at(_pageIndex);
+	return (path[0] == '/') ? "file://" + path : "file:///" + path;
+}
+
+std::string Benchmark::GetTraceFile(int windowWidth, int windowHeight) const
+{
+	// Prefer gaze trace recorded for page
+	std::string traceFile = _suiteDirectory + _pages.at(_pageIndex) + BENCHMARK_PAGE_TRACE_EXTENSION;
+	if (std::ifstream(traceFile).good())
+	{
+		return traceFile;
+	}
+
+	// Fall back to scripted gaze path
+	traceFile = _outputDirectory + BENCHMARK_SCRIPTED_TRACE_FILE;
+	if (!WriteScriptedTrace(traceFile, windowWidth, windowHeight))
+	{
+		LogError("Benchmark: Could not write scripted gaze trace to ", traceFile);
+	}
+	return traceFile;
+}
+
+void Benchmark::BeginMeasurement(std::string traceFile, const BenchmarkCounters& rCounters, float loadTime)
+{
+	_current = Result();
+	_current.page = _pages.at(_pageIndex);
+	_current.trace = traceFile;
+	_current.loadTime = loadTime;
+	_startCounters = rCounters;
+	LogInfo("Benchmark: Measuring ", _current.page, " (loaded in ", loadTime, " seconds)...");
+}
+
+void Benchmark::AddFrameTime(float frameTime)
+{
+	_current.frameTimes.push_back(1000.0 * frameTime);
+}
+
+void Benchmark::EndMeasurement(const BenchmarkCounters& rCounters, std::map<std::string, std::vector<double> > stageDurations, float renderScale)
+{
+	// Durations of profiler are in microseconds
+	for (auto& rStage : stageDurations)
+	{
+		for (double& rDuration : rStage.second) { rDuration /= 1000.0; }
+	}
+	_current.stageDurations = std::move(stageDurations);
+	_current.renderScale = renderScale;
+
+	// Counters over measurement
+	_current.counters.paints = rCounters.paints - _startCounters.paints;
+	_current.counters.uploads = rCounters.uploads - _startCounters.uploads;
+	_current.counters.skippedPaints = rCounters.skippedPaints - _startCounters.skippedPaints;
+	_current.counters.ipcSent = rCounters.ipcSent - _startCounters.ipcSent;
+	_current.counters.ipcJavaScript = rCounters.ipcJavaScript - _startCounters.ipcJavaScript;
+	_current.counters.ipcReceived = rCounters.ipcReceived - _startCounters.ipcReceived;
+
+	_results.push_back(std::move(_current));
+	_current = Result();
+	LogInfo("Benchmark: ..done.");
+}
+
+bool Benchmark::WriteReport(std::string renderer) const
+{
+	std::ofstream file(_outputDirectory + BENCHMARK_REPORT_FILE);
+	if (!file.is_open())
+	{
+		LogError("Benchmark: Could not write report to ", _outputDirectory + BENCHMARK_REPORT_FILE);
+		return false;
+	}
+
+	// Times are in milliseconds
+	file << std::fixed << std::setprecision(3);
+	file << "{\n"
+		<< "\t\"renderer\": \"" << EscapeJSON(renderer) << "\",\n"
+		<< "\t\"timestep\": " << 1000.0 * GAZE_TRACE_REPLAY_TIMESTEP << ",\n"
+		<< "\t\"pages\": [";
+	for (unsigned int i = 0; i < _results.size(); i++)
+	{
+		const Result& rResult = _results.at(i);
+		file << (i == 0 ? "\n" : ",\n")
+			<< "\t\t{\n"
+			<< "\t\t\t\"page\": \"" << EscapeJSON(rResult.page) << "\",\n"
+			<< "\t\t\t\"trace\": \"" << EscapeJSON(rResult.trace) << "\",\n"
+			<< "\t\t\t\"load_time\": " << 1000.0 * rResult.loadTime << ",\n"
+			<< "\t\t\t\"render_scale\": " << rResult.renderScale << ",\n"
+			<< "\t\t\t\"paints\": " << rResult.counters.paints << ",\n"
+			<< "\t\t\t\"uploads\": " << rResult.counters.uploads << ",\n"
+			<< "\t\t\t\"skipped_paints\": " << rResult.counters.skippedPaints << ",\n"
+			<< "\t\t\t\"ipc_sent\": " << rResult.counters.ipcSent << ",\n"
+			<< "\t\t\t\"ipc_javascript\": " << rResult.counters.ipcJavaScript << ",\n"
+			<< "\t\t\t\"ipc_received\": " << rResult.counters.ipcReceived << ",\n"
+			<< "\t\t\t\"frame_time\": ";
+		WritePercentiles(file, rResult.frameTimes);
+		file << ",\n\t\t\t\"stages\": {";
+		bool first = true;
+		for (const auto& rStage : rResult.stageDurations)
+		{
+			file << (first ? "\n" : ",\n") << "\t\t\t\t\"" << EscapeJSON(rStage.first) << "\": ";
+			WritePercentiles(file, rStage.second);
+			first = false;
+		}
+		file << "\n\t\t\t}\n\t\t}";
+	}
+	file << "\n\t]\n}\n";
+	LogInfo("Benchmark: Report written to ", _outputDirectory + BENCHMARK_REPORT_FILE);
+	return true;
+}
+
+bool Benchmark::WriteScriptedTrace(std::string filepath, int windowWidth, int windowHeight)
+{
+	GazeTraceWriter writer(filepath, windowWidth, windowHeight);
+	if (!writer.IsOpen()) { return false; }
+
+	// Reading of lines in center of page, then dwelling on scrolling sensor at bottom,
+	// reading again and dwelling on scrolling sensor at top. Positions are relative
+	const int lineCount = 8;
+	const int fixationsPerLine = 6;
+	const float readingDuration = lineCount * fixationsPerLine * BENCHMARK_SCRIPT_FIXATION_DURATION;
+	const float scrollDownDuration = 3.f;
+	const float scrollUpDuration = 1.5f;
+	const float cycleDuration = 2.f * readingDuration + scrollDownDuration + scrollUpDuration;
+	auto gaze = [&](float time, float& rX, float& rY)
+	{
+		float cycleTime = std::fmod(time, cycleDuration);
+		if (cycleTime >= readingDuration && cycleTime < readingDuration + scrollDownDuration)
+		{
+			rX = 0.5f;
+			rY = 1.f - TAB_SCROLLING_SENSOR_PADDING - (TAB_SCROLLING_SENSOR_HEIGHT / 2.f);
+			return;
+		}
+		if (cycleTime >= cycleDuration - scrollUpDuration)
+		{
+			rX = 0.5f;
+			rY = TAB_SCROLLING_SENSOR_PADDING + (TAB_SCROLLING_SENSOR_HEIGHT / 2.f);
+			return;
+		}
+		float readingTime = (cycleTime < readingDuration) ? cycleTime : cycleTime - readingDuration - scrollDownDuration;
+		int fixation = std::min((int)(readingTime / BENCHMARK_SCRIPT_FIXATION_DURATION), lineCount * fixationsPerLine - 1);
+		rX = 0.2f + 0.6f * (float)(fixation % fixationsPerLine) / (float)(fixationsPerLine - 1);
+		rY = 0.25f + 0.5f * (float)(fixation / fixationsPerLine) / (float)(lineCount - 1);
+	};
+
+	// Frames with fixed timestep, samples are spread over frame
+	const int frameCount = (int)(BENCHMARK_SCRIPT_DURATION / GAZE_TRACE_REPLAY_TIMESTEP);
+	for (int i = 0; i < frameCount; i++)
+	{
+		GazeTraceFrame frame;
+		frame.tpf = GAZE_TRACE_REPLAY_TIMESTEP;
+		frame.windowWidth = windowWidth;
+		frame.windowHeight = windowHeight;
+		frame.tracking = true;
+		for (int j = 1; j <= BENCHMARK_SCRIPT_SAMPLES_PER_FRAME; j++)
+		{
+			float time = ((float)i + (float)j / (float)BENCHMARK_SCRIPT_SAMPLES_PER_FRAME) * GAZE_TRACE_REPLAY_TIMESTEP;
+			float x = 0;
+			float y = 0;
+			gaze(time, x, y);
+
+			// Deterministic tremor of few pixels
+			frame.samples.push_back(SampleData(
+				(x * windowWidth) + 2.0 * std::sin(97.0 * time),
+				(y * windowHeight) + 2.0 * std::cos(89.0 * time),
+				true,
+				std::chrono::milliseconds((long long)(1000.f * time))));
+		}
+		writer.Write(frame);
+	}
+	return true;
+}
+
+void Benchmark::WritePercentiles(std::ostream& rStream, std::vector<double> values)
+{
+	if (values.empty())
+	{
+		rStream << "{ \"count\": 0 }";
+		return;
+	}
+	std::sort(values.begin(), values.end());
+	double sum = 0;
+	for (double value : values) { sum += value; }
+	auto percentile = [&](double p) { return values[(size_t)(p * (values.size() - 1))]; };
+	rStream << "{ \"count\": " << values.size()
+		<< ", \"mean\": " << sum / values.size()
+		<< ", \"p50\": " << percentile(0.5)
+		<< ", \"p95\": " << percentile(0.95)
+		<< ", \"p99\": " << percentile(0.99)
+		<< ", \"max\": " << values.back() << " }";
+}
+
+std::string Benchmark::EscapeJSON(const std::string& rString)
+{
+	std::string escaped;
+	for (char c : rString)
+	{
+		switch (c)
+		{
+		case '"': { escaped += "\\\""; break; }
+		case '\\': { escaped += "\\\\"; break; }
+		case '\n': { escaped += "\\n"; break; }
+		case '\t': { escaped += "\\t"; break; }
+		default: { escaped += c; break; }
+		}
+	}
+	return escaped;
+}
@@ -0,0 +1,100 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+// Benchmark runs a suite of local pages in the headless mode of Master. Each
+// page is driven by its recorded gaze trace or by a scripted gaze path that
+// reads line by line and dwells on the scrolling sensors. Frame times, stage
+// durations of the frame profiler, paint / upload counts and IPC counts are
+// measured per page and written as JSON report, so that CI can compare runs.
+
+#ifndef BENCHMARK_H_
+#define BENCHMARK_H_
+
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Counters which only increase while running, measured as difference per page
+struct BenchmarkCounters
+{
+	unsigned int paints = 0;
+	unsigned int uploads = 0;
+	unsigned int skippedPaints = 0;
+	unsigned int ipcSent = 0;
+	unsigned int ipcJavaScript = 0;
+	unsigned int ipcReceived = 0;
+};
+
+class Benchmark
+{
+public:
+
+	// Constructor. Reads list of pages from suite directory, check IsValid afterwards
+	Benchmark(std::string suiteDirectory, std::string outputDirectory);
+
+	// Whether suite contains any page
+	bool IsValid() const { return !_pages.empty(); }
+
+	// Continue with next page. Returns false when suite is finished
+	bool NextPage();
+
+	// URL of current page
+	std::string GetPageURL() const;
+
+	// Gaze trace for current page. Recorded one next to page or scripted one for given window size
+	std::string GetTraceFile(int windowWidth, int windowHeight) const;
+
+	// Start measurement of current page, which is replayed with given gaze trace. Load time in seconds
+	void BeginMeasurement(std::string traceFile, const BenchmarkCounters& rCounters, float loadTime);
+
+	// Add measured time of frame in seconds
+	void AddFrameTime(float frameTime);
+
+	// End measurement of current page. Stage durations in microseconds as collected by frame profiler
+	void EndMeasurement(const BenchmarkCounters& rCounters, std::map<std::string, std::vector<double> > stageDurations, float renderScale);
+
+	// Write report of all measured pages into output directory. Returns whether successful
+	bool WriteReport(std::string renderer) const;
+
+private:
+
+	// Measurement of single page
+	struct Result
+	{
+		std::string page;
+		std::string trace;
+		float loadTime = 0.f;
+		float renderScale = 1.f;
+		std::vector<double> frameTimes; // milliseconds
+		std::map<std::string, std::vector<double> > stageDurations; // milliseconds
+		BenchmarkCounters counters; // difference over measurement
+	};
+
+	// Write scripted gaze path for given window size. Returns whether successful
+	static bool WriteScriptedTrace(std::string filepath, int windowWidth, int windowHeight);
+
+	// Write percentiles of given values as JSON object
+	static void WritePercentiles(std::ostream& rStream, std::vector<double> values);
+
+	// Escape string for JSON
+	static std::string EscapeJSON(const std::string& rString);
+
+	// Absolute directory of suite with trailing slash
+	std::string _suiteDirectory;
+
+	// Directory for report and scripted gaze trace
+	std::string _outputDirectory;
+
+	// Page files relative to suite directory
+	std::vector<std::string> _pages;
+	unsigned int _pageIndex = 0;
+
+	// Results of measured pages and measurement in progress
+	std::vector<Result> _results;
+	Result _current;
+	BenchmarkCounters _startCounters;
+};
+
+#endif // BENCHMARK_H_
@@ -48,14 +48,18 @@ public:
 	}
 	
 	int GetId() const { return _id; }
-	std::vector<Rect> GetRects() const { return _rects; }
+	const std::vector<Rect>& GetRects() const { return _rects; }
 	virtual int GetFixedId() const { return _fixedId; }
 	virtual int GetOverflowId() const { return _overflowId; }
 
+	// Set revision counter of owning store, which is increased whenever geometry changes
+	void SetRevision(std::shared_ptr<unsigned int> spRevision) { _spRevision = spRevision; }
+
 private:
 	void SetId(int id) { _id = id; }
-	void SetRects(std::vector<Rect> rects) { _rects = rects; }
-	void SetFixedId(int fixedId) { _fixedId = fixedId; }
+	void SetRects(std::vector<Rect> rects) { _rects = std::move(rects); IncreaseRevision(); }
+	void SetFixedId(int fixedId) { _fixedId = fixedId; IncreaseRevision(); }
+	void IncreaseRevision() { if (_spRevision) { (*_spRevision)++; } }
 	void SetOverflowId(int overflowId) { _overflowId = overflowId; }
 
 	bool IPCSetRects(CefRefPtr<CefListValue> data);
@@ -67,6 +71,7 @@ private:
 	std::vector<Rect> _rects = {};
 	int _fixedId = -1;				// first FixedElement's ID, which is hierarchically above this node, if any
 	int _overflowId = -1;				// first DOMOverflowElement's ID, which is hierarchically above this node, if any
+	std::shared_ptr<unsigned int> _spRevision;	// revision counter of owning store, if any
 
 };
 
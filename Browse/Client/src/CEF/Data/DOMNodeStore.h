@@ -0,0 +1,138 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+// Storage of DOM nodes of one type. Nodes are kept in a dense array, so
+// traversals do not walk a tree. Dense index of each node is looked up by the
+// id JavaScript has assigned to the node. Triggers, pipelines and the message
+// router keep shared or weak pointers to nodes, which outlive removal safely.
+// Rects of all nodes are mirrored into flat arrays which are rebuilt only
+// when some node reports changed geometry, so per frame scans over rects
+// are contiguous and do not copy a vector per node.
+// Node type must provide GetRects(), GetFixedId() and SetRevision().
+
+#ifndef DOMNODESTORE_H_
+#define DOMNODESTORE_H_
+
+#include "src/CEF/Data/Rect.h"
+#include <vector>
+#include <memory>
+
+template <class T>
+class DOMNodeStore
+{
+public:
+
+	// Constructor
+	DOMNodeStore() : _spRevision(std::make_shared<unsigned int>(0)) {}
+
+	// Destructor
+	virtual ~DOMNodeStore() { Clear(); }
+
+	// Add node under id. Replaces node with same id
+	void Add(int id, std::shared_ptr<T> spNode)
+	{
+		if (id < 0 || !spNode) { return; }
+		Remove(id);
+		if ((int)_denseIndices.size() <= id) { _denseIndices.resize(id + 1, -1); }
+
+		// Append to dense arrays
+		_denseIndices[id] = (int)_nodes.size();
+		_nodes.push_back(spNode);
+		_ids.push_back(id);
+		spNode->SetRevision(_spRevision);
+		(*_spRevision)++;
+	}
+
+	// Remove node with id. Returns whether node existed
+	bool Remove(int id)
+	{
+		if (id < 0 || id >= (int)_denseIndices.size() || _denseIndices[id] < 0) { return false; }
+
+		// Move last node into gap
+		int index = _denseIndices[id];
+		int lastIndex = (int)_nodes.size() - 1;
+		_nodes[index]->SetRevision(nullptr);
+		if (index != lastIndex)
+		{
+			_nodes[index] = std::move(_nodes[lastIndex]);
+			_ids[index] = _ids[lastIndex];
+			_denseIndices[_ids[index]] = index;
+		}
+		_nodes.pop_back();
+		_ids.pop_back();
+		_denseIndices[id] = -1;
+		(*_spRevision)++;
+		return true;
+	}
+
+	// Remove all nodes
+	void Clear()
+	{
+		for (const auto& rspNode : _nodes) { rspNode->SetRevision(nullptr); }
+		for (int id : _ids) { _denseIndices[id] = -1; }
+		_nodes.clear();
+		_ids.clear();
+		(*_spRevision)++;
+	}
+
+	// Get node by id. Returns empty pointer if not existing
+	std::shared_ptr<T> Get(int id) const
+	{
+		if (id < 0 || id >= (int)_denseIndices.size() || _denseIndices[id] < 0) { return std::shared_ptr<T>(); }
+		return _nodes[_denseIndices[id]];
+	}
+
+	// Count of nodes
+	int Size() const { return (int)_nodes.size(); }
+	bool Empty() const { return _nodes.empty(); }
+
+	// Nodes in dense order, which changes when nodes are removed
+	const std::vector<std::shared_ptr<T> >& GetNodes() const { return _nodes; }
+
+	// Rects of all nodes in dense order
+	const std::vector<Rect>& GetRects() const { Sync(); return _rects; }
+
+	// Dense index of owning node for each rect
+	const std::vector<int>& GetRectOwners() const { Sync(); return _rectOwners; }
+
+	// Fixed id of each node in dense order
+	const std::vector<int>& GetFixedIds() const { Sync(); return _fixedIds; }
+
+private:
+
+	// Rebuild flat arrays if geometry of any node has changed
+	void Sync() const
+	{
+		if (_syncedRevision == *_spRevision) { return; }
+		_rects.clear();
+		_rectOwners.clear();
+		_fixedIds.resize(_nodes.size());
+		for (int i = 0; i < (int)_nodes.size(); i++)
+		{
+			const std::vector<Rect>& rRects = _nodes[i]->GetRects();
+			_rects.insert(_rects.end(), rRects.begin(), rRects.end());
+			_rectOwners.insert(_rectOwners.end(), rRects.size(), i);
+			_fixedIds[i] = _nodes[i]->GetFixedId();
+		}
+		_syncedRevision = *_spRevision;
+	}
+
+	// Dense index of node indexed by id, negative if not existing
+	std::vector<int> _denseIndices;
+
+	// Dense arrays of nodes and their ids
+	std::vector<std::shared_ptr<T> > _nodes;
+	std::vector<int> _ids;
+
+	// Revision of geometry, increased by nodes and by changes of the store
+	std::shared_ptr<unsigned int> _spRevision;
+
+	// Flat arrays, rebuilt when revision has changed
+	mutable unsigned int _syncedRevision = 0;
+	mutable std::vector<Rect> _rects;
+	mutable std::vector<int> _rectOwners;
+	mutable std::vector<int> _fixedIds;
+};
+
+#endif // DOMNODESTORE_H_
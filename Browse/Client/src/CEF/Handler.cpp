@@ -9,6 +9,7 @@
 #include "src/CEF/RequestHandler.h"
 #include "src/Utils/Logger.h"
 #include "src/Singletons/JSMailer.h"
+#include "src/Singletons/IPCCounter.h"
 #include "include/base/cef_bind.h"
 #include "include/cef_app.h"
 #include "include/wrapper/cef_closure_task.h"
@@ -82,6 +83,15 @@ void Handler::OnBeforeClose(CefRefPtr<CefBrowser> browser)
     }
   }
 
+  // Forget pending latency measurement
+  _contextCreationTimes.erase(browser->GetIdentifier());
+
+  // Forget paint which has not been uploaded
+  _renderer->ForgetBrowser(browser->GetIdentifier());
+
+  // No more logging data for this browser
+  JSMailer::instance().Unsubscribe(browser->GetIdentifier());
+
   //if (_browserList.empty())
   //{
   //  // All browser windows have closed. Quit the application's message loop
@@ -127,6 +137,7 @@ void Handler::OnLoadStart(CefRefPtr<CefBrowser> browser, CefRefPtr<CefFrame> fra
     {
 		//LogDebug("Handler: Started loading frame id = ", frame->GetIdentifier(), " (main = ", frame->IsMain(), "), browserID = ", browser->GetIdentifier());
 
+		IPCCounter::instance().CountJavaScript();
 		frame->ExecuteJavaScript("StartPageLoadingTimer();", "", 0);
 
         // Set Tab's URL when page is loading
@@ -136,6 +147,7 @@ void Handler::OnLoadStart(CefRefPtr<CefBrowser> browser, CefRefPtr<CefFrame> fra
         SetZoomLevel(browser, false);
 
         // Inject Javascript to hide scrollbar
+        IPCCounter::instance().CountJavaScript();
         frame->ExecuteJavaScript(_js_remove_css_scrollbar, frame->GetURL(), 0);
 
     }
@@ -153,12 +165,14 @@ void Handler::OnLoadEnd(CefRefPtr<CefBrowser> browser, CefRefPtr<CefFrame> frame
     if (frame->IsMain())
     {
 		//LogDebug("Handler: End of loading frame id = ", frame->GetIdentifier(), " (main = ", frame->IsMain(), ").");
+		IPCCounter::instance().CountJavaScript();
 		frame->ExecuteJavaScript("StopPageLoadingTimer();", "", 0);
 
         // Set zoom level according to Tab's settings
         SetZoomLevel(browser, false);
 
 		// Inject Javascript to hide scrollbar
+		IPCCounter::instance().CountJavaScript();
 		frame->ExecuteJavaScript(_js_remove_css_scrollbar, frame->GetURL(), 0);
     }
 
@@ -180,8 +194,8 @@ void Handler::OnLoadingStateChange(CefRefPtr<CefBrowser> browser,
         // Set zoom level again at load end, in case it was written over again
         SetZoomLevel(browser, false);
 
-        // Write page resolution to V8 variables, read them and update Tab
-        UpdatePageResolution(browser);
+        // Page size might have settled without change of tracked DOM nodes
+        RequestGeometryPush(browser);
 
     }
 }
@@ -225,6 +239,7 @@ bool Handler::OnProcessMessageReceived(CefRefPtr<CefBrowser> browser,
     CefRefPtr<CefProcessMessage> msg)
 {
     const std::string& msgName = msg->GetName().ToString();
+    IPCCounter::instance().CountReceived();
 
 	if (msgName == "SubmitInput")
 	{
@@ -268,16 +283,6 @@ bool Handler::OnProcessMessageReceived(CefRefPtr<CefBrowser> browser,
         _pMediator->ReceiveIPCMessageforFavIcon(browser, msg);
 		return true;
     }
-    if (msgName == "ReceivePageResolution")
-    {
-        _pMediator->ReceivePageResolution(browser, msg);
-		return true;
-    }
-    if (msgName == "ReceiveFixedElements")
-    {
-        _pMediator->ReceiveFixedElements(browser, msg);
-		return true;
-    }
     if (msgName == "IPCLog")
     {
         IPCLogRenderer(browser, msg);
@@ -287,6 +292,9 @@ bool Handler::OnProcessMessageReceived(CefRefPtr<CefBrowser> browser,
 	if (msgName == "OnContextCreated")
 	{
 		_pMediator->ClearDOMNodes(browser);
+
+		// Remember time to measure latency until first DOM rect is received
+		_contextCreationTimes[browser->GetIdentifier()] = std::chrono::steady_clock::now();
 		return true;
 	}
 	if (msgName == "SendDOMNodeData")
@@ -318,6 +326,15 @@ bool Handler::OnProcessMessageReceived(CefRefPtr<CefBrowser> browser,
 		const std::string type = msgName.substr(12, msgName.size() - 16); // NOTE: -4 + (-12) -> remove "Data" at the end
 		const int& id = msg->GetArgumentList()->GetInt(0);
 
+		// Log latency between context creation and first DOM rect
+		auto contextCreationIter = _contextCreationTimes.find(browser->GetIdentifier());
+		if (contextCreationIter != _contextCreationTimes.end())
+		{
+			auto latency = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - contextCreationIter->second);
+			LogDebug("Handler: First DOM rect received ", latency.count(), "ms after context creation (browser id = ", browser->GetIdentifier(), ").");
+			_contextCreationTimes.erase(contextCreationIter);
+		}
+
 		if (type == "TextInput")
 		{
 			const auto& wpNode = _pMediator->GetDOMTextInput(browser, id);
@@ -426,21 +443,27 @@ void Handler::ResizeBrowsers()
 
         bit->get()->GetHost()->WasResized();
 
-        // Resize may cause change in page size
-        UpdatePageResolution(bit->get());
-
 		// TODO / NOTE: 
 		// It might be better to perform that Rect Update not simultaneously on every browser.
 		// Instead save it and execute it when you switch to the target tab
 
+		IPCCounter::instance().CountJavaScript();
 		bit->get()->GetMainFrame()->ExecuteJavaScript("UpdateDOMRects();", "", 0);
 
-        // EXPERIMENTAL
-        //GetFixedElements(bit->get());
-
     }
 }
 
+void Handler::NotifyScreenInfoChanged(CefRefPtr<CefBrowser> browser)
+{
+    browser->GetHost()->NotifyScreenInfoChanged();
+    browser->GetHost()->WasResized();
+}
+
+void Handler::Invalidate(CefRefPtr<CefBrowser> browser)
+{
+    browser->GetHost()->Invalidate(PET_VIEW);
+}
+
 void Handler::LoadPage(CefRefPtr<CefBrowser> browser, std::string url)
 {
     LogDebug("Handler: Loading page ", url);
@@ -487,6 +510,7 @@ bool Handler::InputTextData(CefRefPtr<CefBrowser> browser, int64 frameID, int no
 	args->SetString(1, text);
 	args->SetBool(2, submit);
 
+	IPCCounter::instance().CountSent();
 	browser->SendProcessMessage(PID_RENDERER, msg);
 
 	return true;
@@ -521,46 +545,59 @@ void Handler::ReplyJSDialog(CefRefPtr<CefBrowser> browser, bool clicked_ok, std:
 void Handler::ResetMainFramesScrolling(CefRefPtr<CefBrowser> browser)
 {
     const std::string resetScrolling = "document.body.scrollTop=0; document.body.scrollLeft=0;";
+    IPCCounter::instance().CountJavaScript();
     browser->GetMainFrame()->ExecuteJavaScript(resetScrolling, browser->GetMainFrame()->GetURL(), 0);
 }
 
-void Handler::SetZoomLevel(CefRefPtr<CefBrowser> browser, bool definitelyChanged)
+void Handler::SetMainFramesScrolling(CefRefPtr<CefBrowser> browser, double x, double y)
 {
+    const std::string setScrolling = "window.scrollTo(" + std::to_string(x) + ", " + std::to_string(y) + ");";
+    IPCCounter::instance().CountJavaScript();
+    browser->GetMainFrame()->ExecuteJavaScript(setScrolling, browser->GetMainFrame()->GetURL(), 0);
+}
 
-    if (double zoomLevel = _pMediator->GetZoomLevel(browser))
+void Handler::GetBackHistory(CefRefPtr<CefBrowser> browser, std::vector<std::string>& rURLs)
+{
+    // Visitor is called synchronously on UI thread with entries in order of their index
+    class BackHistoryVisitor : public CefNavigationEntryVisitor
     {
-        LogDebug("Handler: Setting zoom level = ", zoomLevel, " (browserID = ", browser->GetIdentifier(), ").");
-		const std::string setZoomLevel = "if(document.body !== null && document.body !== undefined) document.body.style.zoom=" + std::to_string(zoomLevel) + ";this.blur(); UpdateDOMRects();";
-        browser->GetMainFrame()->ExecuteJavaScript(setZoomLevel, "", 0); 
+    public:
 
-        if (definitelyChanged)
-        {
-            UpdatePageResolution(browser);				// TODO: Does a JS event exist for this?
+        BackHistoryVisitor(std::vector<std::string>& rURLs) : _rURLs(rURLs) {}
 
+        bool Visit(CefRefPtr<CefNavigationEntry> entry, bool current, int index, int total) OVERRIDE
+        {
+            if (current) { return false; }
+            _rURLs.push_back(entry->GetURL().ToString());
+            return true;
         }
-    }
+
+    private:
+
+        std::vector<std::string>& _rURLs;
+        IMPLEMENT_REFCOUNTING(BackHistoryVisitor);
+    };
+
+    rURLs.clear();
+    browser->GetHost()->GetNavigationEntries(new BackHistoryVisitor(rURLs), false);
 }
 
-void Handler::UpdatePageResolution(CefRefPtr<CefBrowser> browser)
+void Handler::SetZoomLevel(CefRefPtr<CefBrowser> browser, bool definitelyChanged)
 {
-	// TODO: Return these values by calling a function (in Renderer Process), get rid of these window variables
-
-    // Javascript code for receiving the current page width & height
-	const std::string getPageResolution = "\
-            if(document.documentElement && document.body !== null && document.body !== undefined)\
-			{\
-			window._pageWidth = document.body.scrollWidth;\
-            window._pageHeight = document.body.scrollHeight;\
-			}\
-			else\
-				console.log('Handler::UpdatePageResolution: Could not access document.documentElement or document.body!');\
-            ";
 
-    browser->GetMainFrame()->ExecuteJavaScript(getPageResolution, browser->GetMainFrame()->GetURL(), 0);
+    if (double zoomLevel = _pMediator->GetZoomLevel(browser))
+    {
+        LogDebug("Handler: Setting zoom level = ", zoomLevel, " (browserID = ", browser->GetIdentifier(), ").");
+		const std::string setZoomLevel = "if(document.body !== null && document.body !== undefined) document.body.style.zoom=" + std::to_string(zoomLevel) + ";this.blur(); UpdateDOMRects();";
+        IPCCounter::instance().CountJavaScript();
+        browser->GetMainFrame()->ExecuteJavaScript(setZoomLevel, "", 0); // DOM rect update pushes page size, too
+    }
+}
 
-    // Tell renderer process to get V8 values, where page sizes were written to
-    CefRefPtr<CefProcessMessage> msg = CefProcessMessage::Create("GetPageResolution");
-    browser->SendProcessMessage(PID_RENDERER, msg);
+void Handler::RequestGeometryPush(CefRefPtr<CefBrowser> browser)
+{
+    IPCCounter::instance().CountJavaScript();
+    browser->GetMainFrame()->ExecuteJavaScript("if(typeof RequestDOMRectsFlush === 'function') RequestDOMRectsFlush();", "", 0);
 }
 
 void Handler::IPCLogRenderer(CefRefPtr<CefBrowser> browser, CefRefPtr<CefProcessMessage> msg)
@@ -640,6 +677,7 @@ void Handler::OnFaviconURLChange(CefRefPtr<CefBrowser> browser,
 
     // Trigger favIconImg.onload function by setting image src
     const std::string jscode = "favIconImg.src = '" + iconURL + "';";
+    IPCCounter::instance().CountJavaScript();
     browser->GetMainFrame()->ExecuteJavaScript(jscode, "", 0); 
 
     // New image incoming, delete the last one
@@ -685,18 +723,30 @@ void Handler::ScrollOverflowElement(CefRefPtr<CefBrowser> browser, int elemId, i
 		args->SetInt(count++, id);
 	}
 
+	IPCCounter::instance().CountSent();
 	browser->SendProcessMessage(PID_RENDERER, msg);
 }
 
-void Handler::SendToJSLoggingMediator(std::string message)
+void Handler::SendToJSLoggingMediator(const std::vector<std::string>& rMessages, const std::set<int>& rBrowserIds)
 {
+	// Pack all messages into one list
+	CefRefPtr<CefListValue> messages = CefListValue::Create();
+	messages->SetSize(rMessages.size());
+	for (int i = 0; i < (int)rMessages.size(); i++)
+	{
+		messages->SetString(i, rMessages.at(i));
+	}
+
 	CefRefPtr<CefProcessMessage> msg = CefProcessMessage::Create("SendToLoggingMediator");
-	msg->GetArgumentList()->SetString(0, message);
+	msg->GetArgumentList()->SetList(0, messages);
 
-	// Send message to every browser
+	// Send message only to given browsers
 	for (const auto& browser : _browserList)
 	{
-		browser->SendProcessMessage(PID_RENDERER, msg);
+		if (rBrowserIds.find(browser->GetIdentifier()) != rBrowserIds.end())
+		{
+			IPCCounter::instance().CountSent();
+			browser->SendProcessMessage(PID_RENDERER, msg);
+		}
 	}
-	
 }
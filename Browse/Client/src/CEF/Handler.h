@@ -13,6 +13,9 @@
 #include "src/CEF/MessageRouter.h"
 #include <list>
 #include <set>
+#include <vector>
+#include <map>
+#include <chrono>
 
 // Forward declaration
 class Mediator;
@@ -117,6 +120,12 @@ public:
     // Called by CefMediator, when window resize happens
     void ResizeBrowsers();
 
+    // Tell browser about changed device scale factor, which makes it paint again in other resolution
+    void NotifyScreenInfoChanged(CefRefPtr<CefBrowser> browser);
+
+    // Request painting of browser's view, although nothing has changed
+    void Invalidate(CefRefPtr<CefBrowser> browser);
+
     // Emulation of mouse buttons in specific browser
     void EmulateMouseCursor(CefRefPtr<CefBrowser> browser, double x, double y, bool leftButtonPressed);
     void EmulateLeftMouseButtonClick(CefRefPtr<CefBrowser> browser, double x, double y);
@@ -126,15 +135,16 @@ public:
     bool InputTextData(CefRefPtr<CefBrowser> browser, int64 frameID, int nodeID, std::string text, bool submit = false);
 
     void ResetMainFramesScrolling(CefRefPtr<CefBrowser> browser);
+    void SetMainFramesScrolling(CefRefPtr<CefBrowser> browser, double x, double y);
+
+    // Collect URLs of navigation entries before current one, oldest first
+    void GetBackHistory(CefRefPtr<CefBrowser> browser, std::vector<std::string>& rURLs);
 
     // Bool value indicates need to reload DOM node data, true when called from outside of Tab due to changes
     void SetZoomLevel(CefRefPtr<CefBrowser> browser, bool definitelyChanged = true);
 
-    // Write page resolution to V8 variables, read them and update Tab
-    void UpdatePageResolution(CefRefPtr<CefBrowser> browser);
-
-    // EXPERIMENTAL: Request coordinates of fixed elements (like bars on top of pages)
-    void GetFixedElements(CefRefPtr<CefBrowser> browser);
+    // Let JavaScript push page size and rects of fixed elements if changed. Otherwise, they are pushed whenever DOM changes
+    void RequestGeometryPush(CefRefPtr<CefBrowser> browser);
 
 	// CefDisplayHandler callbacks
 	void OnFaviconURLChange(CefRefPtr<CefBrowser> browser,
@@ -150,8 +160,8 @@ public:
 		_msgRouter->RegisterJavascriptCallback(prefix, callbackFunction);
 	}
 
-	// Send log data to LoggingMediator instance in each browser context
-	void SendToJSLoggingMediator(std::string message);
+	// Send batch of log data to LoggingMediator instance in context of each given browser
+	void SendToJSLoggingMediator(const std::vector<std::string>& rMessages, const std::set<int>& rBrowserIds);
 
 private:
 
@@ -189,6 +199,9 @@ private:
 	// Map of browser identifier to JavaScript dialog callbacks that can be answered (may be never answered or to late TODO: problem?)
 	std::map<int, CefRefPtr<CefJSDialogCallback> > _jsDialogCallbacks;
 
+	// Map of browser identifier to time of main frame context creation, until first DOM rect arrives
+	std::map<int, std::chrono::steady_clock::time_point> _contextCreationTimes;
+
     // Include CEF'S default reference counting implementation
     IMPLEMENT_REFCOUNTING(Handler);
 };
@@ -7,6 +7,8 @@
 #include "JSCode.h"
 #include <map>
 #include <fstream>
+#include <vector>
+#include <mutex>
 #include <iostream> // as called from differen processes, one cannot simply use LogInfo / LogError :(
 
 // Folder with external JavaScript code
@@ -26,10 +28,31 @@ const std::map<JSFile, std::string> findJSFile =
 	std::make_pair<JSFile, std::string>(DOM_FIXED_ELEMENTS, src + "dom_fixed_elements.js")
 };
 
+// Files which are part of the bootstrap, in order of execution
+const std::vector<JSFile> bootstrapJSFiles =
+{
+	FAVICON_CREATE_IMG,
+	DOM_MUTATIONOBSERVER,
+	MUTATION_OBSERVER_TEST,
+	DOM_FIXED_ELEMENTS
+};
+
+// Cache of already read files, filled once per process
+std::map<JSFile, std::string> cachedJSFiles;
+std::mutex cachedJSFilesMutex;
+
 std::string GetJSCode(JSFile file)
 {
     if (findJSFile.find(file) != findJSFile.end())
     {
+		// Return cached code when file has been read before
+		std::lock_guard<std::mutex> lock(cachedJSFilesMutex);
+		auto iter = cachedJSFiles.find(file);
+		if (iter != cachedJSFiles.end())
+		{
+			return iter->second;
+		}
+
         const std::string filePath = findJSFile.at(file);
         std::ifstream t(filePath);
         if (t.is_open())
@@ -39,6 +62,7 @@ std::string GetJSCode(JSFile file)
             std::string buffer(size, ' ');
             t.seekg(0);
             t.read(&buffer[0], size);
+			cachedJSFiles.emplace(file, buffer);
             return buffer;
         }
         else
@@ -54,6 +78,23 @@ std::string GetJSCode(JSFile file)
     }
 }
 
+std::string GetJSBootstrap()
+{
+	// Bundle is built once per process
+	static const std::string bootstrap = []()
+	{
+		std::string code;
+		for (JSFile file : bootstrapJSFiles)
+		{
+			// Isolate files from each other, so an exception in one file does not stop the others
+			code += "try {\n" + GetJSCode(file) + "\n;}\n";
+			code += "catch (exception) { console.log('JSCode: Bootstrap file " + std::to_string((int)file) + " failed: ' + exception.message); }\n";
+		}
+		return code;
+	}();
+	return bootstrap;
+}
+
 std::string jsInputTextData(int inputID, std::string text, bool submit)
 {
 	std::string code = "var domObj = GetDOMObject(0," + std::to_string(inputID) + ");\
@@ -21,6 +21,10 @@
 *	5.) Add a constant std::string member to your class and initialize it with GetJSCode function
 *	6.)	Inject your Javascript code by using your new member variable
 *
+*	Files are read only once per process and cached afterwards. Code which has to run in every
+*	main frame context should be added to the bootstrap (see bootstrapJSFiles in JSCode.cpp)
+*	instead of being injected separately.
+*
 */
 
 enum JSFile
@@ -36,7 +40,11 @@ enum JSFile
 	DOM_FIXED_ELEMENTS
 };
 
+// Script URL of bootstrap. Kept constant so V8 can reuse compiled code across navigations
+static const std::string JS_BOOTSTRAP_URL = "gazetheweb://bootstrap.js";
+
 std::string GetJSCode(JSFile file);
+std::string GetJSBootstrap(); // concatenation of all files executed at context creation
 std::string jsInputTextData(int inputID, std::string text, bool submit = false);
 std::string jsFavIconUpdate(std::string oldUrl);
 
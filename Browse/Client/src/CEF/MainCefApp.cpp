@@ -44,11 +44,19 @@ void MainCefApp::OnContextInitialized()
 	// TODO: handlers are members in Mediator but created here. Looks strange
 
     // Create Renderer
-    CefRefPtr<Renderer> renderer(new Renderer(this));
+    _renderer = new Renderer(this);
 
     // Create Handler
-	_handler = new Handler(this, renderer);
+	_handler = new Handler(this, _renderer);
 
 	// Create handler for dev tools
 	_devToolsHandler = new DevToolsHandler();
-}
\ No newline at end of file
+}
+
+#ifdef CEF_EXTERNAL_MESSAGE_PUMP_AVAILABLE
+void MainCefApp::OnScheduleMessagePumpWork(int64 delay_ms)
+{
+	// Work is done by master thread, just remember when
+	ScheduleMessagePumpWork(delay_ms);
+}
+#endif
\ No newline at end of file
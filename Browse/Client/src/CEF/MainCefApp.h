@@ -23,6 +23,9 @@ public:
     // CefBrowserProcessHandler methods
     virtual CefRefPtr<CefBrowserProcessHandler> GetBrowserProcessHandler() OVERRIDE { return this; }
     virtual void OnContextInitialized() OVERRIDE;
+#ifdef CEF_EXTERNAL_MESSAGE_PUMP_AVAILABLE
+    virtual void OnScheduleMessagePumpWork(int64 delay_ms) OVERRIDE; // may be called from any thread
+#endif
 
 private:
 
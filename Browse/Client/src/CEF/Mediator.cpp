@@ -12,8 +12,12 @@
 #include "src/State/Web/Tab/Interface/TabCEFInterface.h"
 #include "src/CEF/Data/DOMNode.h"
 #include "src/Utils/Logger.h"
+#include "src/Global.h"
+#include "src/Singletons/FrameProfiler.h"
+#include "src/Singletons/IPCCounter.h"
 #include "include/cef_app.h"
 #include "include/wrapper/cef_helpers.h"
+#include <algorithm>
 
 
 void Mediator::SetMaster(MasterNotificationInterface* pMaster)
@@ -38,10 +42,11 @@ void Mediator::RegisterTab(TabCEFInterface* pTab)
     if(setup::ENABLE_WEBGL)
     {
         browser_settings.webgl = STATE_ENABLED;
-        browser_settings.windowless_frame_rate = 60;
-	
     }
 
+    // Let CEF paint at display rate. Uploads are limited by Renderer
+    browser_settings.windowless_frame_rate = setup::CEF_WINDOWLESS_FRAME_RATE;
+
 	browser_settings.application_cache = STATE_ENABLED; // Goal: Accepting & saving cookies enabled
 
     // TODO: Delay Renderer OR save Tab & Texture as default if key(browser) not in map, reset after map insertion
@@ -134,7 +139,92 @@ void Mediator::ReplyJSDialog(TabCEFInterface* pTab, bool clicked_ok, std::string
 
 void Mediator::DoMessageLoopWork()
 {
-    CefDoMessageLoopWork();
+    // Polling does work once per call
+    if (!UsesExternalMessagePump())
+    {
+        CefDoMessageLoopWork();
+        return;
+    }
+
+    // Do work as long as it is due, but not longer than time slice
+    const auto start = std::chrono::steady_clock::now();
+    while (true)
+    {
+        // Check whether work is due and schedule fallback work (CEF may schedule earlier while working)
+        {
+            std::lock_guard<std::mutex> lock(_messagePumpMutex);
+            const auto now = std::chrono::steady_clock::now();
+            if (now < _messagePumpDueTime) { break; }
+            _messagePumpDueTime = now + std::chrono::milliseconds(CEF_MESSAGE_PUMP_MAX_DELAY_MS);
+        }
+
+        CefDoMessageLoopWork();
+
+        if (std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(CEF_MESSAGE_PUMP_TIME_SLICE_MS)) { break; }
+    }
+}
+
+void Mediator::ScheduleMessagePumpWork(int64 delayMs)
+{
+    std::lock_guard<std::mutex> lock(_messagePumpMutex);
+    const auto dueTime = std::chrono::steady_clock::now() + std::chrono::milliseconds(std::max((int64)0, delayMs));
+    if (dueTime < _messagePumpDueTime)
+    {
+        _messagePumpDueTime = dueTime;
+    }
+}
+
+void Mediator::OnInputSent()
+{
+    // Only first input since last paint is of interest
+    if (!_inputPending)
+    {
+        _inputSentTime = std::chrono::steady_clock::now();
+        _inputPending = true;
+    }
+}
+
+void Mediator::OnPaintDone(float paintTime)
+{
+    _paintTime += paintTime;
+    if (_inputPending)
+    {
+        _inputPending = false;
+        FrameProfiler::instance().AddSample(
+            "InputToPaint",
+            std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - _inputSentTime).count());
+    }
+}
+
+float Mediator::TakePaintTime()
+{
+    float paintTime = _paintTime;
+    _paintTime = 0.f;
+    return paintTime;
+}
+
+void Mediator::BeginFrame(float tpf)
+{
+    // Look up without GetBrowser, which complains about unknown tabs
+    int activeBrowserId = -1;
+    auto iter = _browsers.find(_activeTab);
+    if (iter != _browsers.end())
+    {
+        activeBrowserId = iter->second->GetIdentifier();
+    }
+    _renderer->BeginFrame(tpf, activeBrowserId);
+}
+
+std::string Mediator::GetPaintReport() const
+{
+    return _renderer->GetReport();
+}
+
+void Mediator::GetPaintCounts(unsigned int& rPaintCount, unsigned int& rUploadCount, unsigned int& rSkippedCount) const
+{
+    rPaintCount = _renderer->GetPaintCount();
+    rUploadCount = _renderer->GetUploadCount();
+    rSkippedCount = _renderer->GetSkippedCount();
 }
 
 void Mediator::EmulateMouseCursor(TabCEFInterface* pTab, double x, double y, bool leftButtonPressed)
@@ -142,6 +232,7 @@ void Mediator::EmulateMouseCursor(TabCEFInterface* pTab, double x, double y, boo
     if(CefRefPtr<CefBrowser> browser = GetBrowser(pTab))
     {
         _handler->EmulateMouseCursor(browser, x, y, leftButtonPressed);
+        OnInputSent();
     }
 }
 
@@ -153,6 +244,7 @@ void Mediator::EmulateLeftMouseButtonClick(TabCEFInterface * pTab, double x, dou
 
         // Get Tab information and do browser work in Handler
         _handler->EmulateLeftMouseButtonClick(browser, x, y);
+        OnInputSent();
     }
 }
 
@@ -161,6 +253,7 @@ void Mediator::EmulateMouseWheelScrolling(TabCEFInterface * pTab, double deltaX,
     if (CefRefPtr<CefBrowser> browser = GetBrowser(pTab))
     {
         _handler->EmulateMouseWheelScrolling(browser, deltaX, deltaY);
+        OnInputSent();
     }
 }
 
@@ -312,6 +405,7 @@ void Mediator::SetSelectionIndex(TabCEFInterface * tab, int nodeId, int index)
                 auto args = msg->GetArgumentList();
 		args->SetInt(0, nodeId);
 		args->SetInt(1, index);
+		IPCCounter::instance().CountSent();
 		browser->SendProcessMessage(PID_RENDERER, msg);
 	}
 }
@@ -413,6 +507,24 @@ void Mediator::ResetScrolling(TabCEFInterface * pTab)
     }
 }
 
+void Mediator::RestoreScrolling(TabCEFInterface * pTab, double x, double y)
+{
+    if (CefRefPtr<CefBrowser> browser = GetBrowser(pTab))
+    {
+        _handler->SetMainFramesScrolling(browser, x, y);
+    }
+}
+
+bool Mediator::GetBackHistory(TabCEFInterface * pTab, std::vector<std::string>& rURLs)
+{
+    if (CefRefPtr<CefBrowser> browser = GetBrowser(pTab))
+    {
+        _handler->GetBackHistory(browser, rURLs);
+        return true;
+    }
+    return false;
+}
+
 void Mediator::SetURL(CefRefPtr<CefBrowser> browser)
 {
     if (TabCEFInterface* pTab = GetTab(browser))
@@ -454,49 +566,19 @@ double Mediator::GetZoomLevel(CefRefPtr<CefBrowser> browser)
     return NAN;
 }
 
-void Mediator::ReceivePageResolution(CefRefPtr<CefBrowser> browser, CefRefPtr<CefProcessMessage> msg)
+void Mediator::ReceivePageResolution(CefRefPtr<CefBrowser> browser, double width, double height)
 {
     if (TabCEFInterface* pTab = GetTab(browser))
     {
-        CefRefPtr<CefListValue> args = msg->GetArgumentList();
-		double pageWidth = args->GetDouble(0);
-		double pageHeight = args->GetDouble(1);
-        pTab->SetPageResolution(pageWidth, pageHeight);
+        pTab->SetPageResolution(width, height);
     }
 }
 
-void Mediator::GetPageResolution(TabCEFInterface * pTab)
+void Mediator::ReceiveFixedElements(CefRefPtr<CefBrowser> browser, int id, std::vector<Rect> rects)
 {
-    if (CefRefPtr<CefBrowser> browser = GetBrowser(pTab))
-    {
-        _handler->UpdatePageResolution(browser);
-    }
-}
-
-void Mediator::ReceiveFixedElements(CefRefPtr<CefBrowser> browser, CefRefPtr<CefProcessMessage> msg)
-{
-    CefRefPtr<CefListValue> args = msg->GetArgumentList();
-    int id = args->GetInt(0);
-    std::vector<Rect> fixedCoords = {};
-    for (int i = 1; i < (int)args->GetSize(); i+=4)
-    {
-        fixedCoords.push_back(
-            Rect(
-                args->GetDouble(i), // top
-                args->GetDouble(i + 1), // left
-                args->GetDouble(i + 2), // bottom
-                args->GetDouble(i + 3) // right
-                )
-            );
-    }
     if (TabCEFInterface* pTab = GetTab(browser))
     {
-      /*  LogDebug("Mediator: Sending ", fixedCoords.size(), " fixed element coordinate tupel(s) to Tab for fixedID=", id, ".");
-        for (int i = 0; i < (int)fixedCoords.size(); i++)
-        {
-             LogDebug("\t-->", fixedCoords[i].top, ", ", fixedCoords[i].left, ", ", fixedCoords[i].bottom, ", ", fixedCoords[i].right);
-        }*/
-        pTab->AddFixedElementsCoordinates(id, fixedCoords);
+        pTab->AddFixedElementsCoordinates(id, rects);
     }
 }
 
@@ -624,6 +706,7 @@ void Mediator::PutTextSelectionToClipboardAsync(TabCEFInterface* pTab)
 		ClearClipboardText();
 
 		// Asynchronous javascript call. See BrowserMsgRouter #select# in onQuery
+		IPCCounter::instance().CountJavaScript();
 		browser->GetMainFrame()->ExecuteJavaScript("GetTextSelection();", "", 0);
 	}
 }
@@ -697,6 +780,14 @@ void Mediator::OnScrollOffsetChanged(CefRefPtr<CefBrowser> browser, double x, do
     }
 }
 
+void Mediator::OnTextureUploaded(CefRefPtr<CefBrowser> browser, double scrollingOffsetY)
+{
+    if (TabCEFInterface* pTab = GetTab(browser))
+    {
+        pTab->SetRenderedScrollingOffset(scrollingOffsetY);
+    }
+}
+
 void Mediator::GetResolution(CefRefPtr<CefBrowser> browser, int& width, int& height) const
 {
     if (TabCEFInterface* pTab = GetTab(browser))
@@ -716,6 +807,48 @@ void Mediator::GetResolution(CefRefPtr<CefBrowser> browser, int& width, int& hei
     }
 }
 
+float Mediator::GetDeviceScaleFactor(CefRefPtr<CefBrowser> browser) const
+{
+    if (TabCEFInterface* pTab = GetTab(browser))
+    {
+        return pTab->GetDeviceScaleFactor();
+    }
+    return 1.f;
+}
+
+float Mediator::GetRenderScale(CefRefPtr<CefBrowser> browser) const
+{
+    if (TabCEFInterface* pTab = GetTab(browser))
+    {
+        return pTab->GetRenderScale();
+    }
+    return 1.f;
+}
+
+void Mediator::FillZoomTexture(CefRefPtr<CefBrowser> browser, int width, int height, const unsigned char* pBuffer)
+{
+    if (TabCEFInterface* pTab = GetTab(browser))
+    {
+        pTab->FillZoomTexture(width, height, pBuffer);
+    }
+}
+
+void Mediator::NotifyScreenInfoChanged(TabCEFInterface* pTab)
+{
+    if (CefRefPtr<CefBrowser> browser = GetBrowser(pTab))
+    {
+        _handler->NotifyScreenInfoChanged(browser);
+    }
+}
+
+void Mediator::RepaintTab(TabCEFInterface* pTab)
+{
+    if (CefRefPtr<CefBrowser> browser = GetBrowser(pTab))
+    {
+        _handler->Invalidate(browser);
+    }
+}
+
 void Mediator::ResizeTabs()
 {
     _handler->ResizeBrowsers();
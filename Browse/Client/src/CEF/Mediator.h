@@ -9,14 +9,24 @@
 
 #include "src/MasterNotificationInterface.h"
 #include "include/cef_browser.h"
+#include "include/cef_version.h"
 #include "src/CEF/Handler.h"
 #include "src/CEF/DevToolsHandler.h"
 #include "src/CEF/JavaScriptDialogType.h"
+#include "src/CEF/Data/Rect.h"
+#include "src/Setup.h"
 #include <set>
 #include <map>
 #include <memory>
 #include <queue>
 #include <functional>
+#include <mutex>
+#include <chrono>
+
+// CEF schedules its message loop work only since branch 2623 (Chrome 49)
+#if CHROME_VERSION_MAJOR >= 49
+#define CEF_EXTERNAL_MESSAGE_PUMP_AVAILABLE
+#endif
 
 /**
 *	Expand CefApp by methods and attributes used to communicate with Master and
@@ -60,15 +70,60 @@ public:
     // Equally named Renderer's callback pipes data to CefMediator, who sets offset in correlating tab
     void OnScrollOffsetChanged(CefRefPtr<CefBrowser> browser, double x, double y);
 
+    // Renderer tells scrolling offset of paint which has been uploaded into texture of correlating tab
+    void OnTextureUploaded(CefRefPtr<CefBrowser> browser, double scrollingOffsetY);
+
     // Get resolution of rendering
     void GetResolution(CefRefPtr<CefBrowser> browser, int& width, int& height) const;
 
+    // Get device scale factor of rendering and the one used outside of zooming
+    float GetDeviceScaleFactor(CefRefPtr<CefBrowser> browser) const;
+    float GetRenderScale(CefRefPtr<CefBrowser> browser) const;
+
+    // Renderer::OnPaint passes rendering with device scale factor above one to tab
+    void FillZoomTexture(CefRefPtr<CefBrowser> browser, int width, int height, const unsigned char* pBuffer);
+
+    // Called by tab when its device scale factor has changed
+    void NotifyScreenInfoChanged(TabCEFInterface* pTab);
+
+    // Request new paint of tab, e.g. when zoomed region has moved
+    void RepaintTab(TabCEFInterface* pTab);
+
     // Called by Master when window resize happens
     void ResizeTabs();
 
-    // Call from Master to do message loop work
+    // Call from Master to do message loop work. With external message pump, only scheduled work is done
     void DoMessageLoopWork();
 
+    // Whether external message pump is used. Requires setup and CEF branch which supports it
+    static bool UsesExternalMessagePump()
+    {
+#ifdef CEF_EXTERNAL_MESSAGE_PUMP_AVAILABLE
+        return setup::EXTERNAL_MESSAGE_PUMP;
+#else
+        return false;
+#endif
+    }
+
+    // Called by CEF from any thread when message loop work should be done after given delay
+    void ScheduleMessagePumpWork(int64 delayMs);
+
+    // Measurement of latency between emulated input and next paint. Paint reports time spent in it, in seconds
+    void OnInputSent();
+    void OnPaintDone(float paintTime);
+
+    // Get time spent in painting since last call, in seconds
+    float TakePaintTime();
+
+    // Called by Master at begin of each frame. Uploads paints which have been kept back
+    void BeginFrame(float tpf);
+
+    // Text with counts of paints and uploads for debug view
+    std::string GetPaintReport() const;
+
+    // Counts of received paints, uploads and paints replaced before upload since start
+    void GetPaintCounts(unsigned int& rPaintCount, unsigned int& rUploadCount, unsigned int& rSkippedCount) const;
+
     // Emulation of left mouse button press and release in specific Tab
     void EmulateMouseCursor(TabCEFInterface* pTab, double x, double y, bool leftButtonPressed); // leftButtonPressed seems necessary
 																								// between mouse button down and up during text selection
@@ -77,6 +132,12 @@ public:
 
     void ResetScrolling(TabCEFInterface* pTab);
 
+    // Scroll main frame to given offset, e.g. after tab has been restored from hibernation
+    void RestoreScrolling(TabCEFInterface* pTab, double x, double y);
+
+    // Get URLs of pages before current one in navigation history of tab, oldest first. Returns whether browser exists
+    bool GetBackHistory(TabCEFInterface* pTab, std::vector<std::string>& rURLs);
+
     // Sets Tab's URL attribute, called by Handler when main frame starts loading a page
     void SetURL(CefRefPtr<CefBrowser> browser);
 
@@ -91,12 +152,11 @@ public:
     // Called by Handler OnLoadStart
     double GetZoomLevel(CefRefPtr<CefBrowser> browser);
 
-    void ReceivePageResolution(CefRefPtr<CefBrowser> browser, CefRefPtr<CefProcessMessage> msg);
+    // Called by MessageRouter when JavaScript pushes changed page size
+    void ReceivePageResolution(CefRefPtr<CefBrowser> browser, double width, double height);
 
-    // Called when Tab realizes that it might reach end of page while scrolling
-    void GetPageResolution(TabCEFInterface* pTab);
-
-    void ReceiveFixedElements(CefRefPtr<CefBrowser> browser, CefRefPtr<CefProcessMessage> msg);
+    // Called by MessageRouter when JavaScript pushes changed rects of fixed element
+    void ReceiveFixedElements(CefRefPtr<CefBrowser> browser, int id, std::vector<Rect> rects);
     void RemoveFixedElement(CefRefPtr<CefBrowser> browser, int id);
 
     // Called by master, only. Quite similar to a update method
@@ -169,6 +229,7 @@ public:
 protected:
 
     // Members
+    CefRefPtr<Renderer> _renderer;
     CefRefPtr<Handler> _handler;
 	CefRefPtr<DevToolsHandler> _devToolsHandler;
 
@@ -183,6 +244,17 @@ protected:
 	// Simple internal clipboard
 	std::string _clipboard = "";
 
+	// Time when scheduled message loop work is due. Guarded by mutex since CEF schedules from any thread
+	std::chrono::steady_clock::time_point _messagePumpDueTime = std::chrono::steady_clock::now();
+	std::mutex _messagePumpMutex;
+
+	// Time of first emulated input which has not been painted, yet
+	std::chrono::steady_clock::time_point _inputSentTime;
+	bool _inputPending = false;
+
+	// Time spent in painting since last call of TakePaintTime
+	float _paintTime = 0.f;
+
     // Use these methods for less coding overhead by checking if key exists in map
     TabCEFInterface* GetTab(CefRefPtr<CefBrowser> browser) const;
     CefRefPtr<CefBrowser> GetBrowser(TabCEFInterface* pTab) const;
@@ -8,6 +8,8 @@
 #include "src/Utils/Logger.h"
 #include "src/CEF/Data/DOMNode.h"
 #include "src/CEF/Data/DOMExtraction.h"
+#include "src/Singletons/JSMailer.h"
+#include "src/Singletons/IPCCounter.h"
 #include <cstdlib>
 #include <algorithm>
 
@@ -49,6 +51,7 @@ bool DefaultMsgHandler::OnQuery(CefRefPtr<CefBrowser> browser,
 
 		// Tell renderer to read out favicon image's bytes
 		CefRefPtr<CefProcessMessage> msg = CefProcessMessage::Create("GetFavIconBytes");
+		IPCCounter::instance().CountSent();
 		browser->SendProcessMessage(PID_RENDERER, msg);
 
 		// Success!
@@ -56,6 +59,24 @@ bool DefaultMsgHandler::OnQuery(CefRefPtr<CefBrowser> browser,
 		return true;
 	}
 
+	// ###############
+	// ### Logging ###
+	// ###############
+
+	// Logging mediator of page registered or unregistered its log function
+	if (requestString == "logging:subscribe")
+	{
+		JSMailer::instance().Subscribe(browser->GetIdentifier());
+		callback->Success("success");
+		return true;
+	}
+	if (requestString == "logging:unsubscribe")
+	{
+		JSMailer::instance().Unsubscribe(browser->GetIdentifier());
+		callback->Success("success");
+		return true;
+	}
+
 	// ######################
 	// ### Text Selection ###
 	// ######################
@@ -107,12 +128,25 @@ bool DefaultMsgHandler::OnQuery(CefRefPtr<CefBrowser> browser,
 				callback->Success("success");
 				return true;
 			}
-			if (op.compare("add") == 0) // adding fixed element
+			if (op.compare("upd") == 0) // updated rects of fixed elements, pairs of id and rect coordinates
 			{
-				// Tell RenderProcessHandler to read out bounding rectangle coordinates belonging to the given ID
-				CefRefPtr<CefProcessMessage> msg = CefProcessMessage::Create("FetchFixedElements");
-				msg->GetArgumentList()->SetInt(0, atoi(id.c_str()));
-				browser->SendProcessMessage(PID_RENDERER, msg);
+				for (int i = 2; i + 1 < (int)data.size(); i += 2)
+				{
+					// Rects are given as t;l;b;r;t;l;b;r
+					std::vector<std::string> values = SplitBySeparator(data[i + 1], ';');
+					std::vector<Rect> rects;
+					for (int j = 0; j + 3 < (int)values.size(); j += 4)
+					{
+						rects.push_back(Rect(
+							StringToFloat(values[j]),
+							StringToFloat(values[j + 1]),
+							StringToFloat(values[j + 2]),
+							StringToFloat(values[j + 3])));
+					}
+
+					// Notify Tab via Mediator about rects of fixed element
+					_pMediator->ReceiveFixedElements(browser, atoi(data[i].c_str()), rects);
+				}
 
 				// Success!
 				callback->Success("success");
@@ -128,6 +162,27 @@ bool DefaultMsgHandler::OnQuery(CefRefPtr<CefBrowser> browser,
 		}
 	}
 
+	// #################
+	// ### Page Size ###
+	// #################
+
+	// Page size pushed by JavaScript whenever it changes: #pageSize#width#height#
+	if (requestString.compare(0, 10, "#pageSize#") == 0)
+	{
+		std::vector<std::string> data = SplitBySeparator(requestString, '#');
+		if (data.size() > 2)
+		{
+			_pMediator->ReceivePageResolution(browser, StringToFloat(data[1]), StringToFloat(data[2]));
+			callback->Success("success");
+		}
+		else
+		{
+			LogDebug("MsgRouter: Expected more arguments for page size. Aborting.");
+			callback->Failure(-1, "not enough arguments");
+		}
+		return true;
+	}
+
 	// ################
 	// ### DOM Node ###
 	// ################
@@ -192,6 +247,7 @@ bool DefaultMsgHandler::OnQuery(CefRefPtr<CefBrowser> browser,
 				CefRefPtr<CefProcessMessage> msg = CefProcessMessage::Create("LoadDOM" + ipcName + "Data");
 				msg->GetArgumentList()->SetInt(0, type);
 				msg->GetArgumentList()->SetInt(1, id);
+				IPCCounter::instance().CountSent();
 				browser->SendProcessMessage(PID_RENDERER, msg);
 			}
 
@@ -135,7 +135,8 @@ bool RenderProcessHandler::OnProcessMessageReceived(
 
 	if (msgName == "SendToLoggingMediator")
 	{
-		CefRefPtr<CefV8Value> log = CefV8Value::CreateString(msg->GetArgumentList()->GetString(0));
+		// Batch of log messages
+		CefRefPtr<CefListValue> messages = msg->GetArgumentList()->GetList(0);
 
 		CefRefPtr<CefV8Context> context = browser->GetMainFrame()->GetV8Context();
 		if (context->Enter())
@@ -144,7 +145,12 @@ bool RenderProcessHandler::OnProcessMessageReceived(
 			CefRefPtr<CefV8Value> logMediator = window->GetValue("loggingMediator");
 			if (logMediator->IsObject())
 			{
-				logMediator->GetValue("log")->ExecuteFunction(logMediator, { log });
+				CefRefPtr<CefV8Value> logFunction = logMediator->GetValue("log");
+				for (int i = 0; i < (int)messages->GetSize(); i++)
+				{
+					CefRefPtr<CefV8Value> log = CefV8Value::CreateString(messages->GetString(i));
+					logFunction->ExecuteFunction(logMediator, { log });
+				}
 			}
 
 			context->Exit();
@@ -223,111 +229,6 @@ bool RenderProcessHandler::OnProcessMessageReceived(
 
     }
 
-    if (msgName == "GetPageResolution")
-    {
-        CefRefPtr<CefV8Context> context = browser->GetMainFrame()->GetV8Context();
-
-        if (context->Enter())
-        {
-            CefRefPtr<CefV8Value> global = context->GetGlobal();
-
-			if (global->GetValue("_pageWidth")->IsDouble() && global->GetValue("_pageHeight")->IsDouble())
-			{
-				double pageWidth = global->GetValue("_pageWidth")->GetDoubleValue();
-				double pageHeight = global->GetValue("_pageHeight")->GetDoubleValue();
-
-				msg = CefProcessMessage::Create("ReceivePageResolution");
-				msg->GetArgumentList()->SetDouble(0, pageWidth);
-				msg->GetArgumentList()->SetDouble(1, pageHeight);
-				browser->SendProcessMessage(PID_BROWSER, msg);
-			}
-			else
-			{
-				IPCLogDebug(browser, "Failed to read page width and/or height, expected double value, got something different. Aborting.");
-			}
-            
-            context->Exit();
-        }
-        return true;
-    }
-
-    // EXPERIMENTAL: Handle request of fixed elements' coordinates
-    if (msgName == "FetchFixedElements")
-    {
-		
-
-        CefRefPtr<CefV8Context> context = browser->GetMainFrame()->GetV8Context();
-
-        if (context->Enter())
-        {
-			int fixedId = msg->GetArgumentList()->GetInt(0);
-
-			// Create response
-			msg = CefProcessMessage::Create("ReceiveFixedElements");
-			CefRefPtr<CefListValue> args = msg->GetArgumentList();
-
-			CefRefPtr<CefV8Value> global = context->GetGlobal();
-			
-
-			CefRefPtr<CefV8Value> fixedObj;
-			if (global->HasValue("domFixedElements") && fixedId < global->GetValue("domFixedElements")->GetArrayLength())
-			{
-				
-				fixedObj = global->GetValue("domFixedElements")->GetValue(fixedId);
-
-				// Slots in domFixedElements might contain undefined as value, if FixedElement was deleted
-				if (fixedObj->IsUndefined() || fixedObj->IsNull())
-				{
-					//IPCLogDebug(browser, "Prevented access to already deleted fixed element at id=" + std::to_string(fixedId));
-					context->Exit();
-					return true;
-				}
-			}
-			else
-			{
-				IPCLogDebug(browser, "List of fixed elements 'domFixedElements' does not seem to exist yet. Aborting fetching them.");
-				context->Exit();
-				return true;
-			}
-		
-			int index = 0;
-			args->SetInt(index++, fixedId);
-
-			// Get V8 list of floats, representing all Rect coordinates of the given fixedObj
-			CefRefPtr<CefV8Value> rectList = fixedObj->GetValue("getRects")->ExecuteFunction(fixedObj, {});
-
-			if (rectList->IsUndefined() || rectList->IsNull() || rectList->GetArrayLength() == 0)
-			{
-				//IPCLogDebug(browser, "Fixed element's rects not available. Aborting...");
-				// Abort
-				context->Exit();
-				return true;
-			}
-
-			for (int i = 0; i < rectList->GetArrayLength(); i++)
-			{
-				CefRefPtr<CefV8Value> rect = rectList->GetValue(i);
-				if (rect->IsUndefined() || rect->IsNull())
-					break;
-
-				// Assuming each rect consist of exactly 4 double values
-				for (int j = 0; j < rect->GetArrayLength(); j++)
-				{
-					// Access rect #i in rectList and j-th coordinate vale [t, l, b, r]
-					args->SetDouble(index++, rect->GetValue(j)->GetDoubleValue());
-				}
-
-			}
-
-			
-			// Send response
-			browser->SendProcessMessage(PID_BROWSER, msg);
-
-        	context->Exit();
-			return true;
-        }
-    }
-
 	if (msgName == "FetchDOMTextLink" || msgName == "FetchDOMTextInput")
 	{
 		IPCLogDebug(browser, "Received deprecated "+msgName+" message!");
@@ -437,19 +338,9 @@ void RenderProcessHandler::OnContextCreated(
             globalObj->SetValue("favIconHeight", CefV8Value::CreateInt(-1), V8_PROPERTY_ATTRIBUTE_NONE);
             globalObj->SetValue("favIconWidth", CefV8Value::CreateInt(-1), V8_PROPERTY_ATTRIBUTE_NONE);
 
-			// Create an image object, which will later contain favicon image 
-            frame->ExecuteJavaScript(_js_favicon_create_img, frame->GetURL(), 0);
-
-			// Inject Javascript code which extends the current page's context by our methods
-			// and automatically creates a MutationObserver instance
-			frame->ExecuteJavaScript(_js_dom_mutationobserver, "", 0);
-			frame->ExecuteJavaScript(_js_mutation_observer_test, "", 0);
-
-			IPCLog(browser, "LOADING FIXED ELEMENT JS FILE OVER AND OVER AGAIN");
-			_js_dom_fixed_elements = GetJSCode(DOM_FIXED_ELEMENTS);
-			frame->ExecuteJavaScript(_js_dom_fixed_elements, "", 0);
-
-
+			// Inject bootstrap, which creates an image object for the favicon, extends the current
+			// page's context by our methods and automatically creates MutationObserver instances
+			frame->ExecuteJavaScript(_js_bootstrap, JS_BOOTSTRAP_URL, 0);
 
             context->Exit();
         }
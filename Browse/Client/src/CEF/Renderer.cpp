@@ -8,7 +8,14 @@
 #include "src/CEF/Mediator.h"
 #include "src/Utils/Texture.h"
 #include "src/Utils/Logger.h"
+#include "src/Singletons/FrameProfiler.h"
+#include "src/Global.h"
+#include "src/Setup.h"
+#include "src/Utils/glmWrapper.h"
 #include "include/wrapper/cef_helpers.h"
+#include <cmath>
+#include <chrono>
+#include <cstring>
 
 Renderer::Renderer(Mediator* pMediator)
 {
@@ -27,6 +34,16 @@ bool Renderer::GetViewRect(CefRefPtr<CefBrowser> browser, CefRect &rect)
     return true;
 }
 
+bool Renderer::GetScreenInfo(CefRefPtr<CefBrowser> browser, CefScreenInfo& screen_info)
+{
+    CefRect rect;
+    GetViewRect(browser, rect);
+    screen_info.device_scale_factor = _mediator->GetDeviceScaleFactor(browser);
+    screen_info.rect = rect;
+    screen_info.available_rect = rect;
+    return true;
+}
+
 void Renderer::OnPaint(
     CefRefPtr<CefBrowser> browser,
     PaintElementType type,
@@ -35,33 +52,137 @@ void Renderer::OnPaint(
     int width,
     int height)
 {
-    // Look up corresponding texture
-    if (auto spTexture = _mediator->GetTexture(browser).lock())
-    {
-        // Fill texture with rendered website
-        spTexture->Fill(width, height, GL_BGRA, (const unsigned char*) buffer);
-
+    ProfilerScope profilerScope("Renderer::OnPaint", true);
+    auto paintStart = std::chrono::steady_clock::now();
 
-		// TESTING
-		//if (dirtyRects.size() > 0)
-		//	LogDebug("*** Dirty rects: ***");
-
-		//for (const auto& rect : dirtyRects)
-		//{
-		//	LogDebug(rect.width, " x ", rect.height, " - ", rect.x, ", ", rect.y);
-
-		//	spTexture->drawRectangle(rect.width, rect.height, rect.x, rect.y);
-		//}
+    // Rendering with device scale factor of zooming is larger than one in render scale. Only zoomed region is kept
+    int resolutionWidth = 0, resolutionHeight = 0;
+    _mediator->GetResolution(browser, resolutionWidth, resolutionHeight);
+    int renderWidth = (int)std::ceil(resolutionWidth * _mediator->GetRenderScale(browser));
+    if (type == PET_VIEW && resolutionWidth > 0 && width > renderWidth)
+    {
+        _mediator->FillZoomTexture(browser, width, height, (const unsigned char*) buffer);
+        _mediator->OnPaintDone(std::chrono::duration<float>(std::chrono::steady_clock::now() - paintStart).count());
+        return;
+    }
 
+    // Upload paint of active browser at most once per interval of frames. Other paints are kept until they may
+    // be uploaded, replacing older ones. Background browsers are only uploaded in long interval
+    _paintCount++;
+    const int browserId = browser->GetIdentifier();
+    KeptPaint& rKeptPaint = _keptPaints[browserId];
+    const bool active = (_activeBrowserId < 0 || browserId == _activeBrowserId);
+    const double scrollingOffsetY = _scrollingOffsetsY[browserId];
+    if (active && (rKeptPaint.uploadFrame == 0 || rKeptPaint.uploadFrame + _uploadInterval <= _frame))
+    {
+        Upload(browser, (const unsigned char*) buffer, width, height, scrollingOffsetY);
+        rKeptPaint.pending = false;
+        rKeptPaint.uploadFrame = _frame;
+        rKeptPaint.timeSinceUpload = 0.f;
     }
     else
     {
-        LogDebug("Renderer: OnPaint couldn't fill texture...");
+        if (rKeptPaint.pending) { _skippedCount++; }
+        rKeptPaint.browser = browser;
+        rKeptPaint.pixels.resize((size_t)width * (size_t)height * 4);
+        std::memcpy(rKeptPaint.pixels.data(), buffer, rKeptPaint.pixels.size());
+        rKeptPaint.width = width;
+        rKeptPaint.height = height;
+        rKeptPaint.scrollingOffsetY = scrollingOffsetY;
+        rKeptPaint.pending = true;
     }
+
+    _mediator->OnPaintDone(std::chrono::duration<float>(std::chrono::steady_clock::now() - paintStart).count());
 }
 
 void Renderer::OnScrollOffsetChanged(CefRefPtr<CefBrowser> browser, double x, double y)
 {
+    // CEF reports offset of compositor frame before painting it, so remember it for next paints
+    _scrollingOffsetsY[browser->GetIdentifier()] = y;
+
     // Call Mediator to set offset in corresponding Tab
     _mediator->OnScrollOffsetChanged(browser, x, y);
 }
+
+void Renderer::BeginFrame(float tpf, int activeBrowserId)
+{
+    _frame++;
+    _activeBrowserId = activeBrowserId;
+
+    // Adapt interval of uploads to frame time. Changes only after some time, so it does not oscillate
+    _averageFrameTime = glm::mix(_averageFrameTime, tpf, glm::min(1.f, tpf / PAINT_UPLOAD_AVERAGE_TIME));
+    _timeSinceIntervalChange += tpf;
+    if (_timeSinceIntervalChange >= PAINT_UPLOAD_AVERAGE_TIME)
+    {
+        const float target = setup::RENDER_SCALE_TARGET_FRAME_TIME;
+        if (_averageFrameTime > target * PAINT_UPLOAD_SLOW_FRAME_TIME && _uploadInterval < setup::PAINT_UPLOAD_MAX_INTERVAL)
+        {
+            _uploadInterval++;
+            _timeSinceIntervalChange = 0.f;
+        }
+        else if (_averageFrameTime <= target * PAINT_UPLOAD_FAST_FRAME_TIME && _uploadInterval > 1)
+        {
+            _uploadInterval--;
+            _timeSinceIntervalChange = 0.f;
+        }
+    }
+
+    // Upload kept paints which are due
+    for (auto& rIdPaintPair : _keptPaints)
+    {
+        KeptPaint& rKeptPaint = rIdPaintPair.second;
+        rKeptPaint.timeSinceUpload += tpf;
+        if (!rKeptPaint.pending) { continue; }
+        bool due = (rIdPaintPair.first == _activeBrowserId)
+            ? rKeptPaint.uploadFrame + _uploadInterval <= _frame
+            : rKeptPaint.timeSinceUpload >= setup::PAINT_BACKGROUND_UPLOAD_INTERVAL;
+        if (due)
+        {
+            // Deferred upload counts as paint time, like upload within OnPaint does
+            auto uploadStart = std::chrono::steady_clock::now();
+            Upload(rKeptPaint.browser, rKeptPaint.pixels.data(), rKeptPaint.width, rKeptPaint.height, rKeptPaint.scrollingOffsetY);
+            _mediator->OnPaintDone(std::chrono::duration<float>(std::chrono::steady_clock::now() - uploadStart).count());
+            rKeptPaint.pending = false;
+            rKeptPaint.uploadFrame = _frame;
+            rKeptPaint.timeSinceUpload = 0.f;
+
+            // Release pixels of background browsers, only active one reuses its buffer in next frames
+            if (rIdPaintPair.first != _activeBrowserId)
+            {
+                std::vector<unsigned char>().swap(rKeptPaint.pixels);
+                rKeptPaint.browser = nullptr;
+            }
+        }
+    }
+}
+
+void Renderer::ForgetBrowser(int browserId)
+{
+    _keptPaints.erase(browserId);
+    _scrollingOffsetsY.erase(browserId);
+}
+
+std::string Renderer::GetReport() const
+{
+    return
+        "received: " + std::to_string(_paintCount) + "\n"
+        + "uploaded: " + std::to_string(_uploadCount) + "\n"
+        + "skipped: " + std::to_string(_skippedCount) + "\n"
+        + "interval: " + std::to_string(_uploadInterval) + "\n";
+}
+
+void Renderer::Upload(CefRefPtr<CefBrowser> browser, const unsigned char* pPixels, int width, int height, double scrollingOffsetY)
+{
+    // Look up corresponding texture
+    if (auto spTexture = _mediator->GetTexture(browser).lock())
+    {
+        // Fill texture with rendered website
+        spTexture->Fill(width, height, GL_BGRA, pPixels);
+        _mediator->OnTextureUploaded(browser, scrollingOffsetY);
+        _uploadCount++;
+    }
+    else
+    {
+        LogDebug("Renderer: OnPaint couldn't fill texture...");
+    }
+}
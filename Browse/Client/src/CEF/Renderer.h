@@ -11,6 +11,9 @@
 
 #include "include/cef_client.h"
 #include "include/cef_render_handler.h"
+#include <map>
+#include <vector>
+#include <string>
 
 // Forward declaration
 class Texture;
@@ -27,6 +30,9 @@ public:
     // Called by CEF to determine render size
     bool GetViewRect(CefRefPtr<CefBrowser> browser, CefRect &rect) OVERRIDE;
 
+    // Called by CEF to determine device scale factor, which is raised for zooming in high resolution
+    bool GetScreenInfo(CefRefPtr<CefBrowser> browser, CefScreenInfo& screen_info) OVERRIDE;
+
     // Called when paint happens, copy pixels over RAM to texture
     void OnPaint(
         CefRefPtr<CefBrowser> browser,
@@ -39,11 +45,62 @@ public:
     // Called when scrolling offset changes
     void OnScrollOffsetChanged(CefRefPtr<CefBrowser> browser, double x, double y) OVERRIDE;
 
+    // Called by Mediator once per frame of Master with browser of active tab (-1 if none).
+    // Uploads kept paints and adapts interval of uploads to frame time
+    void BeginFrame(float tpf, int activeBrowserId);
+
+    // Forget kept paint of closed browser
+    void ForgetBrowser(int browserId);
+
+    // Text with counts of paints and uploads for debug view
+    std::string GetReport() const;
+
+    // Counts of received paints, uploads and paints replaced before upload since start
+    unsigned int GetPaintCount() const { return _paintCount; }
+    unsigned int GetUploadCount() const { return _uploadCount; }
+    unsigned int GetSkippedCount() const { return _skippedCount; }
+
 private:
 
+    // Paint which is kept until it may be uploaded
+    struct KeptPaint
+    {
+        CefRefPtr<CefBrowser> browser;
+        std::vector<unsigned char> pixels;
+        int width = 0;
+        int height = 0;
+        double scrollingOffsetY = 0; // scrolling offset the paint has been rendered with
+        bool pending = false;
+        unsigned int uploadFrame = 0; // frame of last upload
+        float timeSinceUpload = 0.f;
+    };
+
+    // Fill texture of browser with pixels and tell scrolling offset they have been rendered with
+    void Upload(CefRefPtr<CefBrowser> browser, const unsigned char* pPixels, int width, int height, double scrollingOffsetY);
+
     // Members
     Mediator* _mediator;
 
+    // Paints which have not been uploaded, yet. Mapped by browser id
+    std::map<int, KeptPaint> _keptPaints;
+
+    // Latest scrolling offset reported by CEF, which subsequent paints are rendered with. Mapped by browser id
+    std::map<int, double> _scrollingOffsetsY;
+
+    // Current frame and browser of active tab
+    unsigned int _frame = 1;
+    int _activeBrowserId = -1;
+
+    // Frames between uploads of active browser, raised when frames are late
+    unsigned int _uploadInterval = 1;
+    float _averageFrameTime = 0.f;
+    float _timeSinceIntervalChange = 0.f;
+
+    // Counts of received paints, uploads and paints replaced before upload
+    unsigned int _paintCount = 0;
+    unsigned int _uploadCount = 0;
+    unsigned int _skippedCount = 0;
+
     // Include CEF'S default reference counting implementation
     IMPLEMENT_REFCOUNTING(Renderer);
 };
@@ -21,15 +21,33 @@ static const std::string BLANK_PAGE_URL = "about:blank";
 static const int SLOTS_PER_TAB_OVERVIEW_PAGE = 5;
 static const int WEB_TAB_OVERVIEW_MINI_PREVIEW_MIP_MAP_LEVEL = 3;
 static const int WEB_TAB_OVERVIEW_PREVIEW_MIP_MAP_LEVEL = 0;
+static const glm::vec4 WEB_TAB_PREVIEW_COLOR = glm::vec4(96.f / 255.f, 125.f / 255.f, 139.f / 255.f, 1.f);
+static const glm::vec4 WEB_TAB_PREVIEW_CURRENT_COLOR = glm::vec4(80.f / 255.f, 186.f / 255.f, 166.f / 255.f, 1.f);
 static const glm::vec4 TAB_DEFAULT_COLOR_ACCENT = glm::vec4(96.f / 255.f, 125.f / 255.f, 139.f / 255.f, 1.f);
 static const int TAB_ACCENT_COLOR_SAMPLING_POINTS = 100;
 static const float TAB_SCROLLING_SENSOR_WIDTH = 0.2f;
 static const float TAB_SCROLLING_SENSOR_HEIGHT = 0.1f;
 static const float TAB_SCROLLING_SENSOR_PADDING = 0.025f;
 static const float TAB_LOADING_ICON_FRAME_DURATION = 0.25f;
-static const float TAB_GET_PAGE_RES_INTERVAL = 1.0f;
 static const int TAB_DEBUGGING_GAZE_COUNT = 10;
+static const int TAB_HIBERNATION_SNAPSHOT_MIP_MAP_LEVEL = 2;
+static const float TAB_LIFECYCLE_CHECK_INTERVAL = 2.0f;
+static const float RENDER_SCALE_HOLD_TIME = 2.f; // seconds a condition must hold until render scale is changed
+static const float RENDER_SCALE_AVERAGE_TIME = 0.5f; // seconds of smoothing of frame and paint time
+static const float RENDER_SCALE_DECREASE_FRAME_TIME = 1.25f; // relative to target, frame time from which on scale is decreased
+static const float RENDER_SCALE_DECREASE_PAINT_SHARE = 0.2f; // share of paint time in frame time from which on scale is decreased
+static const float RENDER_SCALE_INCREASE_FRAME_TIME = 1.05f; // relative to target, frame time up to which scale is increased
+static const float RENDER_SCALE_INCREASE_PAINT_SHARE = 0.1f; // share of predicted paint time in target up to which scale is increased
+static const float PAINT_UPLOAD_AVERAGE_TIME = 0.5f; // seconds of smoothing of frame time and minimal time between changes of upload interval
+static const float PAINT_UPLOAD_SLOW_FRAME_TIME = 1.25f; // relative to target, frame time from which on upload interval is raised
+static const float PAINT_UPLOAD_FAST_FRAME_TIME = 1.05f; // relative to target, frame time up to which upload interval is lowered
+static const int WEB_VIEW_MAX_FIXED_RECTS = 16; // rects of fixed elements excluded from scrolling shift
+static const unsigned int TAB_ESTIMATED_RENDERER_MEMORY_MB = 80; // renderer process memory cannot be queried from CEF
+static const int SESSION_THUMBNAIL_MIP_MAP_LEVEL = 3;
+static const unsigned int SESSION_MAX_BACK_URLS = 20; // back history entries stored per tab
 static const float MASTER_PAUSE_ALPHA = 0.35f;
+static const int CEF_MESSAGE_PUMP_TIME_SLICE_MS = 8; // maximal time spent in scheduled message loop work per call
+static const int CEF_MESSAGE_PUMP_MAX_DELAY_MS = 1000 / 30; // message loop work is done at least that often
 static const float EYEINPUT_MOUSE_OVERRIDE_INIT_FRAME_DURATION = 0.25f; // duration between mouse movement is expected. Triggered by initial movement
 static const float EYEINPUT_MOUSE_OVERRIDE_INIT_DISTANCE = 100.f; // pixels on screen (not best but works)
 static const float EYEINPUT_MOUSE_OVERRIDE_STOP_DURATION = 3.f; // duration until override is stopped when no mouse movement done
@@ -47,6 +65,7 @@ static const float BLUR_PERIPHERY_MULTIPLIER = 0.7f;
 static const std::string BOOKMARKS_FILE = "bookmarks.xml";
 static const std::string HISTORY_FILE = "history.xml";
 static const std::string SETTINGS_FILE = "settings.xml";
+static const std::string SESSION_FILE = "session.bin";
 static const int URL_INPUT_BOOKMARKS_ROWS_ON_SCREEN = 6;
 static const int HISTORY_ROWS_ON_SCREEN = 6;
 static const int HISTORY_DISPLAY_COUNT = 20;
@@ -56,6 +75,23 @@ static const float NOTIFICATION_HEIGHT = 0.06f;
 static const float NOTIFICATION_DISPLAY_DURATION = 5.f;
 static const float CLICK_VISUALIZATION_DURATION = 0.75f;
 static const float CLICK_VISUALIZATION_RELATIVE_SIZE = 0.4f;
+static const std::string FRAME_PROFILER_TRACE_FILE = "frame_trace.json";
+static const int FRAME_PROFILER_MAX_EVENTS = 200000; // oldest events are dropped from trace
+static const double FRAME_PROFILER_AVERAGE_WEIGHT = 0.05; // weight of new sample in rolling average
+static const double FRAME_PROFILER_MAX_DECAY = 0.99; // per frame decay of displayed maximum
+static const double WORKER_POOL_AVERAGE_WEIGHT = 0.05; // weight of new sample in rolling average of waiting time
+static const double LAB_STREAM_RESOLVE_INTERVAL = 1.0; // seconds between look ups of input stream found by resolver
+static const float GAZE_TRACE_REPLAY_TIMESTEP = 1.f / 60.f; // fixed time per frame while replaying, in seconds
+static const std::string GAZE_TRACE_REPLAY_REPORT_FILE = "replay_report.txt";
+static const std::string BENCHMARK_SUITE_FILE = "suite.txt"; // in suite directory, lists one page file per line
+static const std::string BENCHMARK_REPORT_FILE = "benchmark_report.json";
+static const std::string BENCHMARK_SCRIPTED_TRACE_FILE = "benchmark_script.gtwt"; // used for pages without own gaze trace
+static const std::string BENCHMARK_PAGE_TRACE_EXTENSION = ".gtwt"; // appended to page file to look for recorded gaze trace
+static const float BENCHMARK_SETTLE_TIME = 1.f; // seconds page must not be loading before measurement starts
+static const float BENCHMARK_LOAD_TIMEOUT = 30.f; // seconds until measurement starts even if page is still loading
+static const float BENCHMARK_SCRIPT_DURATION = 20.f; // seconds of scripted gaze path
+static const float BENCHMARK_SCRIPT_FIXATION_DURATION = 0.25f; // seconds per fixation while reading
+static const int BENCHMARK_SCRIPT_SAMPLES_PER_FRAME = 2; // gaze samples per frame of scripted gaze path
 static const std::string SEARCH_PREFIX = "duckduckgo.com?q="; // TODO: move to some kind of config or let the user choose
 
 #endif // GLOBAL_H_
@@ -11,6 +11,9 @@
 
 EyeInput::EyeInput(MasterThreadsafeInterface* _pMasterThreadsafeInterface)
 {
+	// Create filter
+	SetFilterType(static_cast<FilterType>(setup::FILTER_TYPE));
+
 	// Create thread for connection to eye tracker
 	_upConnectionThread = std::unique_ptr<std::thread>(new std::thread([this, _pMasterThreadsafeInterface]()
 	{
@@ -171,19 +174,67 @@ bool EyeInput::Update(
 	double filteredGazeY = 0;
 	bool saccade = false;
 
-	// Bool whether eye tracker is tracking
+	// Bool whether eye tracker is connected and tracking
+	bool isConnected = _connected;
 	bool isTracking = false;
 
-#ifdef _WIN32
+	// Samples of this update
+	SampleQueue upSamples;
 
-	if (_connected && _procFetchGazeSamples != NULL && _procIsTracking != NULL)
+	if (_upTraceReader)
+	{
+		// Replay recorded input instead of live one
+		_replayFinished = _replayFinished || !_upTraceReader->Read(_replayFrame);
+		if (!_replayFinished)
+		{
+			mouseX = _replayFrame.mouseX;
+			mouseY = _replayFrame.mouseY;
+			windowX = _replayFrame.windowX;
+			windowY = _replayFrame.windowY;
+			windowWidth = _replayFrame.windowWidth;
+			windowHeight = _replayFrame.windowHeight;
+			isConnected = _replayFrame.tracking;
+			isTracking = _replayFrame.tracking;
+			if (isTracking)
+			{
+				upSamples = SampleQueue(new std::deque<SampleData>(_replayFrame.samples.begin(), _replayFrame.samples.end()));
+			}
+		}
+	}
+#ifdef _WIN32
+	else if (_connected && _procFetchGazeSamples != NULL && _procIsTracking != NULL)
 	{
-		// Prepare queue to fill
-		SampleQueue upSamples;
-
 		// Fetch k or less valid samples
 		_procFetchGazeSamples(upSamples); // unique pointered vector is filled by fetch procedure
 
+		// Check, whether eye tracker is tracking
+		isTracking = _procIsTracking();
+	}
+#endif
+
+	// Record input of this update
+	if (_upTraceWriter)
+	{
+		GazeTraceFrame frame;
+		frame.tpf = tpf;
+		frame.mouseX = mouseX;
+		frame.mouseY = mouseY;
+		frame.windowX = windowX;
+		frame.windowY = windowY;
+		frame.windowWidth = windowWidth;
+		frame.windowHeight = windowHeight;
+		frame.tracking = isConnected && isTracking;
+		if (upSamples)
+		{
+			frame.samples.assign(upSamples->begin(), upSamples->end());
+		}
+		frame.events = std::move(_recordedEvents);
+		_recordedEvents.clear();
+		_upTraceWriter->Write(frame);
+	}
+
+	if (upSamples)
+	{
 		// Convert parameters to double (use same values for all samples,
 		double windowXDouble = (double)windowX;
 		double windowYDouble = (double)windowY;
@@ -205,14 +256,9 @@ bool EyeInput::Update(
 		}
 
 		// Update filter algorithm and provide local variables as reference
-		_filter.Update(std::move(upSamples), filteredGazeX, filteredGazeY, saccade);
-
-		// Check, whether eye tracker is tracking
-		isTracking = _procIsTracking();
+		_upFilter->Update(std::move(upSamples), filteredGazeX, filteredGazeY, saccade);
 	}
 
-#endif
-
 	// ### MOUSE INPUT ###
 
 	// Mouse override of eye tracker
@@ -279,7 +325,7 @@ bool EyeInput::Update(
 
 	// Bool to indicate mouse usage for gaze coordinates
 	bool gazeEmulated =
-		!_connected // eye tracker not connected
+		!isConnected // eye tracker not connected
 		|| _mouseOverride // eye tracker overriden by mouse
 		|| !isTracking; // eye tracker not available
 
@@ -322,4 +368,64 @@ void EyeInput::Calibrate()
 		_procCalibrate();
 	}
 #endif
-}
\ No newline at end of file
+}
+
+void EyeInput::SetFilterType(FilterType type)
+{
+	_filterType = type;
+	_upFilter = CreateFilter(type);
+	LogInfo("EyeInput: Using ", FilterTypeToString(type), " filter.");
+}
+
+bool EyeInput::StartRecording(std::string filepath, int windowWidth, int windowHeight)
+{
+	_upTraceWriter = std::unique_ptr<GazeTraceWriter>(new GazeTraceWriter(filepath, windowWidth, windowHeight));
+	if (!_upTraceWriter->IsOpen())
+	{
+		_upTraceWriter = nullptr;
+		return false;
+	}
+	return true;
+}
+
+void EyeInput::RecordEvent(GazeTraceEvent event)
+{
+	if (_upTraceWriter)
+	{
+		_recordedEvents.push_back(event);
+	}
+}
+
+bool EyeInput::StartReplay(std::string filepath, int& rWindowWidth, int& rWindowHeight)
+{
+	_upTraceReader = std::unique_ptr<GazeTraceReader>(new GazeTraceReader(filepath));
+	if (!_upTraceReader->IsOpen())
+	{
+		_upTraceReader = nullptr;
+		return false;
+	}
+	rWindowWidth = _upTraceReader->GetWindowWidth();
+	rWindowHeight = _upTraceReader->GetWindowHeight();
+	_replayFinished = false;
+
+	// Filter starts over for deterministic results
+	SetFilterType(_filterType);
+	return true;
+}
+
+void EyeInput::StopReplay()
+{
+	_upTraceReader = nullptr;
+	_replayFinished = false;
+	_replayFrame = GazeTraceFrame();
+}
+
+std::vector<GazeTraceEvent> EyeInput::FetchReplayedEvents()
+{
+	std::vector<GazeTraceEvent> events;
+	if (_upTraceReader && !_replayFinished)
+	{
+		events.swap(_replayFrame.events);
+	}
+	return events;
+}
@@ -12,7 +12,8 @@
 #include "src/Global.h"
 #include "src/MasterThreadsafeInterface.h"
 #include "src/Input/EyeTrackerStatus.h"
-#include "src/Input/Filters/SimpleFilter.h"
+#include "src/Input/Filters/Filter.h"
+#include "src/Input/GazeTrace.h"
 #include "plugins/Eyetracker/Interface/EyetrackerSampleData.h"
 #include <memory>
 #include <vector>
@@ -53,6 +54,33 @@ public:
 	// Calibrate the eye tracking device
 	void Calibrate();
 
+	// Replace filter of gaze data. Filtering starts over with new samples
+	void SetFilterType(FilterType type);
+
+	// Get type of current filter
+	FilterType GetFilterType() const { return _filterType; }
+
+	// Record input of each update into gaze trace file. Returns whether file could be opened
+	bool StartRecording(std::string filepath, int windowWidth, int windowHeight);
+
+	// Add event to be recorded with next update
+	void RecordEvent(GazeTraceEvent event);
+
+	// Replay gaze trace file instead of live input. Fills recorded window size. Returns whether file could be opened
+	bool StartReplay(std::string filepath, int& rWindowWidth, int& rWindowHeight);
+
+	// Stop replay and continue with live input
+	void StopReplay();
+
+	// Whether replay is active
+	bool IsReplaying() const { return _upTraceReader != nullptr; }
+
+	// Whether replay reached end of trace
+	bool IsReplayFinished() const { return _replayFinished; }
+
+	// Events replayed by last update, cleared by fetching
+	std::vector<GazeTraceEvent> FetchReplayedEvents();
+
 private:
 
 	// Thread that connects to eye tracking device
@@ -94,7 +122,17 @@ private:
     bool _mouseOverrideInitFrame = false;
 
 	// Filter of gaze data
-	SimpleFilter _filter;
+	FilterType _filterType;
+	std::unique_ptr<Filter> _upFilter;
+
+	// Recording of gaze trace
+	std::unique_ptr<GazeTraceWriter> _upTraceWriter;
+	std::vector<GazeTraceEvent> _recordedEvents;
+
+	// Replay of gaze trace
+	std::unique_ptr<GazeTraceReader> _upTraceReader;
+	GazeTraceFrame _replayFrame;
+	bool _replayFinished = false;
 };
 
 #endif // EYEINPUT_H_
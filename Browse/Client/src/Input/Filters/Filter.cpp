@@ -0,0 +1,66 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+
+#include "Filter.h"
+#include "src/Input/Filters/SimpleFilter.h"
+#include "src/Input/Filters/IVTFilter.h"
+#include "src/Input/Filters/IDTFilter.h"
+#include "src/Input/Filters/OneEuroFilter.h"
+#include "src/Setup.h"
+
+void StreamingFilter::Update(SampleQueue upSamples,
+	double& rGazeX,
+	double& rGazeY,
+	bool& rSaccade)
+{
+	// Process each sample once
+	if (upSamples)
+	{
+		for (const auto& rSample : *upSamples)
+		{
+			if (rSample.valid)
+			{
+				Push(rSample);
+			}
+		}
+	}
+
+	// Fill reference
+	rGazeX = _gazeX;
+	rGazeY = _gazeY;
+	rSaccade = _saccade;
+}
+
+std::unique_ptr<Filter> CreateFilter(FilterType type)
+{
+	const std::chrono::milliseconds window(setup::FILTER_WINDOW_DURATION_MS);
+	switch (type)
+	{
+	case FilterType::IVT:
+		return std::unique_ptr<Filter>(new IVTFilter(window, setup::FILTER_IVT_VELOCITY_THRESHOLD));
+	case FilterType::IDT:
+		return std::unique_ptr<Filter>(new IDTFilter(window, setup::FILTER_IDT_DISPERSION_THRESHOLD));
+	case FilterType::ONE_EURO:
+		return std::unique_ptr<Filter>(new OneEuroFilter(
+			setup::FILTER_ONE_EURO_MIN_CUTOFF,
+			setup::FILTER_ONE_EURO_BETA,
+			setup::FILTER_ONE_EURO_DERIVATE_CUTOFF,
+			setup::FILTER_IVT_VELOCITY_THRESHOLD));
+	default:
+		return std::unique_ptr<Filter>(new SimpleFilter());
+	}
+}
+
+std::string FilterTypeToString(FilterType type)
+{
+	switch (type)
+	{
+	case FilterType::SIMPLE: return "Simple";
+	case FilterType::IVT: return "I-VT";
+	case FilterType::IDT: return "I-DT";
+	case FilterType::ONE_EURO: return "One-Euro";
+	default: return "Unknown";
+	}
+}
@@ -2,24 +2,52 @@
 // Distributed under the Apache License, Version 2.0.
 // Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
 //============================================================================
-// Abstract interface for eye gaze filters.
+// Abstract interface for eye gaze filters. StreamingFilter processes each
+// valid sample exactly once, which makes it independent of frame rate.
 
 #ifndef FILTER_H_
 #define FILTER_H_
 
 #include "plugins/Eyetracker/Interface/EyetrackerSampleData.h"
+#include "src/Input/Filters/FilterType.h"
+#include <memory>
 
 class Filter
 {
 public:
 
+	// Destructor
+	virtual ~Filter() {}
+
 	// Update. Takes samples in window pixel coordinates
 	virtual void Update(SampleQueue upSamples,
 		double& rGazeX,
 		double& rGazeY,
 		bool& rSaccade) = 0;
+};
 
+class StreamingFilter : public Filter
+{
+public:
 
+	// Update. Pushes valid samples one after another and reports result after last one
+	virtual void Update(SampleQueue upSamples,
+		double& rGazeX,
+		double& rGazeY,
+		bool& rSaccade);
+
+protected:
+
+	// Process single sample
+	virtual void Push(const SampleData& rSample) = 0;
+
+	// Current result
+	double _gazeX = 0;
+	double _gazeY = 0;
+	bool _saccade = false;
 };
 
-#endif FILTER_H_
\ No newline at end of file
+// Create filter of given type with parameters from setup
+std::unique_ptr<Filter> CreateFilter(FilterType type);
+
+#endif // FILTER_H_
\ No newline at end of file
@@ -0,0 +1,24 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+// Enumeration of available gaze filters.
+
+#ifndef FILTERTYPE_H_
+#define FILTERTYPE_H_
+
+#include <string>
+
+enum class FilterType
+{
+	SIMPLE, // rescan of fixed count of samples, kept for comparison
+	IVT, // velocity threshold
+	IDT, // dispersion threshold
+	ONE_EURO, // speed adaptive low pass
+	COUNT // only for iteration
+};
+
+// Name of filter type for logging
+std::string FilterTypeToString(FilterType type);
+
+#endif // FILTERTYPE_H_
@@ -0,0 +1,86 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+
+#include "FixationWindow.h"
+#include <algorithm>
+#include <functional>
+
+FixationWindow::FixationWindow(std::chrono::milliseconds duration) : _duration(duration)
+{
+	// Nothing to do
+}
+
+void FixationWindow::Push(const SampleData& rSample)
+{
+	// Add sample
+	_samples.push_back(rSample);
+	_sumX += rSample.x;
+	_sumY += rSample.y;
+	PushExtremum(_minX, rSample.x, std::less<double>());
+	PushExtremum(_maxX, rSample.x, std::greater<double>());
+	PushExtremum(_minY, rSample.y, std::less<double>());
+	PushExtremum(_maxY, rSample.y, std::greater<double>());
+	_nextSequence++;
+
+	// Remove samples which are out of duration
+	while (rSample.timestamp - _samples.front().timestamp > _duration)
+	{
+		PopFront();
+	}
+}
+
+void FixationWindow::Clear()
+{
+	_samples.clear();
+	_minX.clear();
+	_maxX.clear();
+	_minY.clear();
+	_maxY.clear();
+	_sumX = 0;
+	_sumY = 0;
+	_frontSequence = _nextSequence;
+}
+
+double FixationWindow::GetDispersion() const
+{
+	if (_samples.empty()) { return 0; }
+	return (_maxX.front().value - _minX.front().value) + (_maxY.front().value - _minY.front().value);
+}
+
+double FixationWindow::GetDispersion(const SampleData& rSample) const
+{
+	if (_samples.empty()) { return 0; }
+	return (std::max(_maxX.front().value, rSample.x) - std::min(_minX.front().value, rSample.x))
+		+ (std::max(_maxY.front().value, rSample.y) - std::min(_minY.front().value, rSample.y));
+}
+
+template<typename Less>
+void FixationWindow::PushExtremum(std::deque<Extremum>& rQueue, double value, Less less)
+{
+	// Entries which can never be extremum again are removed
+	while (!rQueue.empty() && !less(rQueue.back().value, value))
+	{
+		rQueue.pop_back();
+	}
+	rQueue.push_back({ _nextSequence, value });
+}
+
+void FixationWindow::PopFront()
+{
+	const auto& rSample = _samples.front();
+	_sumX -= rSample.x;
+	_sumY -= rSample.y;
+	_samples.pop_front();
+
+	// Remove extrema which belong to removed sample
+	for (auto pQueue : { &_minX, &_maxX, &_minY, &_maxY })
+	{
+		if (!pQueue->empty() && pQueue->front().sequence == _frontSequence)
+		{
+			pQueue->pop_front();
+		}
+	}
+	_frontSequence++;
+}
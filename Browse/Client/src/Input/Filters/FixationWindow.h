@@ -0,0 +1,69 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+// Window of gaze samples limited by duration. Keeps running sums and
+// monotonic queues, so mean and dispersion are available in constant time
+// and each sample is added and removed exactly once.
+
+#ifndef FIXATIONWINDOW_H_
+#define FIXATIONWINDOW_H_
+
+#include "plugins/Eyetracker/Interface/EyetrackerSampleData.h"
+#include <deque>
+#include <chrono>
+#include <cstdint>
+
+class FixationWindow
+{
+public:
+
+	// Constructor
+	FixationWindow(std::chrono::milliseconds duration);
+
+	// Add sample and remove samples which are older than duration relative to it
+	void Push(const SampleData& rSample);
+
+	// Remove all samples
+	void Clear();
+
+	// Getter
+	bool IsEmpty() const { return _samples.empty(); }
+	int GetCount() const { return (int)_samples.size(); }
+	double GetMeanX() const { return _sumX / (double)_samples.size(); }
+	double GetMeanY() const { return _sumY / (double)_samples.size(); }
+
+	// Dispersion (extent in x plus extent in y) of window. Optionally with additional sample
+	double GetDispersion() const;
+	double GetDispersion(const SampleData& rSample) const;
+
+private:
+
+	// Entry of monotonic queue
+	struct Extremum
+	{
+		uint64_t sequence;
+		double value;
+	};
+
+	// Push value into monotonic queue. Less is comparison which must hold for the front
+	template<typename Less>
+	void PushExtremum(std::deque<Extremum>& rQueue, double value, Less less);
+
+	// Remove oldest sample
+	void PopFront();
+
+	// Members
+	std::chrono::milliseconds _duration;
+	std::deque<SampleData> _samples;
+	uint64_t _frontSequence = 0; // sequence number of oldest sample
+	uint64_t _nextSequence = 0; // sequence number of next sample
+	double _sumX = 0;
+	double _sumY = 0;
+	std::deque<Extremum> _minX;
+	std::deque<Extremum> _maxX;
+	std::deque<Extremum> _minY;
+	std::deque<Extremum> _maxY;
+};
+
+#endif // FIXATIONWINDOW_H_
@@ -0,0 +1,28 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+
+#include "IDTFilter.h"
+
+IDTFilter::IDTFilter(std::chrono::milliseconds window, float dispersionThreshold) :
+	_window(window), _dispersionThreshold(dispersionThreshold)
+{
+	// Nothing to do
+}
+
+void IDTFilter::Push(const SampleData& rSample)
+{
+	// Check whether sample would spread current fixation too much
+	_saccade = _window.GetDispersion(rSample) > _dispersionThreshold;
+	if (_saccade)
+	{
+		// Start new fixation
+		_window.Clear();
+	}
+
+	// Output mean of current fixation
+	_window.Push(rSample);
+	_gazeX = _window.GetMeanX();
+	_gazeY = _window.GetMeanY();
+}
@@ -0,0 +1,36 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+// Dispersion threshold filter (I-DT). Samples are averaged within a window of
+// given duration as long as their dispersion stays below the threshold. A
+// sample exceeding it starts a new fixation.
+
+#ifndef IDTFILTER_H_
+#define IDTFILTER_H_
+
+#include "src/Input/Filters/Filter.h"
+#include "src/Input/Filters/FixationWindow.h"
+
+class IDTFilter : public StreamingFilter
+{
+public:
+
+	// Constructor. Dispersion threshold in pixels
+	IDTFilter(std::chrono::milliseconds window, float dispersionThreshold);
+
+protected:
+
+	// Process single sample
+	virtual void Push(const SampleData& rSample);
+
+private:
+
+	// Window of current fixation
+	FixationWindow _window;
+
+	// Dispersion threshold in pixels
+	float _dispersionThreshold;
+};
+
+#endif // IDTFILTER_H_
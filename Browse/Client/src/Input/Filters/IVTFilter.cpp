@@ -0,0 +1,40 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+
+#include "IVTFilter.h"
+#include <algorithm>
+#include <cmath>
+
+IVTFilter::IVTFilter(std::chrono::milliseconds window, float velocityThreshold) :
+	_window(window), _velocityThreshold(velocityThreshold)
+{
+	// Nothing to do
+}
+
+void IVTFilter::Push(const SampleData& rSample)
+{
+	// Velocity between previous and current sample
+	_saccade = false;
+	if (_hasPrevious)
+	{
+		double deltaSeconds = std::max<long long>((rSample.timestamp - _previousTimestamp).count(), 1) / 1000.0;
+		double distance = std::hypot(rSample.x - _previousX, rSample.y - _previousY);
+		if (distance / deltaSeconds > _velocityThreshold)
+		{
+			// Start new fixation
+			_window.Clear();
+			_saccade = true;
+		}
+	}
+	_previousX = rSample.x;
+	_previousY = rSample.y;
+	_previousTimestamp = rSample.timestamp;
+	_hasPrevious = true;
+
+	// Output mean of current fixation
+	_window.Push(rSample);
+	_gazeX = _window.GetMeanX();
+	_gazeY = _window.GetMeanY();
+}
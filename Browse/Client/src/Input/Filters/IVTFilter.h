@@ -0,0 +1,42 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+// Velocity threshold filter (I-VT). Samples are averaged within a window of
+// given duration as long as the point to point velocity stays below the
+// threshold. Faster movement starts a new fixation.
+
+#ifndef IVTFILTER_H_
+#define IVTFILTER_H_
+
+#include "src/Input/Filters/Filter.h"
+#include "src/Input/Filters/FixationWindow.h"
+
+class IVTFilter : public StreamingFilter
+{
+public:
+
+	// Constructor. Velocity threshold in pixels per second
+	IVTFilter(std::chrono::milliseconds window, float velocityThreshold);
+
+protected:
+
+	// Process single sample
+	virtual void Push(const SampleData& rSample);
+
+private:
+
+	// Window of current fixation
+	FixationWindow _window;
+
+	// Velocity threshold in pixels per second
+	float _velocityThreshold;
+
+	// Previous sample
+	bool _hasPrevious = false;
+	double _previousX = 0;
+	double _previousY = 0;
+	std::chrono::milliseconds _previousTimestamp;
+};
+
+#endif // IVTFILTER_H_
@@ -0,0 +1,49 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+
+#include "OneEuroFilter.h"
+#include <algorithm>
+#include <cmath>
+
+OneEuroFilter::OneEuroFilter(float minCutoff, float beta, float derivateCutoff, float saccadeVelocity) :
+	_minCutoff(minCutoff), _beta(beta), _derivateCutoff(derivateCutoff), _saccadeVelocity(saccadeVelocity)
+{
+	// Nothing to do
+}
+
+void OneEuroFilter::Push(const SampleData& rSample)
+{
+	// First sample initializes filter
+	if (!_initialized)
+	{
+		_gazeX = rSample.x;
+		_gazeY = rSample.y;
+		_previousTimestamp = rSample.timestamp;
+		_initialized = true;
+		return;
+	}
+
+	// Time delta, at least one millisecond since timestamps have that resolution
+	double deltaSeconds = std::max<long long>((rSample.timestamp - _previousTimestamp).count(), 1) / 1000.0;
+	_previousTimestamp = rSample.timestamp;
+
+	// Filter derivate
+	double derivateAlpha = Alpha(_derivateCutoff, deltaSeconds);
+	_derivateX += derivateAlpha * (((rSample.x - _gazeX) / deltaSeconds) - _derivateX);
+	_derivateY += derivateAlpha * (((rSample.y - _gazeY) / deltaSeconds) - _derivateY);
+	double speed = std::hypot(_derivateX, _derivateY);
+
+	// Filter position with speed dependent cutoff
+	double alpha = Alpha(_minCutoff + _beta * speed, deltaSeconds);
+	_gazeX += alpha * (rSample.x - _gazeX);
+	_gazeY += alpha * (rSample.y - _gazeY);
+	_saccade = speed > _saccadeVelocity;
+}
+
+double OneEuroFilter::Alpha(double cutoff, double deltaSeconds)
+{
+	double tau = 1.0 / (2.0 * 3.14159265358979 * cutoff);
+	return 1.0 / (1.0 + tau / deltaSeconds);
+}
@@ -0,0 +1,44 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+// One Euro filter (Casiez et al., CHI 2012). Low pass filter whose cutoff
+// frequency increases with speed, so fixations are smoothed while saccades
+// are followed with little lag.
+
+#ifndef ONEEUROFILTER_H_
+#define ONEEUROFILTER_H_
+
+#include "src/Input/Filters/Filter.h"
+
+class OneEuroFilter : public StreamingFilter
+{
+public:
+
+	// Constructor. Cutoff frequencies in Hertz, saccade velocity in pixels per second
+	OneEuroFilter(float minCutoff, float beta, float derivateCutoff, float saccadeVelocity);
+
+protected:
+
+	// Process single sample
+	virtual void Push(const SampleData& rSample);
+
+private:
+
+	// Smoothing factor for given cutoff frequency and time delta in seconds
+	static double Alpha(double cutoff, double deltaSeconds);
+
+	// Parameters
+	float _minCutoff;
+	float _beta;
+	float _derivateCutoff;
+	float _saccadeVelocity;
+
+	// State
+	bool _initialized = false;
+	std::chrono::milliseconds _previousTimestamp;
+	double _derivateX = 0;
+	double _derivateY = 0;
+};
+
+#endif // ONEEUROFILTER_H_
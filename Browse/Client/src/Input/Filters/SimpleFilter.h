@@ -9,7 +9,7 @@
 
 #include "src/Input/Filters/Filter.h"
 
-class SimpleFilter
+class SimpleFilter : public Filter
 {
 public:
 
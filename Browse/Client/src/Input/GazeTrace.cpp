@@ -0,0 +1,189 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+
+#include "GazeTrace.h"
+#include "src/Utils/Logger.h"
+#include <algorithm>
+#include <cstring>
+
+// Header of file. Values are stored in little endian byte order of writing machine
+static const char GAZE_TRACE_MAGIC[4] = { 'G', 'T', 'W', 'T' };
+static const uint32_t GAZE_TRACE_VERSION = 1;
+
+// Layout of single sample in file
+#pragma pack(push, 1)
+struct GazeTraceSample
+{
+	float x;
+	float y;
+	uint8_t valid;
+	int64_t timestamp; // milliseconds
+};
+
+// Layout of frame header in file, followed by samples and events
+struct GazeTraceFrameHeader
+{
+	float tpf;
+	float mouseX;
+	float mouseY;
+	int32_t windowX;
+	int32_t windowY;
+	int32_t windowWidth;
+	int32_t windowHeight;
+	uint8_t tracking;
+	uint16_t sampleCount;
+	uint16_t eventCount;
+};
+
+// Layout of event in file
+struct GazeTraceFileEvent
+{
+	uint8_t type;
+	int32_t code;
+	int32_t action;
+	int32_t mods;
+};
+#pragma pack(pop)
+
+GazeTraceWriter::GazeTraceWriter(std::string filepath, int windowWidth, int windowHeight)
+{
+	_pFile = std::fopen(filepath.c_str(), "wb");
+	if (_pFile == NULL)
+	{
+		LogError("GazeTraceWriter: Could not open file for writing: ", filepath);
+		return;
+	}
+
+	// Write header
+	int32_t size[2] = { windowWidth, windowHeight };
+	std::fwrite(GAZE_TRACE_MAGIC, sizeof(GAZE_TRACE_MAGIC), 1, _pFile);
+	std::fwrite(&GAZE_TRACE_VERSION, sizeof(GAZE_TRACE_VERSION), 1, _pFile);
+	std::fwrite(size, sizeof(size), 1, _pFile);
+	LogInfo("GazeTraceWriter: Recording to ", filepath);
+}
+
+GazeTraceWriter::~GazeTraceWriter()
+{
+	if (_pFile != NULL)
+	{
+		std::fclose(_pFile);
+	}
+}
+
+void GazeTraceWriter::Write(const GazeTraceFrame& rFrame)
+{
+	if (_pFile == NULL) { return; }
+
+	// Frame header
+	GazeTraceFrameHeader header;
+	header.tpf = rFrame.tpf;
+	header.mouseX = (float)rFrame.mouseX;
+	header.mouseY = (float)rFrame.mouseY;
+	header.windowX = rFrame.windowX;
+	header.windowY = rFrame.windowY;
+	header.windowWidth = rFrame.windowWidth;
+	header.windowHeight = rFrame.windowHeight;
+	header.tracking = rFrame.tracking ? 1 : 0;
+	header.sampleCount = (uint16_t)std::min(rFrame.samples.size(), (size_t)UINT16_MAX);
+	header.eventCount = (uint16_t)std::min(rFrame.events.size(), (size_t)UINT16_MAX);
+	std::fwrite(&header, sizeof(header), 1, _pFile);
+
+	// Samples
+	for (int i = 0; i < header.sampleCount; i++)
+	{
+		const auto& rSample = rFrame.samples[i];
+		GazeTraceSample sample;
+		sample.x = (float)rSample.x;
+		sample.y = (float)rSample.y;
+		sample.valid = rSample.valid ? 1 : 0;
+		sample.timestamp = rSample.timestamp.count();
+		std::fwrite(&sample, sizeof(sample), 1, _pFile);
+	}
+
+	// Events
+	for (int i = 0; i < header.eventCount; i++)
+	{
+		const auto& rEvent = rFrame.events[i];
+		GazeTraceFileEvent event;
+		event.type = (uint8_t)rEvent.type;
+		event.code = rEvent.code;
+		event.action = rEvent.action;
+		event.mods = rEvent.mods;
+		std::fwrite(&event, sizeof(event), 1, _pFile);
+	}
+}
+
+GazeTraceReader::GazeTraceReader(std::string filepath)
+{
+	_pFile = std::fopen(filepath.c_str(), "rb");
+	if (_pFile == NULL)
+	{
+		LogError("GazeTraceReader: Could not open file for reading: ", filepath);
+		return;
+	}
+
+	// Check header
+	char magic[4];
+	uint32_t version = 0;
+	int32_t size[2] = { 0, 0 };
+	if (std::fread(magic, sizeof(magic), 1, _pFile) != 1
+		|| std::memcmp(magic, GAZE_TRACE_MAGIC, sizeof(magic)) != 0
+		|| std::fread(&version, sizeof(version), 1, _pFile) != 1
+		|| version != GAZE_TRACE_VERSION
+		|| std::fread(size, sizeof(size), 1, _pFile) != 1)
+	{
+		LogError("GazeTraceReader: File is no gaze trace of supported version: ", filepath);
+		std::fclose(_pFile);
+		_pFile = NULL;
+		return;
+	}
+	_windowWidth = size[0];
+	_windowHeight = size[1];
+	LogInfo("GazeTraceReader: Replaying ", filepath);
+}
+
+GazeTraceReader::~GazeTraceReader()
+{
+	if (_pFile != NULL)
+	{
+		std::fclose(_pFile);
+	}
+}
+
+bool GazeTraceReader::Read(GazeTraceFrame& rFrame)
+{
+	if (_pFile == NULL) { return false; }
+
+	// Frame header
+	GazeTraceFrameHeader header;
+	if (std::fread(&header, sizeof(header), 1, _pFile) != 1) { return false; }
+	rFrame.tpf = header.tpf;
+	rFrame.mouseX = header.mouseX;
+	rFrame.mouseY = header.mouseY;
+	rFrame.windowX = header.windowX;
+	rFrame.windowY = header.windowY;
+	rFrame.windowWidth = header.windowWidth;
+	rFrame.windowHeight = header.windowHeight;
+	rFrame.tracking = header.tracking != 0;
+
+	// Samples
+	rFrame.samples.clear();
+	for (int i = 0; i < header.sampleCount; i++)
+	{
+		GazeTraceSample sample;
+		if (std::fread(&sample, sizeof(sample), 1, _pFile) != 1) { return false; }
+		rFrame.samples.push_back(SampleData(sample.x, sample.y, sample.valid != 0, std::chrono::milliseconds(sample.timestamp)));
+	}
+
+	// Events
+	rFrame.events.clear();
+	for (int i = 0; i < header.eventCount; i++)
+	{
+		GazeTraceFileEvent event;
+		if (std::fread(&event, sizeof(event), 1, _pFile) != 1) { return false; }
+		rFrame.events.push_back({ (GazeTraceEvent::Type)event.type, event.code, event.action, event.mods });
+	}
+	return true;
+}
@@ -0,0 +1,97 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+// Compact binary log of everything eye input depends on per frame: gaze
+// samples, tracker state, mouse cursor, window geometry and key / mouse button
+// events. Written while recording and read back for deterministic replay.
+
+#ifndef GAZETRACE_H_
+#define GAZETRACE_H_
+
+#include "plugins/Eyetracker/Interface/EyetrackerSampleData.h"
+#include <cstdio>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Input event which happened during frame
+struct GazeTraceEvent
+{
+	enum class Type : uint8_t { KEY, MOUSE_BUTTON };
+	Type type;
+	int32_t code; // GLFW key or mouse button
+	int32_t action;
+	int32_t mods;
+};
+
+// Everything recorded per frame
+struct GazeTraceFrame
+{
+	float tpf = 0; // informative, replay uses fixed timestep
+	double mouseX = 0;
+	double mouseY = 0;
+	int windowX = 0;
+	int windowY = 0;
+	int windowWidth = 0;
+	int windowHeight = 0;
+	bool tracking = false; // eye tracker connected and tracking
+	std::vector<SampleData> samples; // in screen coordinates as delivered by eye tracker
+	std::vector<GazeTraceEvent> events;
+};
+
+// Writes frames to file
+class GazeTraceWriter
+{
+public:
+
+	// Constructor. Check IsOpen afterwards
+	GazeTraceWriter(std::string filepath, int windowWidth, int windowHeight);
+
+	// Destructor, closes file
+	virtual ~GazeTraceWriter();
+
+	// Whether file could be opened
+	bool IsOpen() const { return _pFile != NULL; }
+
+	// Append frame
+	void Write(const GazeTraceFrame& rFrame);
+
+private:
+
+	// File handle
+	FILE* _pFile = NULL;
+};
+
+// Reads frames from file
+class GazeTraceReader
+{
+public:
+
+	// Constructor. Check IsOpen afterwards
+	GazeTraceReader(std::string filepath);
+
+	// Destructor, closes file
+	virtual ~GazeTraceReader();
+
+	// Whether file could be opened and has valid header
+	bool IsOpen() const { return _pFile != NULL; }
+
+	// Window size at begin of recording
+	int GetWindowWidth() const { return _windowWidth; }
+	int GetWindowHeight() const { return _windowHeight; }
+
+	// Read next frame. Returns false at end of trace or on corrupted data
+	bool Read(GazeTraceFrame& rFrame);
+
+private:
+
+	// File handle
+	FILE* _pFile = NULL;
+
+	// Window size from header
+	int _windowWidth = 0;
+	int _windowHeight = 0;
+};
+
+#endif // GAZETRACE_H_
@@ -6,10 +6,13 @@
 #include "Master.h"
 #include "src/Utils/Helper.h"
 #include "src/Utils/Logger.h"
+#include "src/Singletons/IPCCounter.h"
 #include "submodules/glfw/include/GLFW/glfw3.h"
 #include "submodules/text-csv/include/text/csv/ostream.hpp"
 #include <functional>
+#include <algorithm>
 #include <chrono>
+#include <cstdlib>
 #include <ctime>
 #include <sstream>
 #include <iomanip>
@@ -52,48 +55,6 @@ const std::string geometryShaderSource =
 "    EndPrimitive();\n"
 "}\n";
 
-const std::string blurFragmentShaderSource =
-"#version 330 core\n"
-"const float offset = 1.9;\n" // TODO: maybe use resolution here
-"in vec2 uv;\n"
-"out vec4 fragColor;\n"
-"uniform sampler2D tex;\n"
-"uniform vec2 focusPixelPosition;\n"
-"uniform float focusPixelRadius;\n"
-"uniform float peripheryMultiplier;\n"
-"void main() {\n"
-// Preparation
-"   vec4 color = texture(tex, uv);\n"
-"   float mask = min(distance(focusPixelPosition, gl_FragCoord.xy) / focusPixelRadius, 1.0);\n"
-"   vec2 texSize = textureSize(tex, 0);\n"
-"   vec4 blur = vec4(0,0,0,0);\n"
-// x and y not zero
-"   for(int x = 1; x <= 2; x++) {\n"
-"       for(int y = 1; y <= 2; y++) {\n"
-"           blur += texture(tex, (gl_FragCoord.xy + (offset * vec2(x, y))) / texSize);\n"
-"           blur += texture(tex, (gl_FragCoord.xy + (offset * vec2(-x, y))) / texSize);\n"
-"           blur += texture(tex, (gl_FragCoord.xy + (offset * vec2(x, -y))) / texSize);\n"
-"           blur += texture(tex, (gl_FragCoord.xy + (offset * vec2(-x, -y))) / texSize);\n"
-"       }\n"
-"   }\n"
-// x is zero
-"   for(int y = 1; y <= 2; y++) {\n"
-"       blur += texture(tex, (gl_FragCoord.xy + (offset * vec2(0, y))) / texSize);\n"
-"       blur += texture(tex, (gl_FragCoord.xy + (offset * vec2(0, -y))) / texSize);\n"
-"   }\n"
-// y is zero
-"   for(int x = 1; x <= 2; x++) {\n"
-"       blur += texture(tex, (gl_FragCoord.xy + (offset * vec2(x, 0))) / texSize);\n"
-"       blur += texture(tex, (gl_FragCoord.xy + (offset * vec2(-x, 0))) / texSize);\n"
-"   }\n"
-// Both is zero
-"   blur += color;\n"
-// Do composition
-"   blur /= 25;\n"
-"   color = mix(color, peripheryMultiplier * blur, mask);\n"
-"   fragColor = vec4(color.rgb, 1.0);\n"
-"}\n";
-
 const std::string simpleFragmentShaderSource =
 "#version 330 core\n"
 "in vec2 uv;\n"
@@ -103,14 +64,25 @@ const std::string simpleFragmentShaderSource =
 "   fragColor = texture(tex, uv);\n"
 "}\n";
 
-Master::Master(Mediator* pCefMediator, std::string userDirectory)
+Master::Master(Mediator* pCefMediator, std::string userDirectory, std::string recordTraceFile, std::string replayTraceFile, std::string benchmarkDirectory)
 {
     // Save members
     _pCefMediator = pCefMediator;
 	_userDirectory = userDirectory;
 
+	// Replay and benchmark run headless with recorded or scripted input
+	bool headless = !replayTraceFile.empty() || !benchmarkDirectory.empty();
+
     // ### GLFW AND OPENGL ###
 
+#ifdef __linux__
+	// Benchmark must not depend on GPU, so let Mesa render in software (e.g. llvmpipe under Xvfb)
+	if (!benchmarkDirectory.empty())
+	{
+		setenv("LIBGL_ALWAYS_SOFTWARE", "1", 0);
+	}
+#endif
+
     // Create OpenGL context
     LogInfo("Initializing GLFW...");
     glfwInit();
@@ -137,6 +109,10 @@ Master::Master(Mediator* pCefMediator, std::string userDirectory)
     glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
     glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+    if (headless)
+    {
+        glfwWindowHint(GLFW_VISIBLE, GL_FALSE);
+    }
     _pWindow = glfwCreateWindow(_width, _height, "GazeTheWeb - Browse", usedMonitor, NULL);
     glfwMakeContextCurrent(_pWindow);
     glfwSetInputMode(_pWindow, GLFW_CURSOR, GLFW_CURSOR_HIDDEN); // hide native mouse cursor
@@ -151,8 +127,8 @@ Master::Master(Mediator* pCefMediator, std::string userDirectory)
     const GLubyte* version = glGetString(GL_VERSION);
     LogInfo("OpenGL Version: ", std::string(reinterpret_cast<char const*>(version)));
 
-    // VSync
-    glfwSwapInterval(1);
+    // VSync (not while headless to measure frame times)
+    glfwSwapInterval(headless ? 0 : 1);
 #ifdef _WIN32
     // Turn on vertical screen sync under Windows
     // (I.e. it uses the WGL_EXT_swap_control extension)
@@ -160,7 +136,7 @@ Master::Master(Mediator* pCefMediator, std::string userDirectory)
     PFNWGLSWAPINTERVALEXTPROC wglSwapIntervalEXT = NULL;
     wglSwapIntervalEXT = (PFNWGLSWAPINTERVALEXTPROC)wglGetProcAddress("wglSwapIntervalEXT");
     if (wglSwapIntervalEXT)
-        wglSwapIntervalEXT(1);
+        wglSwapIntervalEXT(headless ? 0 : 1);
 #endif
 
     // Register callbacks to GLFW
@@ -247,6 +223,7 @@ Master::Master(Mediator* pCefMediator, std::string userDirectory)
     // Load styling
     eyegui::loadStyleSheet(_pGUI, "stylesheets/Global.seyegui");
 	eyegui::loadStyleSheet(_pSuperGUI, "stylesheets/Global.seyegui");
+	_pPausedDimmingStyle = _styleProperties.Get(_pSuperGUI, "pause_background", eyegui::StylePropertyVec4::BackgroundColor);
 
     // Set resize callback of GUI
     std::function<void(int, int)> resizeGUICallback = [&](int width, int height) { this->GUIResizeCallback(width, height); };
@@ -328,7 +305,30 @@ Master::Master(Mediator* pCefMediator, std::string userDirectory)
     // ### HOMEPAGE ###
 	// _upWeb->AddTab("https://www.tutorialspoint.com/html/html_select_tag.htm");
 	// _upWeb->AddTab(std::string(CONTENT_PATH) + "/websites/index.html");
-	_upWeb->AddTab(_upSettings->GetHomepage());
+	// Restore tabs of last session or open homepage. Headless runs must start deterministically, so they use no session
+	bool sessionRestored = false;
+	if (setup::SESSION_STORE && !headless)
+	{
+		sessionRestored = _upWeb->StartSessionStore();
+	}
+	if (!benchmarkDirectory.empty())
+	{
+		// Benchmark opens pages of suite instead
+		_upBenchmark = std::unique_ptr<Benchmark>(new Benchmark(benchmarkDirectory, _userDirectory));
+		if (_upBenchmark->IsValid())
+		{
+			StartBenchmarkPage();
+		}
+		else
+		{
+			LogError("Master: No pages found for benchmark in ", benchmarkDirectory);
+			_exit = true;
+		}
+	}
+	else if (!sessionRestored)
+	{
+		_upWeb->AddTab(_upSettings->GetHomepage());
+	}
 
     // ### SUPER LAYOUT ###
 
@@ -366,17 +366,31 @@ Master::Master(Mediator* pCefMediator, std::string userDirectory)
 
     // ### INPUT ###
 	_upEyeInput = std::unique_ptr<EyeInput>(new EyeInput(this));
+	int replayWindowWidth = 0;
+	int replayWindowHeight = 0;
+	if (!replayTraceFile.empty())
+	{
+		if (!_upEyeInput->StartReplay(replayTraceFile, replayWindowWidth, replayWindowHeight))
+		{
+			glfwShowWindow(_pWindow); // continue with live input
+		}
+	}
+	else if (!recordTraceFile.empty())
+	{
+		_upEyeInput->StartRecording(recordTraceFile, _width, _height);
+	}
 
     // ### FRAMEBUFFER ###
-    _upFramebuffer = std::unique_ptr<Framebuffer>(new Framebuffer(_width, _height));
-	_upFramebuffer->Bind();
-    _upFramebuffer->AddAttachment(Framebuffer::ColorFormat::RGB);
-	_upFramebuffer->Unbind();
+    _spFramebuffer = GPUPool::instance().LeaseFramebuffer(_width, _height, Framebuffer::ColorFormat::RGB);
     _upScreenFillingQuad = std::unique_ptr<RenderItem>(
         new RenderItem(
             vertexShaderSource,
             geometryShaderSource,
-            setup::BLUR_PERIPHERY ? blurFragmentShaderSource : simpleFragmentShaderSource));
+            simpleFragmentShaderSource));
+    if (setup::BLUR_PERIPHERY)
+    {
+        _upPeripheryBlur = std::unique_ptr<PeripheryBlur>(new PeripheryBlur(_width, _height));
+    }
 
 	// ### JavaScript to LSL ###
 
@@ -401,9 +415,19 @@ Master::Master(Mediator* pCefMediator, std::string userDirectory)
 
     // ### OTHER ###
 
+	// Frame profiling, benchmark collects durations of all stages
+	FrameProfiler::instance().SetActive(setup::PROFILE_FRAMES || _upBenchmark != nullptr);
+	FrameProfiler::instance().SetCollectDurations(_upBenchmark != nullptr);
+
+	// Use window size of recording for replay
+	if (replayWindowWidth > 0 && replayWindowHeight > 0)
+	{
+		glfwSetWindowSize(_pWindow, replayWindowWidth, replayWindowHeight);
+	}
+
 	// Maximize window if required
 #ifdef _WIN32 // Windows
-	if (!setup::FULLSCREEN && setup::MAXIMIZE_WINDOW)
+	if (!setup::FULLSCREEN && setup::MAXIMIZE_WINDOW && !headless)
 	{
 		// Fetch handle to window from GLFW
 		auto Hwnd = glfwGetWin32Window(_pWindow);
@@ -431,9 +455,20 @@ Master::Master(Mediator* pCefMediator, std::string userDirectory)
 
 Master::~Master()
 {
+	// Send remaining telemetry
+	TelemetryBus::instance().Flush();
+
     // Manual destruction of Web. Otherwise there are errors in CEF at shutdown (TODO: understand why)
     _upWeb.reset();
 
+    // Let workers finish writing of files and drop continuations, which may refer to destroyed objects
+    WorkerPool::instance().Stop();
+
+    // Free pooled textures and framebuffers while OpenGL context still exists
+    _spFramebuffer.reset();
+    _upPeripheryBlur.reset();
+    GPUPool::instance().Clear();
+
     // Terminate eyeGUI
     eyegui::terminateGUI(_pSuperGUI);
     eyegui::terminateGUI(_pGUI);
@@ -454,6 +489,9 @@ double Master::GetTime() const
 
 void Master::Exit()
 {
+	// Store session before tabs are closed
+	_upWeb->StoreSession();
+
 	// Close all tabs
 	_upWeb->RemoveAllTabs();
 
@@ -482,14 +520,14 @@ std::u16string Master::FetchLocalization(std::string key) const
 	return eyegui::fetchLocalization(_pGUI, key);
 }
 
-void Master::SetStyleTreePropertyValue(std::string styleClass, eyegui::StylePropertyFloat type, std::string value)
+StylePropertyFloatHandle* Master::GetStyleProperty(std::string styleClass, eyegui::StylePropertyFloat type)
 {
-	eyegui::setStyleTreePropertyValue(_pGUI, styleClass, type, value);
+	return _styleProperties.Get(_pGUI, styleClass, type);
 }
 
-void Master::SetStyleTreePropertyValue(std::string styleClass, eyegui::StylePropertyVec4 type, std::string value)
+StylePropertyVec4Handle* Master::GetStyleProperty(std::string styleClass, eyegui::StylePropertyVec4 type)
 {
-	eyegui::setStyleTreePropertyValue(_pGUI, styleClass, type, value);
+	return _styleProperties.Get(_pGUI, styleClass, type);
 }
 
 void Master::PushNotification(std::u16string content, Type type, bool overridable)
@@ -504,10 +542,7 @@ void Master::PushNotificationByKey(std::string key, Type type, bool overridable)
 
 void Master::threadsafe_NotifyEyeTrackerStatus(EyeTrackerStatus status)
 {
-	// TODO: make job pushing a method of its own
-	_threadJobsMutex.lock();
-	_threadJobs.push_back(std::make_shared<PushEyetrackerStatusThreadJob>(this, status));
-	_threadJobsMutex.unlock();
+	WorkerPool::instance().PushMainThreadJob([this, status]() { PushEyeTrackerStatusNotification(status); });
 }
 
 void Master::Loop()
@@ -524,6 +559,19 @@ void Master::Loop()
 		// Time per frame
 		double currentTime = glfwGetTime();
 		float tpf = std::min((float)(currentTime - _lastTime), 0.25f); // everything breaks when tpf too big
+		if (_upEyeInput->IsReplaying())
+		{
+			// Replay is deterministic with fixed timestep, measured time goes into report
+			if (_upBenchmark)
+			{
+				_upBenchmark->AddFrameTime((float)(currentTime - _lastTime));
+			}
+			else
+			{
+				_replayFrameTimes.push_back((float)(currentTime - _lastTime));
+			}
+			tpf = GAZE_TRACE_REPLAY_TIMESTEP;
+		}
 		_lastTime = currentTime;
 
 		// Decrement time until input is accepted
@@ -532,20 +580,33 @@ void Master::Loop()
 			_timeUntilInput -= tpf;
 		}
 
-		// Execute thread jobs
-		_threadJobsMutex.lock(); // lock jobs
-		for (auto& rJob : _threadJobs)
-		{
-			rJob->Execute();
-		}
-		_threadJobs.clear();
-		_threadJobsMutex.unlock(); // unlock jobs
+		// Start profiling of frame
+		FrameProfiler::instance().BeginFrame();
+
+		// Upload paints of CEF which have been kept back for this frame
+		FrameProfiler::instance().BeginStage("CefBeginFrame", true);
+		_pCefMediator->BeginFrame(tpf);
+		FrameProfiler::instance().EndStage();
+
+		// Execute jobs pushed by other threads and continuations of background work
+		FrameProfiler::instance().BeginStage("WorkerPool");
+		WorkerPool::instance().Update();
+		FrameProfiler::instance().EndStage();
 
 		// Update lab streaming layer mailer to get incoming messages
+		FrameProfiler::instance().BeginStage("LabStreamMailer");
 		LabStreamMailer::instance().Update();
+		FrameProfiler::instance().EndStage();
+
+		// Send collected telemetry in batches
+		FrameProfiler::instance().BeginStage("TelemetryBus");
+		TelemetryBus::instance().Update(tpf);
+		FrameProfiler::instance().EndStage();
 
 		// Poll CefMediator
+		FrameProfiler::instance().BeginStage("CefPoll");
 		_pCefMediator->Poll(tpf);
+		FrameProfiler::instance().EndStage();
 
 		// Notification handling
 		if (_notificationTime <= 0)
@@ -584,12 +645,19 @@ void Master::Loop()
         double currentMouseY;
         glfwGetCursorPos(_pWindow, &currentMouseX, &currentMouseY);
 
+		// Start replay of benchmark when page is ready
+		if (_upBenchmark && !_upEyeInput->IsReplaying())
+		{
+			UpdateBenchmark();
+		}
+
 		// Update eye input
 		int windowX = 0;
 		int windowY = 0;
 		glfwGetWindowPos(_pWindow, &windowX, &windowY);
 		double gazeX, gazeY; // result of EyeInput update
 		bool saccade; // provided by filtering algorithm
+		FrameProfiler::instance().BeginStage("EyeInput");
 		bool gazeUsed = _upEyeInput->Update(
 			tpf,
 			currentMouseX,
@@ -601,6 +669,34 @@ void Master::Loop()
 			windowY,
 			_width,
 			_height); // returns whether gaze was used (or emulated by mouse)
+		FrameProfiler::instance().EndStage();
+
+		// Dispatch events of replayed gaze trace
+		if (_upEyeInput->IsReplaying())
+		{
+			if (_upEyeInput->IsReplayFinished())
+			{
+				if (_upBenchmark)
+				{
+					FinishBenchmarkPage();
+				}
+				else
+				{
+					WriteReplayReport();
+					Exit();
+				}
+				FrameProfiler::instance().EndFrame();
+				continue;
+			}
+			for (const auto& rEvent : _upEyeInput->FetchReplayedEvents())
+			{
+				switch (rEvent.type)
+				{
+				case GazeTraceEvent::Type::KEY: { GLFWKeyCallback(rEvent.code, 0, rEvent.action, rEvent.mods); break; }
+				case GazeTraceEvent::Type::MOUSE_BUTTON: { GLFWMouseButtonCallback(rEvent.code, rEvent.action, rEvent.mods); break; }
+				}
+			}
+		}
 
         // Update cursor with original mouse input
         eyegui::setVisibilityOfLayout(_pCursorLayout, !gazeUsed, false, true);
@@ -618,11 +714,7 @@ void Master::Loop()
 
         // Pause visualization
         _pausedDimming.update(tpf, !_paused);
-        eyegui::setStyleTreePropertyValue(
-			_pSuperGUI,
-            "pause_background",
-			eyegui::StylePropertyVec4::BackgroundColor,
-            RGBAToHexString(glm::vec4(0, 0, 0, MASTER_PAUSE_ALPHA * _pausedDimming.getValue())));
+        _pPausedDimmingStyle->Set(glm::vec4(0, 0, 0, MASTER_PAUSE_ALPHA * _pausedDimming.getValue()));
 
         // Input struct for eyeGUI
         eyegui::Input eyeGUIInput;
@@ -633,7 +725,7 @@ void Master::Loop()
         eyeGUIInput.gazeY = (int)gazeY;
 
         // Check for focus and time until input
-        int focused = glfwGetWindowAttrib(_pWindow, GLFW_FOCUSED);
+        int focused = _upEyeInput->IsReplaying() ? 1 : glfwGetWindowAttrib(_pWindow, GLFW_FOCUSED); // hidden window has no focus
         if((focused <= 0) // window not focused
             || (_timeUntilInput > 0)) // do not use input, yet
         {
@@ -642,17 +734,23 @@ void Master::Loop()
         }
 
         // Update eyeGUI
+        FrameProfiler::instance().BeginStage("UpdateSuperGUI");
         eyegui::Input usedEyeGUIInput = eyegui::updateGUI(_pSuperGUI, tpf, eyeGUIInput);
+        FrameProfiler::instance().EndStage();
 
         if(_paused)
         {
             // Do not pipe input to standard GUI if paused
             usedEyeGUIInput.gazeUsed = true; // TODO: null pointer would be nicer
         }
+        FrameProfiler::instance().BeginStage("UpdateGUI");
         usedEyeGUIInput = eyegui::updateGUI(_pGUI, tpf, usedEyeGUIInput);
+        FrameProfiler::instance().EndStage();
 
         // Do message loop of CEF
+        FrameProfiler::instance().BeginStage("CefMessageLoop", true);
         _pCefMediator->DoMessageLoopWork();
+        FrameProfiler::instance().EndStage();
 
         // Create input struct for own framework
         Input input(
@@ -663,7 +761,7 @@ void Master::Loop()
 			saccade);
 
         // Bind framebuffer
-        _upFramebuffer->Bind();
+        _spFramebuffer->Bind();
 
         // Clearing of buffers
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
@@ -676,12 +774,27 @@ void Master::Loop()
         switch (_currentState)
         {
         case StateType::WEB:
+            FrameProfiler::instance().BeginStage("WebUpdate");
             nextState = _upWeb->Update(tpf, input);
+            FrameProfiler::instance().EndStage();
+            if (Mediator::UsesExternalMessagePump())
+            {
+                // Let CEF react on input sent by update, so paint may arrive before drawing
+                FrameProfiler::instance().BeginStage("CefMessageLoop", true);
+                _pCefMediator->DoMessageLoopWork();
+                FrameProfiler::instance().EndStage();
+            }
+            FrameProfiler::instance().BeginStage("WebDraw", true);
             _upWeb->Draw();
+            FrameProfiler::instance().EndStage();
             break;
         case StateType::SETTINGS:
+            FrameProfiler::instance().BeginStage("SettingsUpdate");
             nextState = _upSettings->Update(tpf, input);
+            FrameProfiler::instance().EndStage();
+            FrameProfiler::instance().BeginStage("SettingsDraw", true);
             _upSettings->Draw();
+            FrameProfiler::instance().EndStage();
             break;
         }
 
@@ -717,45 +830,79 @@ void Master::Loop()
 		// Enable depth test again
 		glEnable(GL_DEPTH_TEST);
 
+        // Pass changed style properties to eyeGUI, once per frame
+        _styleProperties.Flush();
+
         // Draw eyeGUI on top
+        FrameProfiler::instance().BeginStage("DrawGUI", true);
         eyegui::drawGUI(_pGUI);
+        FrameProfiler::instance().EndStage();
+        FrameProfiler::instance().BeginStage("DrawSuperGUI", true);
         eyegui::drawGUI(_pSuperGUI);
+        FrameProfiler::instance().EndStage();
 
         // Bind standard framebuffer
-        _upFramebuffer->Unbind();
+        _spFramebuffer->Unbind();
+
+        // Build blurred levels of periphery. Whole rendering is redrawn every frame, so levels are as well
+        FrameProfiler::instance().BeginStage("Composite", true);
+        if (_upPeripheryBlur)
+        {
+            _upPeripheryBlur->Update(_spFramebuffer->GetAttachment(0));
+        }
 
         // Clearing of buffers
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-        // Bind framebuffer as texture
-        glActiveTexture(GL_TEXTURE0);
-        glBindTexture(GL_TEXTURE_2D, _upFramebuffer->GetAttachment(0));
-
-        // Render screen filling quad
-        _upScreenFillingQuad->Bind();
-
-        // Fill uniforms when necessary
-        if(setup::BLUR_PERIPHERY)
+        // Render screen filling quad, with blurred periphery if activated
+        if (_upPeripheryBlur)
         {
-            _upScreenFillingQuad->GetShader()->UpdateValue("focusPixelPosition", glm::vec2(usedEyeGUIInput.gazeX, _height - usedEyeGUIInput.gazeY)); // OpenGL coordinate system
-            _upScreenFillingQuad->GetShader()->UpdateValue("focusPixelRadius", (float)glm::min(_width, _height) * BLUR_FOCUS_RELATIVE_RADIUS);
-            _upScreenFillingQuad->GetShader()->UpdateValue("peripheryMultiplier", BLUR_PERIPHERY_MULTIPLIER);
+            _upPeripheryBlur->Draw(
+                _spFramebuffer->GetAttachment(0),
+                glm::vec2(usedEyeGUIInput.gazeX, _height - usedEyeGUIInput.gazeY), // OpenGL coordinate system
+                (float)glm::min(_width, _height) * BLUR_FOCUS_RELATIVE_RADIUS,
+                BLUR_PERIPHERY_MULTIPLIER);
         }
+        else
+        {
+            // Bind framebuffer as texture
+            glActiveTexture(GL_TEXTURE0);
+            glBindTexture(GL_TEXTURE_2D, _spFramebuffer->GetAttachment(0));
 
-         _upScreenFillingQuad->Draw(GL_POINTS);
+            // Render screen filling quad
+            _upScreenFillingQuad->Bind();
+            _upScreenFillingQuad->Draw(GL_POINTS);
+        }
+        FrameProfiler::instance().EndStage();
 
         // Reset reminder BEFORE POLLING
         _leftMouseButtonPressed = false;
         _enterKeyPressed = false;
 
         // Swap front and back buffers and poll events
+        FrameProfiler::instance().BeginStage("SwapBuffers");
         glfwSwapBuffers(_pWindow);
+        FrameProfiler::instance().EndStage();
+        FrameProfiler::instance().BeginStage("PollEvents");
         glfwPollEvents();
+        FrameProfiler::instance().EndStage();
+
+        // Do CEF work which has been scheduled while waiting for swap
+        if (Mediator::UsesExternalMessagePump())
+        {
+            FrameProfiler::instance().BeginStage("CefMessageLoop", true);
+            _pCefMediator->DoMessageLoopWork();
+            FrameProfiler::instance().EndStage();
+        }
+
+        // End profiling of frame
+        FrameProfiler::instance().EndFrame();
     }
 }
 
 void Master::GLFWKeyCallback(int key, int scancode, int action, int mods)
 {
+	_upEyeInput->RecordEvent({ GazeTraceEvent::Type::KEY, key, action, mods });
     if (action == GLFW_PRESS)
     {
         switch (key)
@@ -765,7 +912,9 @@ void Master::GLFWKeyCallback(int key, int scancode, int action, int mods)
             case GLFW_KEY_ENTER: { _enterKeyPressed = true; break; }
 			case GLFW_KEY_S: { LabStreamMailer::instance().Send("42"); break; } // TODO: testing
 			case GLFW_KEY_C: { _upEyeInput->Calibrate(); break; }
+			case GLFW_KEY_F: { _upEyeInput->SetFilterType((FilterType)(((int)_upEyeInput->GetFilterType() + 1) % (int)FilterType::COUNT)); break; }
 			case GLFW_KEY_0: { _pCefMediator->ShowDevTools(); break; }
+			case GLFW_KEY_P: { FrameProfiler::instance().ExportChromeTrace(_userDirectory + FRAME_PROFILER_TRACE_FILE); break; }
 			case GLFW_KEY_6: { _upWeb->PushBackPointingEvaluationPipeline(PointingApproach::MAGNIFICATION); break; }
 			case GLFW_KEY_7: { _upWeb->PushBackPointingEvaluationPipeline(PointingApproach::ZOOM); break; }
 			case GLFW_KEY_8: { _upWeb->PushBackPointingEvaluationPipeline(PointingApproach::DRIFT_CORRECTION); break; }
@@ -776,6 +925,7 @@ void Master::GLFWKeyCallback(int key, int scancode, int action, int mods)
 
 void Master::GLFWMouseButtonCallback(int button, int action, int mods)
 {
+	_upEyeInput->RecordEvent({ GazeTraceEvent::Type::MOUSE_BUTTON, button, action, mods });
     if (button == GLFW_MOUSE_BUTTON_LEFT && action == GLFW_PRESS)
     {
         _leftMouseButtonPressed = true;
@@ -801,10 +951,12 @@ void Master::GLFWResizeCallback(int width, int height)
     // Independent from bound framebuffer
     glViewport(0, 0, _width, _height);
 
-    // Tell framebuffer about new window size
-    _upFramebuffer->Bind();
-    _upFramebuffer->Resize(_width, _height);
-    _upFramebuffer->Unbind();
+    // Lease framebuffer in new window size, old one goes back to pool
+    _spFramebuffer = GPUPool::instance().LeaseFramebuffer(_width, _height, Framebuffer::ColorFormat::RGB);
+    if (_upPeripheryBlur)
+    {
+        _upPeripheryBlur->Resize(_width, _height);
+    }
 
     // CEF mediator is told to resize tabs via GUI callback
 }
@@ -816,6 +968,100 @@ void Master::GUIResizeCallback(int width, int height)
     _pCefMediator->ResizeTabs();
 }
 
+void Master::WriteReplayReport() const
+{
+	// Sort frame times for percentiles
+	std::vector<float> frameTimes(_replayFrameTimes);
+	if (frameTimes.empty()) { return; }
+	std::sort(frameTimes.begin(), frameTimes.end());
+	double sum = 0;
+	for (float frameTime : frameTimes) { sum += frameTime; }
+	auto percentile = [&](float p) { return 1000.f * frameTimes[(size_t)(p * (frameTimes.size() - 1))]; };
+
+	// Write report
+	std::ostringstream report;
+	report << "frames: " << frameTimes.size() << "\n"
+		<< "replayed duration [s]: " << frameTimes.size() * GAZE_TRACE_REPLAY_TIMESTEP << "\n"
+		<< "wall duration [s]: " << sum << "\n"
+		<< "mean frame time [ms]: " << 1000.0 * sum / frameTimes.size() << "\n"
+		<< "median frame time [ms]: " << percentile(0.5f) << "\n"
+		<< "95th percentile frame time [ms]: " << percentile(0.95f) << "\n"
+		<< "99th percentile frame time [ms]: " << percentile(0.99f) << "\n"
+		<< "max frame time [ms]: " << percentile(1.f) << "\n";
+	std::ofstream file(_userDirectory + GAZE_TRACE_REPLAY_REPORT_FILE);
+	file << report.str();
+	LogInfo("Master: Replay finished.\n", report.str());
+}
+
+void Master::StartBenchmarkPage()
+{
+	_upWeb->RemoveAllTabs();
+	_upWeb->AddTab(_upBenchmark->GetPageURL());
+	_benchmarkPageStartTime = glfwGetTime();
+	_benchmarkLoadedTime = _benchmarkPageStartTime;
+}
+
+void Master::UpdateBenchmark()
+{
+	// Wait until page has not been loading for a while or loading takes too long
+	double time = glfwGetTime();
+	if (_upWeb->IsCurrentTabLoading())
+	{
+		_benchmarkLoadedTime = time;
+	}
+	bool settled = time - _benchmarkLoadedTime >= BENCHMARK_SETTLE_TIME;
+	bool timeout = time - _benchmarkPageStartTime >= BENCHMARK_LOAD_TIMEOUT;
+	if (!settled && !timeout) { return; }
+	if (!settled)
+	{
+		LogError("Master: Benchmark page did not finish loading in time: ", _upBenchmark->GetPageURL());
+	}
+
+	// Replay gaze trace of page
+	std::string traceFile = _upBenchmark->GetTraceFile(_width, _height);
+	int replayWindowWidth = 0;
+	int replayWindowHeight = 0;
+	if (!_upEyeInput->StartReplay(traceFile, replayWindowWidth, replayWindowHeight))
+	{
+		LogError("Master: Could not replay gaze trace for benchmark: ", traceFile);
+		Exit();
+		return;
+	}
+	if (replayWindowWidth > 0 && replayWindowHeight > 0 && (replayWindowWidth != _width || replayWindowHeight != _height))
+	{
+		glfwSetWindowSize(_pWindow, replayWindowWidth, replayWindowHeight);
+	}
+
+	// Durations while loading are not part of measurement
+	FrameProfiler::instance().FetchDurations();
+	_upBenchmark->BeginMeasurement(traceFile, GetBenchmarkCounters(), (float)(_benchmarkLoadedTime - _benchmarkPageStartTime));
+}
+
+void Master::FinishBenchmarkPage()
+{
+	_upBenchmark->EndMeasurement(GetBenchmarkCounters(), FrameProfiler::instance().FetchDurations(), _upWeb->GetRenderScale());
+	_upEyeInput->StopReplay();
+	if (_upBenchmark->NextPage())
+	{
+		StartBenchmarkPage();
+	}
+	else
+	{
+		_upBenchmark->WriteReport(std::string(reinterpret_cast<char const*>(glGetString(GL_RENDERER))));
+		Exit();
+	}
+}
+
+BenchmarkCounters Master::GetBenchmarkCounters() const
+{
+	BenchmarkCounters counters;
+	_pCefMediator->GetPaintCounts(counters.paints, counters.uploads, counters.skippedPaints);
+	counters.ipcSent = IPCCounter::instance().GetSentCount();
+	counters.ipcJavaScript = IPCCounter::instance().GetJavaScriptCount();
+	counters.ipcReceived = IPCCounter::instance().GetReceivedCount();
+	return counters;
+}
+
 void Master::GUIPrintCallback(std::string message) const
 {
     LogInfo("eyeGUI: ", message);
@@ -839,23 +1085,18 @@ void Master::MasterButtonListener::up(eyegui::Layout* pLayout, std::string id)
     }
 }
 
-Master::ThreadJob::~ThreadJob()
-{
-	// For the sake of C++
-}
-
-void Master::PushEyetrackerStatusThreadJob::Execute()
+void Master::PushEyeTrackerStatusNotification(EyeTrackerStatus status)
 {
-	switch (_status)
+	switch (status)
 	{
 	case EyeTrackerStatus::TRYING_TO_CONNECT:
-		_pMaster->PushNotificationByKey("notification:eye_tracker_status:trying_to_connect", MasterNotificationInterface::Type::NEUTRAL, true);
+		PushNotificationByKey("notification:eye_tracker_status:trying_to_connect", MasterNotificationInterface::Type::NEUTRAL, true);
 		break;
 	case EyeTrackerStatus::CONNECTED:
-		_pMaster->PushNotificationByKey("notification:eye_tracker_status:connected", MasterNotificationInterface::Type::SUCCESS, false);
+		PushNotificationByKey("notification:eye_tracker_status:connected", MasterNotificationInterface::Type::SUCCESS, false);
 		break;
 	case EyeTrackerStatus::DISCONNECTED:
-		_pMaster->PushNotificationByKey("notification:eye_tracker_status:disconnected", MasterNotificationInterface::Type::WARNING, false);
+		PushNotificationByKey("notification:eye_tracker_status:disconnected", MasterNotificationInterface::Type::WARNING, false);
 		break;
 	default:
 		// Nothing
@@ -11,7 +11,12 @@
 
 #include "src/MasterNotificationInterface.h"
 #include "src/MasterThreadsafeInterface.h"
+#include "src/Benchmark.h"
 #include "src/Singletons/LabStreamMailer.h"
+#include "src/Singletons/FrameProfiler.h"
+#include "src/Singletons/TelemetryBus.h"
+#include "src/Singletons/GPUPool.h"
+#include "src/Singletons/WorkerPool.h"
 #include "src/CEF/Mediator.h"
 #include "src/State/Web/Web.h"
 #include "src/State/Settings/Settings.h"
@@ -20,6 +25,8 @@
 #include "src/Utils/LerpValue.h"
 #include "src/Utils/Framebuffer.h"
 #include "src/Utils/RenderItem.h"
+#include "src/Utils/PeripheryBlur.h"
+#include "src/Utils/StyleProperty.h"
 #include "externals/OGL/gl_core_3_3.h"
 #include "submodules/eyeGUI/include/eyeGUI.h"
 #include <queue>
@@ -32,8 +39,9 @@ class Master : public MasterNotificationInterface, public MasterThreadsafeInterf
 {
 public:
 
-    // Constructor takes pointer to CefMediator
-    Master(Mediator* pMediator, std::string userDirectory);
+    // Constructor takes pointer to CefMediator. Optionally, input is recorded to or replayed from gaze trace file
+    // or benchmark suite in given directory is run
+    Master(Mediator* pMediator, std::string userDirectory, std::string recordTraceFile = "", std::string replayTraceFile = "", std::string benchmarkDirectory = "");
 
     // Destructor
     virtual ~Master();
@@ -76,9 +84,9 @@ public:
 	// Fetch localization string by key
 	std::u16string FetchLocalization(std::string key) const;
 
-	// Set value of style property in style tree
-	void SetStyleTreePropertyValue(std::string styleClass, eyegui::StylePropertyFloat type, std::string value);
-	void SetStyleTreePropertyValue(std::string styleClass, eyegui::StylePropertyVec4 type, std::string value);
+	// Get handle of style property in style tree. Values set on it are passed to eyeGUI when changed, once per frame
+	StylePropertyFloatHandle* GetStyleProperty(std::string styleClass, eyegui::StylePropertyFloat type);
+	StylePropertyVec4Handle* GetStyleProperty(std::string styleClass, eyegui::StylePropertyVec4 type);
 
 	// Set global keyboard layout
 	void SetKeyboardLayout(eyegui::KeyboardLayout keyboardLayout)
@@ -154,46 +162,8 @@ private:
     // Instance of listener
     std::shared_ptr<MasterButtonListener> _spMasterButtonListener;
 
-	// ThreadJob class (class to store a job assigned by a thread)
-	class ThreadJob
-	{
-	public:
-
-		// Constructor
-		ThreadJob(Master* pMaster) : _pMaster(pMaster) {}
-
-		// Destructor
-		virtual ~ThreadJob() = 0;
-
-		// Execute
-		virtual void Execute() = 0;
-	
-	protected:
-
-		// Members
-		Master* _pMaster;
-	};
-	class PushEyetrackerStatusThreadJob : public ThreadJob
-	{
-	public:
-
-		// Constructor
-		PushEyetrackerStatusThreadJob(Master* pMaster, EyeTrackerStatus status) : ThreadJob(pMaster), _status(status) {};
-
-		// Destructor
-		~PushEyetrackerStatusThreadJob() {}
-
-		// Execute
-		virtual void Execute();
-
-	private:
-
-		// Members
-		EyeTrackerStatus _status;
-	};
-
-	// List jobs as friends with benefits
-	friend class PushEyetrackerStatusThreadJob;
+	// Push notification about status of eye tracker. Called on main thread
+	void PushEyeTrackerStatusNotification(EyeTrackerStatus status);
 
     // Loop of master
     void Loop();
@@ -206,6 +176,21 @@ private:
     void GUIResizeCallback(int width, int height);
     void GUIPrintCallback(std::string message) const;
 
+	// Write measured frame times of replay to report file in user directory
+	void WriteReplayReport() const;
+
+	// Open current page of benchmark
+	void StartBenchmarkPage();
+
+	// Start replay of benchmark when page is ready. Called while not replaying
+	void UpdateBenchmark();
+
+	// End measurement of replayed page and continue with next one or exit
+	void FinishBenchmarkPage();
+
+	// Current paint and IPC counters
+	BenchmarkCounters GetBenchmarkCounters() const;
+
     // States
     std::unique_ptr<Web> _upWeb;
     std::unique_ptr<Settings> _upSettings;
@@ -257,13 +242,20 @@ private:
 
     // Lerp value to show pause as dimming of whole screen
     LerpValue _pausedDimming;
+    StylePropertyVec4Handle* _pPausedDimmingStyle = NULL;
+
+    // Handles of style properties of both GUIs
+    StylePropertyRegistry _styleProperties;
 
     // Framebuffer for complete rendering
-    std::unique_ptr<Framebuffer> _upFramebuffer;
+    std::shared_ptr<Framebuffer> _spFramebuffer; // leased from GPU pool
 
     // Render item to render screenfilling quad
     std::unique_ptr<RenderItem> _upScreenFillingQuad;
 
+    // Blur of periphery, only created when activated in setup
+    std::unique_ptr<PeripheryBlur> _upPeripheryBlur;
+
 	// Directory for bookmarks etc
 	std::string _userDirectory;
 
@@ -279,14 +271,16 @@ private:
 	// LabStreamMailer callback to print incoming messages to log
 	std::shared_ptr<LabStreamCallback> _spLabStreamCallback;
 
-	// Boolean to indicate exiting the applicatoin
-	bool _exit = false;
+	// Frame times measured while replaying gaze trace, in seconds
+	std::vector<float> _replayFrameTimes;
 
-	// Buffer for jobs assigned by threads
-	std::vector<std::shared_ptr<ThreadJob> > _threadJobs;
+	// Benchmark, only created in benchmark mode
+	std::unique_ptr<Benchmark> _upBenchmark;
+	double _benchmarkPageStartTime = 0;
+	double _benchmarkLoadedTime = 0; // last time page was seen loading
 
-	// Mutex to guarantees that threadJobs are not manipulated while read by master
-	std::mutex _threadJobsMutex;
+	// Boolean to indicate exiting the applicatoin
+	bool _exit = false;
 };
 
 #endif // MASTER_H_
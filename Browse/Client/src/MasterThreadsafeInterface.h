@@ -3,7 +3,7 @@
 // Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
 //============================================================================
 // Master interface for accessing functionality from other threads.
-// Internally, ThreadJobs are pushed back to be processed in loop.
+// Internally, jobs are pushed to the main thread queue of WorkerPool.
 
 #ifndef MASTERTHREADSAFEINTERFACE_H_
 #define MASTERTHREADSAFEINTERFACE_H_
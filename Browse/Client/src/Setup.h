@@ -27,6 +27,13 @@ namespace setup
 	static const float LINK_CORRECTION_MAX_PIXEL_DISTANCE = 5.f;
 	static const int TEXT_SELECTION_MARGIN = 4; // area which is selected before / after zoom coordinate in CEFPixels
 	static const int FILTER_GAZE_FIXATION_PIXEL_RADIUS = 20;
+	static const int FILTER_TYPE = 2; // index of FilterType: 0 Simple, 1 I-VT, 2 I-DT, 3 One-Euro. May be cycled at runtime with key F
+	static const int FILTER_WINDOW_DURATION_MS = 200; // maximal duration of samples averaged within fixation
+	static const float FILTER_IVT_VELOCITY_THRESHOLD = 2000.f; // pixels per second
+	static const float FILTER_IDT_DISPERSION_THRESHOLD = 2.f * FILTER_GAZE_FIXATION_PIXEL_RADIUS; // pixels
+	static const float FILTER_ONE_EURO_MIN_CUTOFF = 1.f; // Hertz
+	static const float FILTER_ONE_EURO_BETA = 0.007f;
+	static const float FILTER_ONE_EURO_DERIVATE_CUTOFF = 1.f; // Hertz
 	static const bool EYEINPUT_DISTORT_GAZE = false;
 	static const float EYEINPUT_DISTORT_GAZE_BIAS_X = 64.f; // pixels
 	static const float EYEINPUT_DISTORT_GAZE_BIAS_Y = 32.f; // pixels
@@ -34,18 +41,51 @@ namespace setup
 	// Debugging
 	static const bool LOG_DEBUG_MESSAGES = false;
 	static const bool DRAW_DEBUG_OVERLAY = false;
+	static const bool PROFILE_FRAMES = false; // shown in debug overlay, trace exported with key P
 
 	// Experiments
 	static const std::string LAB_STREAM_OUTPUT_NAME = "BrowserOutputStream";
 	static const std::string LAB_STREAM_OUTPUT_SOURCE_ID = "myuniquesourceid23443";
 	static const std::string LAB_STREAM_INPUT_NAME = "MiddlewareStream"; // may be set to same value as LAB_STREAM_OUTPUT_NAME to receive own events for debugging purposes
 	static const bool LOG_INTERACTIONS = false;
+	static const unsigned int TELEMETRY_RING_CAPACITY = 1024; // events pending at most, further ones are dropped
+	static const unsigned int TELEMETRY_MESSAGE_RESERVE = 64; // characters preallocated per event
+	static const float TELEMETRY_FLUSH_RATE = 20.f; // flushes per second
 
 	// Other
 	static const bool ENABLE_WEBGL = false; // only on Windows
 	static const bool BLUR_PERIPHERY = false;
 	static const float WEB_VIEW_RESOLUTION_SCALE = 1.f;
+	static const bool ADAPTIVE_RENDER_SCALE = true; // adapt device scale factor of CEF rendering to frame time
+	static const float RENDER_SCALE_MIN = 0.5f; // device scale factor on weak hardware
+	static const float RENDER_SCALE_MAX = 1.5f; // device scale factor on strong hardware
+	static const float RENDER_SCALE_STEP = 0.25f;
+	static const float RENDER_SCALE_TARGET_FRAME_TIME = 1.f / 60.f; // seconds
+	static const bool SMOOTH_SCROLLING = true; // scroll rendered texture at display rate and request scrolling from CEF in steps
+	static const float SMOOTH_SCROLLING_SPEED = 1200.f; // CEF pixels per second at full auto scrolling
+	static const double SMOOTH_SCROLLING_STEP = 64.0; // CEF pixels per scrolling request while scrolling
+	static const double SMOOTH_SCROLLING_MAX_SHIFT = 128.0; // CEF pixels the texture may be shifted ahead of CEF
+	static const float SMOOTH_SCROLLING_REQUEST_TIMEOUT = 0.25f; // seconds until unanswered request is given up
+	static const float SMOOTH_SCROLLING_SETTLE_TIME = 0.5f; // seconds without scrolling until offset of CEF is adopted
+	static const bool ZOOM_HIGH_RESOLUTION = true; // let CEF render zoomed region sharply instead of only magnifying texture
+	static const float ZOOM_HIGH_RESOLUTION_MIN_MAGNIFICATION = 1.5f; // magnification from which on region is rendered in higher resolution
+	static const float ZOOM_HIGH_RESOLUTION_MAX_SCALE = 4.f; // maximal device scale factor used by CEF for rendering
+	static const float ZOOM_HIGH_RESOLUTION_MARGIN = 0.25f; // captured margin around visible region, relative to its size
+	static const float ZOOM_HIGH_RESOLUTION_BLEND_DURATION = 0.15f; // seconds of blending from magnified texture to sharp one
+	static const float ZOOM_HIGH_RESOLUTION_REPAINT_TIMEOUT = 0.5f; // seconds until unanswered repaint request is repeated
+	static const bool EXTERNAL_MESSAGE_PUMP = false; // CEF schedules its message loop work instead of being polled once per frame. Requires CEF branch 2623 or newer
+	static const int CEF_WINDOWLESS_FRAME_RATE = 60; // frames per second CEF paints at most
+	static const unsigned int PAINT_UPLOAD_MAX_INTERVAL = 3; // frames between uploads of active tab when frames are late
+	static const float PAINT_BACKGROUND_UPLOAD_INTERVAL = 1.f; // seconds between uploads of paints of background tabs
 	static const unsigned int HISTORY_MAX_PAGE_COUNT = 100; // maximal length of history
+	static const bool TAB_HIBERNATION = true; // close browsers of least recently used background tabs when over budget
+	static const unsigned int TAB_MEMORY_BUDGET_MB = 1024; // estimated memory all tabs may occupy together
+	static const bool SESSION_STORE = true; // store tabs periodically and restore them at next start
+	static const float SESSION_SNAPSHOT_INTERVAL = 15.f; // seconds between session snapshots
+	static const unsigned int SESSION_FILE_COMPACTION_MB = 32; // session file is rewritten with latest snapshot only when larger
+	static const unsigned int GPU_POOL_IDLE_BUDGET_MB = 256; // textures and framebuffers kept for recycling
+	static const unsigned int WORKER_POOL_THREAD_COUNT = 2; // threads for background work like writing of files
+	static const float WORKER_POOL_MAIN_THREAD_BUDGET = 2.f; // milliseconds per frame for continuations of background work
 }
 
 #endif // SETUP_H_
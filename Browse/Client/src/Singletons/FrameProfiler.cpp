@@ -0,0 +1,228 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+
+#include "FrameProfiler.h"
+#include "src/Global.h"
+#include "src/Utils/Logger.h"
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+
+FrameProfiler::FrameProfiler()
+{
+	_startTime = std::chrono::steady_clock::now();
+}
+
+FrameProfiler::~FrameProfiler()
+{
+	// Queries are not deleted since OpenGL context is already gone when static instance is destroyed
+}
+
+void FrameProfiler::BeginFrame()
+{
+	// Apply requested activity between frames only, so no stage is left open
+	_active = _requestedActive;
+	if (!_active) { return; }
+
+	// Results of earlier frames should be available by now
+	CollectQueries();
+
+	_openStages.clear();
+	_frameStart = Now();
+}
+
+void FrameProfiler::EndFrame()
+{
+	if (!_active) { return; }
+
+	double now = Now();
+	Record("Frame", _frameStart, now - _frameStart, false, 0);
+}
+
+void FrameProfiler::BeginStage(const std::string& name, bool measureGPU)
+{
+	if (!_active) { return; }
+
+	OpenStage stage;
+	stage.name = name;
+	stage.queryIndex = -1;
+	if (measureGPU)
+	{
+		stage.queryIndex = AcquireQueryPair();
+		glQueryCounter(_queryPool.at(stage.queryIndex).first, GL_TIMESTAMP);
+	}
+	stage.startMicroseconds = Now(); // take time after query has been issued
+	_openStages.push_back(stage);
+}
+
+void FrameProfiler::EndStage()
+{
+	if (!_active || _openStages.empty()) { return; }
+
+	double now = Now();
+	OpenStage stage = _openStages.back();
+	_openStages.pop_back();
+	int depth = (int)_openStages.size() + 1; // frame itself is depth zero
+
+	// Record CPU time immediately
+	Record(stage.name, stage.startMicroseconds, now - stage.startMicroseconds, false, depth);
+
+	// GPU time is collected in later frame
+	if (stage.queryIndex >= 0)
+	{
+		glQueryCounter(_queryPool.at(stage.queryIndex).second, GL_TIMESTAMP);
+		PendingQuery query;
+		query.name = stage.name;
+		query.startMicroseconds = stage.startMicroseconds;
+		query.depth = depth;
+		query.queryIndex = stage.queryIndex;
+		_pendingQueries.push_back(query);
+	}
+}
+
+void FrameProfiler::AddSample(const std::string& name, double durationMicroseconds)
+{
+	if (!_active) { return; }
+
+	Record(name, Now() - durationMicroseconds, durationMicroseconds, false, 1);
+}
+
+std::string FrameProfiler::GetOverlayText() const
+{
+	std::ostringstream stream;
+	stream << std::fixed << std::setprecision(2);
+	stream << "Stage: CPU avg / max, GPU avg [ms]\n";
+	for (const auto& rName : _stageOrder)
+	{
+		const auto& rStatistics = _statistics.at(rName);
+		stream << rName << ": "
+			<< rStatistics.cpuAverage / 1000.0 << " / "
+			<< rStatistics.cpuMax / 1000.0;
+		if (rStatistics.gpuAverage > 0)
+		{
+			stream << ", " << rStatistics.gpuAverage / 1000.0;
+		}
+		stream << "\n";
+	}
+	return stream.str();
+}
+
+bool FrameProfiler::ExportChromeTrace(std::string filepath) const
+{
+	std::ofstream file(filepath);
+	if (!file.is_open())
+	{
+		LogError("FrameProfiler: Cannot open file for trace export: ", filepath);
+		return false;
+	}
+
+	// Complete events ("X"), CPU on thread 1 and GPU on thread 2
+	file << std::fixed << std::setprecision(3);
+	file << "{\"traceEvents\":[\n";
+	file << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"CPU\"}},\n";
+	file << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":2,\"args\":{\"name\":\"GPU\"}}";
+	for (const auto& rEvent : _events)
+	{
+		file << ",\n{\"name\":\"" << rEvent.name
+			<< "\",\"cat\":\"" << (rEvent.gpu ? "gpu" : "cpu")
+			<< "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << (rEvent.gpu ? 2 : 1)
+			<< ",\"ts\":" << rEvent.startMicroseconds
+			<< ",\"dur\":" << rEvent.durationMicroseconds
+			<< ",\"args\":{\"depth\":" << rEvent.depth << "}}";
+	}
+	file << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+	LogInfo("FrameProfiler: Exported ", _events.size(), " events to ", filepath);
+	return true;
+}
+
+std::map<std::string, std::vector<double> > FrameProfiler::FetchDurations()
+{
+	std::map<std::string, std::vector<double> > durations;
+	durations.swap(_durations);
+	return durations;
+}
+
+double FrameProfiler::Now() const
+{
+	return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - _startTime).count();
+}
+
+void FrameProfiler::Record(const std::string& name, double startMicroseconds, double durationMicroseconds, bool gpu, int depth)
+{
+	// Store event for trace
+	_events.push_back({ name, startMicroseconds, durationMicroseconds, gpu, depth });
+	while ((int)_events.size() > FRAME_PROFILER_MAX_EVENTS)
+	{
+		_events.pop_front();
+	}
+
+	// Collect duration
+	if (_collectDurations)
+	{
+		_durations[gpu ? name + " (GPU)" : name].push_back(durationMicroseconds);
+	}
+
+	// Update statistics
+	auto iter = _statistics.find(name);
+	if (iter == _statistics.end())
+	{
+		iter = _statistics.emplace(name, Statistics()).first;
+		_stageOrder.push_back(name);
+	}
+	auto& rStatistics = iter->second;
+	if (gpu)
+	{
+		rStatistics.gpuAverage += FRAME_PROFILER_AVERAGE_WEIGHT * (durationMicroseconds - rStatistics.gpuAverage);
+	}
+	else
+	{
+		rStatistics.cpuAverage += FRAME_PROFILER_AVERAGE_WEIGHT * (durationMicroseconds - rStatistics.cpuAverage);
+		rStatistics.cpuMax = std::max(durationMicroseconds, rStatistics.cpuMax * FRAME_PROFILER_MAX_DECAY);
+	}
+}
+
+int FrameProfiler::AcquireQueryPair()
+{
+	// Reuse free pair
+	if (!_freeQueries.empty())
+	{
+		int index = _freeQueries.back();
+		_freeQueries.pop_back();
+		return index;
+	}
+
+	// Create new pair
+	GLuint queries[2];
+	glGenQueries(2, queries);
+	_queryPool.push_back(std::make_pair(queries[0], queries[1]));
+	return (int)_queryPool.size() - 1;
+}
+
+void FrameProfiler::CollectQueries()
+{
+	// Queries finish in order, so stop at first one which is not available
+	while (!_pendingQueries.empty())
+	{
+		const auto& rQuery = _pendingQueries.front();
+		const auto& rPair = _queryPool.at(rQuery.queryIndex);
+		GLint available = 0;
+		glGetQueryObjectiv(rPair.second, GL_QUERY_RESULT_AVAILABLE, &available);
+		if (!available) { break; }
+
+		// Read timestamps in nanoseconds
+		GLuint64 begin = 0;
+		GLuint64 end = 0;
+		glGetQueryObjectui64v(rPair.first, GL_QUERY_RESULT, &begin);
+		glGetQueryObjectui64v(rPair.second, GL_QUERY_RESULT, &end);
+
+		// GPU clock differs from CPU clock, so GPU event starts with its stage on CPU
+		Record(rQuery.name, rQuery.startMicroseconds, (double)(end - begin) / 1000.0, true, rQuery.depth);
+
+		_freeQueries.push_back(rQuery.queryIndex);
+		_pendingQueries.pop_front();
+	}
+}
@@ -0,0 +1,141 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+// Singleton to measure duration of stages within a frame. CPU time is taken
+// with steady clock, GPU time with OpenGL timestamp queries which are read
+// back some frames later to avoid stalls. Results are available as rolling
+// averages for display and as Chrome trace event JSON (chrome://tracing).
+// Must be used from the thread which owns the OpenGL context.
+
+#ifndef FRAMEPROFILER_H_
+#define FRAMEPROFILER_H_
+
+#include "externals/OGL/gl_core_3_3.h"
+#include <string>
+#include <vector>
+#include <deque>
+#include <map>
+#include <chrono>
+
+class FrameProfiler
+{
+public:
+
+	// Get instance
+	static FrameProfiler& instance()
+	{
+		static FrameProfiler _instance;
+		return _instance;
+	}
+
+	// Destructor
+	~FrameProfiler();
+
+	// Mark begin and end of frame. Begin also collects finished GPU queries
+	void BeginFrame();
+	void EndFrame();
+
+	// Begin and end of stage. Stages may be nested. GPU time is only measured when asked for
+	void BeginStage(const std::string& name, bool measureGPU = false);
+	void EndStage();
+
+	// Add measurement which is not a stage, e.g. a latency. Ends now
+	void AddSample(const std::string& name, double durationMicroseconds);
+
+	// Text with rolling average per stage, for display in debug overlay
+	std::string GetOverlayText() const;
+
+	// Write recorded events as Chrome trace event JSON. Returns whether successful
+	bool ExportChromeTrace(std::string filepath) const;
+
+	// Collect all durations per stage in microseconds, e.g. for percentiles of benchmark. GPU stages get suffix
+	void SetCollectDurations(bool collect) { _collectDurations = collect; }
+
+	// Fetch collected durations and clear them
+	std::map<std::string, std::vector<double> > FetchDurations();
+
+	// Getter and setter for activity. Inactive profiler does not record anything. Change is applied at next frame
+	bool IsActive() const { return _active; }
+	void SetActive(bool active) { _requestedActive = active; }
+
+private:
+
+	// Recorded event
+	struct Event
+	{
+		std::string name;
+		double startMicroseconds;
+		double durationMicroseconds;
+		bool gpu;
+		int depth;
+	};
+
+	// Stage which is currently open
+	struct OpenStage
+	{
+		std::string name;
+		double startMicroseconds;
+		int queryIndex; // -1 if no GPU measurement
+	};
+
+	// GPU measurement waiting for its result
+	struct PendingQuery
+	{
+		std::string name;
+		double startMicroseconds; // CPU time of stage begin, used as start in trace
+		int depth;
+		int queryIndex; // index of query pair in pool
+	};
+
+	// Rolling statistics per stage
+	struct Statistics
+	{
+		double cpuAverage = 0;
+		double gpuAverage = 0;
+		double cpuMax = 0;
+	};
+
+	// Microseconds since creation of profiler
+	double Now() const;
+
+	// Record event and update statistics
+	void Record(const std::string& name, double startMicroseconds, double durationMicroseconds, bool gpu, int depth);
+
+	// Get query object pair from pool
+	int AcquireQueryPair();
+
+	// Collect results of finished GPU queries
+	void CollectQueries();
+
+	// Members
+	bool _active = false;
+	bool _requestedActive = false;
+	std::chrono::steady_clock::time_point _startTime;
+	double _frameStart = 0;
+	std::vector<OpenStage> _openStages;
+	std::vector<std::pair<GLuint, GLuint> > _queryPool;
+	std::vector<int> _freeQueries;
+	std::deque<PendingQuery> _pendingQueries;
+	std::deque<Event> _events;
+	std::map<std::string, Statistics> _statistics;
+	std::vector<std::string> _stageOrder; // order of first appearance, for display
+	bool _collectDurations = false;
+	std::map<std::string, std::vector<double> > _durations;
+
+	// Private copy / asignment constructors
+	FrameProfiler();
+	FrameProfiler(const FrameProfiler&) {}
+	FrameProfiler& operator = (const FrameProfiler &) { return *this; }
+};
+
+// Scoped stage which ends when leaving the scope
+class ProfilerScope
+{
+public:
+
+	ProfilerScope(const std::string& name, bool measureGPU = false) { FrameProfiler::instance().BeginStage(name, measureGPU); }
+	~ProfilerScope() { FrameProfiler::instance().EndStage(); }
+};
+
+#endif // FRAMEPROFILER_H_
@@ -0,0 +1,197 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+
+#include "GPUPool.h"
+#include "src/Setup.h"
+#include "src/Utils/Logger.h"
+#include <sstream>
+
+std::shared_ptr<Texture> GPUPool::LeaseTexture(
+	int width,
+	int height,
+	GLenum internalFormat,
+	Texture::Filter filter,
+	Texture::Wrap wrap)
+{
+	TextureFormat format = { internalFormat, filter, wrap };
+	Texture* pTexture = NULL;
+
+	// Search most recently returned idle texture with same size and format
+	for (auto iter = _idleTextures.rbegin(); iter != _idleTextures.rend(); ++iter)
+	{
+		const auto& rFormat = iter->format;
+		if (iter->upTexture->GetWidth() == width && iter->upTexture->GetHeight() == height
+			&& rFormat.internalFormat == internalFormat && rFormat.filter == filter && rFormat.wrap == wrap)
+		{
+			pTexture = iter->upTexture.release();
+			_idleBytes -= iter->bytes;
+			_idleTextures.erase(std::next(iter).base());
+			_recycledCount++;
+			break;
+		}
+	}
+
+	// Allocate new texture
+	if (pTexture == NULL)
+	{
+		pTexture = new Texture(width, height, internalFormat, filter, wrap);
+		pTexture->Fill(width, height, GL_RGBA, NULL);
+		_allocatedCount++;
+	}
+
+	// Hand out texture which returns to pool when released
+	_leasedTextures.emplace(pTexture, format);
+	return std::shared_ptr<Texture>(pTexture, [](Texture* pReleased) { GPUPool::instance().ReturnTexture(pReleased); });
+}
+
+std::shared_ptr<Framebuffer> GPUPool::LeaseFramebuffer(
+	int width,
+	int height,
+	Framebuffer::ColorFormat colorFormat,
+	bool clampToBorder)
+{
+	FramebufferFormat format = { colorFormat, clampToBorder };
+	Framebuffer* pFramebuffer = NULL;
+
+	// Search most recently returned idle framebuffer with same size and format
+	for (auto iter = _idleFramebuffers.rbegin(); iter != _idleFramebuffers.rend(); ++iter)
+	{
+		const auto& rFormat = iter->format;
+		if (iter->upFramebuffer->GetWidth() == width && iter->upFramebuffer->GetHeight() == height
+			&& rFormat.colorFormat == colorFormat && rFormat.clampToBorder == clampToBorder)
+		{
+			pFramebuffer = iter->upFramebuffer.release();
+			_idleBytes -= iter->bytes;
+			_idleFramebuffers.erase(std::next(iter).base());
+			_recycledCount++;
+			break;
+		}
+	}
+
+	// Allocate new framebuffer
+	if (pFramebuffer == NULL)
+	{
+		pFramebuffer = new Framebuffer(width, height);
+		pFramebuffer->Bind();
+		pFramebuffer->AddAttachment(colorFormat, clampToBorder);
+		pFramebuffer->Unbind();
+		_allocatedCount++;
+	}
+
+	// Hand out framebuffer which returns to pool when released
+	_leasedFramebuffers.emplace(pFramebuffer, format);
+	return std::shared_ptr<Framebuffer>(pFramebuffer, [](Framebuffer* pReleased) { GPUPool::instance().ReturnFramebuffer(pReleased); });
+}
+
+void GPUPool::Clear()
+{
+	_idleTextures.clear();
+	_idleFramebuffers.clear();
+	_idleBytes = 0;
+	_cleared = true;
+}
+
+size_t GPUPool::GetLiveBytes() const
+{
+	size_t bytes = 0;
+	for (const auto& rPair : _leasedTextures)
+	{
+		bytes += EstimateBytes(*rPair.first, rPair.second);
+	}
+	for (const auto& rPair : _leasedFramebuffers)
+	{
+		bytes += EstimateBytes(*rPair.first, rPair.second);
+	}
+	return bytes;
+}
+
+std::string GPUPool::GetReport() const
+{
+	const size_t megabyte = 1024 * 1024;
+	std::stringstream report;
+	report << "Live: " << GetLiveBytes() / megabyte << " MB (" << GetLiveCount() << ")\n"
+		<< "Idle: " << _idleBytes / megabyte << " MB (" << GetIdleCount() << ")\n"
+		<< "Recycled / allocated: " << _recycledCount << " / " << _allocatedCount << "\n";
+	return report.str();
+}
+
+void GPUPool::ReturnTexture(Texture* pTexture)
+{
+	// Remember format and forget lease
+	auto iter = _leasedTextures.find(pTexture);
+	if (iter == _leasedTextures.end() || _cleared)
+	{
+		if (iter != _leasedTextures.end()) { _leasedTextures.erase(iter); }
+		delete pTexture;
+		return;
+	}
+	TextureFormat format = iter->second;
+	_leasedTextures.erase(iter);
+
+	// Keep it as idle, size may have changed while leased
+	size_t bytes = EstimateBytes(*pTexture, format);
+	_idleTextures.push_back({ format, std::unique_ptr<Texture>(pTexture), bytes, _returnCount++ });
+	_idleBytes += bytes;
+	Evict();
+}
+
+void GPUPool::ReturnFramebuffer(Framebuffer* pFramebuffer)
+{
+	// Remember format and forget lease
+	auto iter = _leasedFramebuffers.find(pFramebuffer);
+	if (iter == _leasedFramebuffers.end() || _cleared)
+	{
+		if (iter != _leasedFramebuffers.end()) { _leasedFramebuffers.erase(iter); }
+		delete pFramebuffer;
+		return;
+	}
+	FramebufferFormat format = iter->second;
+	_leasedFramebuffers.erase(iter);
+
+	// Keep it as idle, size may have changed while leased
+	size_t bytes = EstimateBytes(*pFramebuffer, format);
+	_idleFramebuffers.push_back({ format, std::unique_ptr<Framebuffer>(pFramebuffer), bytes, _returnCount++ });
+	_idleBytes += bytes;
+	Evict();
+}
+
+void GPUPool::Evict()
+{
+	const size_t budget = (size_t)setup::GPU_POOL_IDLE_BUDGET_MB * 1024 * 1024;
+	while (_idleBytes > budget && !(_idleTextures.empty() && _idleFramebuffers.empty()))
+	{
+		// Evict object which has been returned earliest
+		bool evictTexture = _idleFramebuffers.empty()
+			|| (!_idleTextures.empty() && _idleTextures.front().returnIndex < _idleFramebuffers.front().returnIndex);
+		if (evictTexture)
+		{
+			_idleBytes -= _idleTextures.front().bytes;
+			_idleTextures.pop_front();
+		}
+		else
+		{
+			_idleBytes -= _idleFramebuffers.front().bytes;
+			_idleFramebuffers.pop_front();
+		}
+	}
+}
+
+size_t GPUPool::EstimateBytes(const Texture& rTexture, const TextureFormat& rFormat)
+{
+	// Linear filtered textures get mip maps (about one third on top)
+	size_t bytesPerPixel = (rFormat.internalFormat == GL_RGB || rFormat.internalFormat == GL_RGB8) ? 3 : 4;
+	size_t bytes = (size_t)rTexture.GetWidth() * (size_t)rTexture.GetHeight() * bytesPerPixel;
+	if (rFormat.filter == Texture::Filter::LINEAR)
+	{
+		bytes = (bytes * 4) / 3;
+	}
+	return bytes;
+}
+
+size_t GPUPool::EstimateBytes(const Framebuffer& rFramebuffer, const FramebufferFormat&)
+{
+	// Color attachment (assume padding to four bytes) and depth stencil renderbuffer
+	return (size_t)rFramebuffer.GetWidth() * (size_t)rFramebuffer.GetHeight() * (4 + 4);
+}
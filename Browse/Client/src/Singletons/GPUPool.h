@@ -0,0 +1,135 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+// Singleton which recycles textures and framebuffers. Leased objects are
+// returned to the pool when their last shared pointer is released and handed
+// out again for a lease with same size and format, so no reallocation on GPU
+// is necessary. Idle objects are evicted least recently used first when they
+// exceed the budget. Must be used from the thread owning the OpenGL context.
+
+#ifndef GPUPOOL_H_
+#define GPUPOOL_H_
+
+#include "src/Utils/Texture.h"
+#include "src/Utils/Framebuffer.h"
+#include <memory>
+#include <list>
+#include <map>
+#include <string>
+
+class GPUPool
+{
+public:
+
+	// Get instance
+	static GPUPool& instance()
+	{
+		static GPUPool _instance;
+		return _instance;
+	}
+
+	// Destructor
+	~GPUPool() {}
+
+	// Lease texture with allocated storage
+	std::shared_ptr<Texture> LeaseTexture(
+		int width,
+		int height,
+		GLenum internalFormat,
+		Texture::Filter filter,
+		Texture::Wrap wrap);
+
+	// Lease framebuffer with one color attachment
+	std::shared_ptr<Framebuffer> LeaseFramebuffer(
+		int width,
+		int height,
+		Framebuffer::ColorFormat colorFormat,
+		bool clampToBorder = false);
+
+	// Delete idle objects and stop recycling. Must be called before OpenGL context is destroyed
+	void Clear();
+
+	// Estimation of bytes occupied on GPU by leased and by idle objects
+	size_t GetLiveBytes() const;
+	size_t GetIdleBytes() const { return _idleBytes; }
+
+	// Count of leased and idle objects
+	unsigned int GetLiveCount() const { return (unsigned int)(_leasedTextures.size() + _leasedFramebuffers.size()); }
+	unsigned int GetIdleCount() const { return (unsigned int)(_idleTextures.size() + _idleFramebuffers.size()); }
+
+	// Count of leases served from idle objects and of new allocations
+	unsigned int GetRecycledCount() const { return _recycledCount; }
+	unsigned int GetAllocatedCount() const { return _allocatedCount; }
+
+	// Text for debug view
+	std::string GetReport() const;
+
+private:
+
+	// Parameters of texture which are not queried from it
+	struct TextureFormat
+	{
+		GLenum internalFormat;
+		Texture::Filter filter;
+		Texture::Wrap wrap;
+	};
+
+	// Parameters of framebuffer which are not queried from it
+	struct FramebufferFormat
+	{
+		Framebuffer::ColorFormat colorFormat;
+		bool clampToBorder;
+	};
+
+	// Idle objects, least recently returned at front
+	struct IdleTexture
+	{
+		TextureFormat format;
+		std::unique_ptr<Texture> upTexture;
+		size_t bytes;
+		unsigned long long returnIndex;
+	};
+	struct IdleFramebuffer
+	{
+		FramebufferFormat format;
+		std::unique_ptr<Framebuffer> upFramebuffer;
+		size_t bytes;
+		unsigned long long returnIndex;
+	};
+
+	// Called by deleter of shared pointers
+	void ReturnTexture(Texture* pTexture);
+	void ReturnFramebuffer(Framebuffer* pFramebuffer);
+
+	// Evict idle objects until they fit into budget
+	void Evict();
+
+	// Estimations of occupied bytes
+	static size_t EstimateBytes(const Texture& rTexture, const TextureFormat& rFormat);
+	static size_t EstimateBytes(const Framebuffer& rFramebuffer, const FramebufferFormat& rFormat);
+
+	// Leased objects
+	std::map<Texture*, TextureFormat> _leasedTextures;
+	std::map<Framebuffer*, FramebufferFormat> _leasedFramebuffers;
+
+	// Idle objects
+	std::list<IdleTexture> _idleTextures;
+	std::list<IdleFramebuffer> _idleFramebuffers;
+	size_t _idleBytes = 0;
+	unsigned long long _returnCount = 0;
+
+	// Statistics
+	unsigned int _recycledCount = 0;
+	unsigned int _allocatedCount = 0;
+
+	// Whether pool has been cleared
+	bool _cleared = false;
+
+	// Private copy / asignment constructors
+	GPUPool() {}
+	GPUPool(const GPUPool&) {}
+	GPUPool& operator = (const GPUPool &) { return *this; }
+};
+
+#endif // GPUPOOL_H_
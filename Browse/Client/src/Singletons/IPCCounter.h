@@ -0,0 +1,51 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+// Singleton which counts messages between browser process and renderer
+// processes, as seen from browser process. Execution of JavaScript counts as
+// sent message. Used by benchmark to catch regressions in chattiness.
+
+#ifndef IPCCOUNTER_H_
+#define IPCCOUNTER_H_
+
+#include <atomic>
+
+class IPCCounter
+{
+public:
+
+	// Get instance
+	static IPCCounter& instance()
+	{
+		static IPCCounter _instance;
+		return _instance;
+	}
+
+	// Destructor
+	~IPCCounter() {}
+
+	// Count message
+	void CountSent() { _sentCount++; }
+	void CountJavaScript() { _javaScriptCount++; }
+	void CountReceived() { _receivedCount++; }
+
+	// Counts since start
+	unsigned int GetSentCount() const { return _sentCount; }
+	unsigned int GetJavaScriptCount() const { return _javaScriptCount; }
+	unsigned int GetReceivedCount() const { return _receivedCount; }
+
+private:
+
+	// Counts
+	std::atomic<unsigned int> _sentCount{ 0 };
+	std::atomic<unsigned int> _javaScriptCount{ 0 };
+	std::atomic<unsigned int> _receivedCount{ 0 };
+
+	// Private copy / asignment constructors
+	IPCCounter() {}
+	IPCCounter(const IPCCounter&) {}
+	IPCCounter& operator = (const IPCCounter &) { return *this; }
+};
+
+#endif // IPCCOUNTER_H_
@@ -5,6 +5,7 @@
 
 #include "JSMailer.h"
 #include "src/CEF/Handler.h"
+#include "src/Singletons/TelemetryBus.h"
 
 void JSMailer::SetHandler(Handler* pHandler)
 {
@@ -13,8 +14,23 @@ void JSMailer::SetHandler(Handler* pHandler)
 
 void JSMailer::Send(std::string message)
 {
-	if (instance()._pHandler != nullptr)
+	TelemetryBus::instance().Push(TelemetryChannel::JAVASCRIPT, message);
+}
+
+void JSMailer::Subscribe(int browserId)
+{
+	_subscribers.insert(browserId);
+}
+
+void JSMailer::Unsubscribe(int browserId)
+{
+	_subscribers.erase(browserId);
+}
+
+void JSMailer::Transmit(const std::vector<std::string>& rMessages)
+{
+	if (_pHandler != nullptr && !_subscribers.empty())
 	{
-		instance()._pHandler->SendToJSLoggingMediator(message);
+		_pHandler->SendToJSLoggingMediator(rMessages, _subscribers);
 	}
 }
\ No newline at end of file
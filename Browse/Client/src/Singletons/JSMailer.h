@@ -5,6 +5,8 @@
 // Singleton which sends messages to JavaScript logging mediator.
 
 #include <string>
+#include <vector>
+#include <set>
 
 // Forward declaration
 class Handler;
@@ -26,11 +28,24 @@ public:
 	// Set handler (should be only called by handler itself)
 	void SetHandler(Handler* pHandler);
 
-	// Send message to JavaScript logging mediator
+	// Send message to JavaScript logging mediator. It is queued in telemetry bus and transmitted at its next flush
 	void Send(std::string message);
 
+	// Browsers whose logging mediator has a registered log function. Only those receive messages
+	void Subscribe(int browserId);
+	void Unsubscribe(int browserId);
+
 private:
 
+	// Telemetry bus transmits queued messages
+	friend class TelemetryBus;
+
+	// Actually send batch of messages to subscribed browsers
+	void Transmit(const std::vector<std::string>& rMessages);
+
+	// Identifiers of subscribed browsers
+	std::set<int> _subscribers;
+
 	// Pointer to handler which can call into JavaScript
 	Handler* _pHandler = nullptr;
 
@@ -4,10 +4,10 @@
 //============================================================================
 
 #include "LabStream.h"
+#include "src/Global.h"
 #include "src/Setup.h"
+#include "src/Singletons/WorkerPool.h"
 #include "externals/liblsl/include/lsl_cpp.h"
-#include <iostream>
-#include <chrono>
 
 LabStream::LabStream()
 {
@@ -22,54 +22,10 @@ LabStream::LabStream()
             setup::LAB_STREAM_OUTPUT_SOURCE_ID));
     _upStreamOutlet = std::unique_ptr<lsl::stream_outlet>(new lsl::stream_outlet(*(_upStreamInfo.get())));
 
-    // Setting up receiving
-    std::mutex* pMutex = &_inputMutex; // pointer to mutex because reference of private member is not allowed
-    std::vector<std::string>* pBuffer = &_inputBuffer; // same for buffer itself
-    _upReceiverThread = std::unique_ptr<std::thread>(new std::thread([pMutex, pBuffer]() // pass copies of pointers to members
-    {
-        // Receive data
-        bool connected = false;
-        std::vector<lsl::stream_info> streamInfos;
-		std::unique_ptr<lsl::stream_inlet> upStreamInlet;
-        std::vector<std::string> localBuffer;
-        while(true)
-        {
-            // Build up connection if necessary
-            if(!connected)
-            {
-                streamInfos.clear();
-                while (streamInfos.empty())
-                {
-                    streamInfos = lsl::resolve_stream("name", setup::LAB_STREAM_INPUT_NAME); // search for stream with certain name
-                    std::this_thread::sleep_for(std::chrono::seconds(1)); // do it every second
-                }
-
-                // Take first stream you can find
-                upStreamInlet = std::unique_ptr<lsl::stream_inlet>(new lsl::stream_inlet(streamInfos[0]));
-                connected = true;
-            }
-
-            // Listen for input
-            try
-            {
-				upStreamInlet->pull_sample(localBuffer);
-            }
-            catch(lsl::lost_error e)
-            {
-                // Connection lost, do connection again
-                connected = false;
-                continue;
-            }
-
-            // Write it to shared memory
-            pMutex->lock();
-            (*pBuffer).insert(pBuffer->end(), localBuffer.begin(), localBuffer.end()); // append values to shared buffer
-            pMutex->unlock();
-
-            // Clear local buffer
-            localBuffer.clear();
-        }
-    }));
+    // Setting up receiving, which is done by worker pool. Resolver searches for input stream in background
+    _spReceiver = std::make_shared<Receiver>();
+    _spReceiver->upResolver = std::unique_ptr<lsl::continuous_resolver>(
+        new lsl::continuous_resolver("name", setup::LAB_STREAM_INPUT_NAME));
 }
 
 LabStream::~LabStream()
@@ -77,9 +33,14 @@ LabStream::~LabStream()
     // Nothing to do
 }
 
-void LabStream::Send(std::string data)
+void LabStream::Send(std::string data, double timestamp)
 {
-    _upStreamOutlet->push_sample(&data);
+    _upStreamOutlet->push_sample(&data, timestamp);
+}
+
+double LabStream::GetLocalClock()
+{
+    return lsl::local_clock();
 }
 
 std::vector<std::string> LabStream::Poll()
@@ -87,12 +48,65 @@ std::vector<std::string> LabStream::Poll()
     // Used as return value
     std::vector<std::string> input;
 
-    // Read values from thread
-    _inputMutex.lock();
-    input = _inputBuffer;
-    _inputBuffer.clear(); // clear shared buffer
-    _inputMutex.unlock();
+    // Read values received by job
+    _spReceiver->inputMutex.lock();
+    input.swap(_spReceiver->inputBuffer); // clear shared buffer
+    _spReceiver->inputMutex.unlock();
+
+    // Start next job when previous one is done. Receiver is kept alive by job
+    if (!_spReceiver->busy.exchange(true))
+    {
+        std::shared_ptr<Receiver> spReceiver = _spReceiver;
+        WorkerPool::instance().Run([spReceiver]()
+        {
+            // Job must be startable again, also when receiving throws
+            try
+            {
+                Receive(*spReceiver);
+            }
+            catch (...)
+            {
+                spReceiver->busy = false;
+                throw; // logged by worker pool
+            }
+            spReceiver->busy = false;
+        });
+    }
 
     // Return received values
     return input;
 }
+
+void LabStream::Receive(Receiver& rReceiver)
+{
+    // Build up connection if necessary. Results of resolver are available without waiting, looked up in intervals
+    if (!rReceiver.upStreamInlet)
+    {
+        double time = lsl::local_clock();
+        if (time - rReceiver.lastResolveTime < LAB_STREAM_RESOLVE_INTERVAL) { return; }
+        rReceiver.lastResolveTime = time;
+        std::vector<lsl::stream_info> streamInfos = rReceiver.upResolver->results(); // streams with certain name
+        if (streamInfos.empty()) { return; }
+
+        // Take first stream you can find
+        rReceiver.upStreamInlet = std::unique_ptr<lsl::stream_inlet>(new lsl::stream_inlet(streamInfos[0]));
+    }
+
+    // Pull available samples without waiting
+    std::vector<std::string> sample;
+    try
+    {
+        while (rReceiver.upStreamInlet->pull_sample(sample, 0.0) != 0.0)
+        {
+            // Write it to shared memory
+            rReceiver.inputMutex.lock();
+            rReceiver.inputBuffer.insert(rReceiver.inputBuffer.end(), sample.begin(), sample.end()); // append values to shared buffer
+            rReceiver.inputMutex.unlock();
+        }
+    }
+    catch (lsl::lost_error e)
+    {
+        // Connection lost, do connection again
+        rReceiver.upStreamInlet.reset();
+    }
+}
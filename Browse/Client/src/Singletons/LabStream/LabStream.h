@@ -3,12 +3,15 @@
 // Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
 //============================================================================
 // Simple communiction with LabStreamingLayer. Enables one to send and receive
-// strings, called events.
+// strings, called events. Receiving is done by jobs of the worker pool, which
+// are started by polling. Input stream is discovered by a resolver running in
+// background of lab streaming layer, so jobs never wait for the network.
 
 #ifndef LABSTREAM_H_
 #define LABSTREAM_H_
 
-#include <thread>
+#include <atomic>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <vector>
@@ -18,6 +21,8 @@ namespace lsl
 {
 	class stream_info;
 	class stream_outlet;
+	class stream_inlet;
+	class continuous_resolver;
 }
 
 class LabStream
@@ -30,20 +35,35 @@ public:
 	// Destructor
 	virtual ~LabStream();
 
-	// Send event
-	void Send(std::string data);
+	// Send event. Timestamp in lab streaming layer clock, zero means now
+	void Send(std::string data, double timestamp = 0.0);
 
-	// Poll received events (clears events)
+	// Current time of lab streaming layer clock
+	static double GetLocalClock();
+
+	// Poll received events (clears events). Starts job to receive further events
 	std::vector<std::string> Poll();
 
 private:
 
+	// State of receiving, shared with job of worker pool
+	struct Receiver
+	{
+		std::atomic<bool> busy{ false }; // whether job is queued or running
+		std::unique_ptr<lsl::continuous_resolver> upResolver; // only accessed by job after construction
+		std::unique_ptr<lsl::stream_inlet> upStreamInlet; // only accessed by job
+		double lastResolveTime = 0.0; // only accessed by job
+		std::mutex inputMutex;
+		std::vector<std::string> inputBuffer;
+	};
+
+	// Receive available events or look up input stream found by resolver. Executed by worker
+	static void Receive(Receiver& rReceiver);
+
 	// Members
-	std::unique_ptr<std::thread> _upReceiverThread;
 	std::unique_ptr<lsl::stream_info> _upStreamInfo;
 	std::unique_ptr<lsl::stream_outlet> _upStreamOutlet;
-	std::mutex _inputMutex;
-	std::vector<std::string> _inputBuffer;
+	std::shared_ptr<Receiver> _spReceiver;
 };
 
 #endif // LABSTREAM_H_
\ No newline at end of file
@@ -4,10 +4,16 @@
 //============================================================================
 
 #include "LabStreamMailer.h"
+#include "src/Singletons/TelemetryBus.h"
 
 void LabStreamMailer::Send(std::string message)
 {
-	_labStream.Send(message);
+	TelemetryBus::instance().Push(TelemetryChannel::LAB_STREAM, message);
+}
+
+void LabStreamMailer::Transmit(const std::string& rMessage, double timestamp)
+{
+	_labStream.Send(rMessage, timestamp);
 }
 
 void LabStreamMailer::Update()
@@ -9,6 +9,7 @@
 
 #include "src/Singletons/LabStream/LabStream.h"
 #include <functional>
+#include <memory>
 
 // Class to abstract callbacks when message is received
 class LabStreamCallback
@@ -51,7 +52,7 @@ public:
 	// Destructor
 	~LabStreamMailer() {}
 
-	// Send message
+	// Send message. It is queued in telemetry bus and transmitted at its next flush
 	void Send(std::string message);
 
 	// Someone has to poll this so new messages are read and sent to callbacks. Should be done by master.
@@ -62,6 +63,12 @@ public:
 
 private:
 
+	// Telemetry bus transmits queued messages
+	friend class TelemetryBus;
+
+	// Actually send message into lab streaming layer, with timestamp of original send call
+	void Transmit(const std::string& rMessage, double timestamp);
+
 	// LabStreamingLayer connection
 	LabStream _labStream;
 
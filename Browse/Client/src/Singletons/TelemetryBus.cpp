@@ -0,0 +1,77 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+
+#include "TelemetryBus.h"
+#include "src/Singletons/JSMailer.h"
+#include "src/Singletons/LabStreamMailer.h"
+#include "src/Setup.h"
+
+TelemetryBus::TelemetryBus()
+{
+	// Allocate ring and message memory up front
+	_ring.resize(setup::TELEMETRY_RING_CAPACITY);
+	for (auto& rEvent : _ring)
+	{
+		rEvent.message.reserve(setup::TELEMETRY_MESSAGE_RESERVE);
+	}
+	_javaScriptBatch.reserve(setup::TELEMETRY_RING_CAPACITY);
+}
+
+bool TelemetryBus::Push(TelemetryChannel channel, const std::string& rMessage)
+{
+	// Drop event when ring is full
+	if (_count >= (unsigned int)_ring.size())
+	{
+		_droppedCount++;
+		return false;
+	}
+
+	// Write event into next free slot
+	Event& rEvent = _ring[(_head + _count) % _ring.size()];
+	rEvent.channel = channel;
+	rEvent.message.assign(rMessage);
+	rEvent.timestamp = (channel == TelemetryChannel::LAB_STREAM) ? LabStream::GetLocalClock() : 0.0;
+	_count++;
+	return true;
+}
+
+void TelemetryBus::Update(float tpf)
+{
+	_timeSinceFlush += tpf;
+	if (_timeSinceFlush >= 1.f / setup::TELEMETRY_FLUSH_RATE)
+	{
+		Flush();
+	}
+}
+
+void TelemetryBus::Flush()
+{
+	_timeSinceFlush = 0.f;
+	if (_count == 0) { return; }
+
+	// Go over events, send lab streaming layer events directly and collect JavaScript ones
+	_javaScriptBatch.clear();
+	for (unsigned int i = 0; i < _count; i++)
+	{
+		const Event& rEvent = _ring[(_head + i) % _ring.size()];
+		switch (rEvent.channel)
+		{
+		case TelemetryChannel::JAVASCRIPT:
+			_javaScriptBatch.push_back(rEvent.message);
+			break;
+		case TelemetryChannel::LAB_STREAM:
+			LabStreamMailer::instance().Transmit(rEvent.message, rEvent.timestamp);
+			break;
+		}
+	}
+	_head = (_head + _count) % _ring.size();
+	_count = 0;
+
+	// Send JavaScript events as one batch
+	if (!_javaScriptBatch.empty())
+	{
+		JSMailer::instance().Transmit(_javaScriptBatch);
+	}
+}
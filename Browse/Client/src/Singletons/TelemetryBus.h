@@ -0,0 +1,82 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+// Singleton which collects interaction telemetry in a preallocated ring and
+// flushes it in batches at a fixed rate. JSMailer and LabStreamMailer push
+// their messages here instead of sending them on the spot. When the ring is
+// full, new events are dropped and counted, so logging never stalls input.
+// Must be used from the main thread only.
+
+#ifndef TELEMETRYBUS_H_
+#define TELEMETRYBUS_H_
+
+#include <string>
+#include <vector>
+
+// Channel of event, decides receiver at flush
+enum class TelemetryChannel
+{
+	JAVASCRIPT, LAB_STREAM
+};
+
+class TelemetryBus
+{
+public:
+
+	// Get instance
+	static TelemetryBus& instance()
+	{
+		static TelemetryBus _instance;
+		return _instance;
+	}
+
+	// Destructor
+	~TelemetryBus() {}
+
+	// Push event into ring. Returns false if event was dropped because ring is full
+	bool Push(TelemetryChannel channel, const std::string& rMessage);
+
+	// Flushes ring when flush interval elapsed. Should be called once per frame by master
+	void Update(float tpf);
+
+	// Immediately send all pending events
+	void Flush();
+
+	// Count of events dropped since start
+	unsigned int GetDroppedCount() const { return _droppedCount; }
+
+	// Count of events waiting for next flush
+	unsigned int GetPendingCount() const { return _count; }
+
+private:
+
+	// Event in ring
+	struct Event
+	{
+		TelemetryChannel channel;
+		std::string message;
+		double timestamp; // lab streaming layer clock at push
+	};
+
+	// Ring of events, allocated once
+	std::vector<Event> _ring;
+	unsigned int _head = 0; // index of oldest event
+	unsigned int _count = 0;
+
+	// Dropped events
+	unsigned int _droppedCount = 0;
+
+	// Time since last flush
+	float _timeSinceFlush = 0.f;
+
+	// Batch of JavaScript messages, kept to reuse its memory
+	std::vector<std::string> _javaScriptBatch;
+
+	// Private copy / asignment constructors
+	TelemetryBus();
+	TelemetryBus(const TelemetryBus&) {}
+	TelemetryBus& operator = (const TelemetryBus &) { return *this; }
+};
+
+#endif // TELEMETRYBUS_H_
@@ -0,0 +1,171 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+
+#include "WorkerPool.h"
+#include "src/Global.h"
+#include "src/Setup.h"
+#include "src/Utils/Logger.h"
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+WorkerPool::WorkerPool()
+{
+	// Start workers
+	unsigned int count = std::max(1u, setup::WORKER_POOL_THREAD_COUNT);
+	for (unsigned int i = 0; i < count; i++)
+	{
+		_workers.push_back(std::thread(&WorkerPool::WorkerLoop, this));
+	}
+}
+
+void WorkerPool::RunInSequence(std::shared_ptr<Sequence> spSequence, std::function<void()> job)
+{
+	// Take ticket, job is skipped when another one is queued until it runs
+	unsigned int ticket = ++spSequence->_latestTicket;
+	Enqueue([spSequence, ticket, job]()
+	{
+		std::lock_guard<std::mutex> lock(spSequence->_mutex);
+		if (spSequence->_latestTicket.load() == ticket)
+		{
+			job();
+		}
+	});
+}
+
+void WorkerPool::PushMainThreadJob(std::function<void()> job)
+{
+	std::lock_guard<std::mutex> lock(_mainThreadJobsMutex);
+	_mainThreadJobs.push_back({ job, Clock::now() });
+}
+
+void WorkerPool::Update()
+{
+	const Clock::time_point start = Clock::now();
+	const auto budget = std::chrono::duration<float, std::milli>(setup::WORKER_POOL_MAIN_THREAD_BUDGET);
+	while (true)
+	{
+		// Take next job
+		Job job;
+		{
+			std::lock_guard<std::mutex> lock(_mainThreadJobsMutex);
+			if (_mainThreadJobs.empty()) { break; }
+			job = std::move(_mainThreadJobs.front());
+			_mainThreadJobs.pop_front();
+		}
+
+		// Execute it. Remaining jobs are left for next frame when budget is spent
+		_mainThreadLatency.Add(job.queued);
+		Execute(job.function);
+		if (Clock::now() - start >= budget) { break; }
+	}
+}
+
+void WorkerPool::Stop()
+{
+	// Let workers finish queued jobs
+	{
+		std::lock_guard<std::mutex> lock(_jobsMutex);
+		if (_stopped) { return; }
+		_stopped = true;
+	}
+	_jobsCondition.notify_all();
+	for (auto& rWorker : _workers)
+	{
+		rWorker.join();
+	}
+	_workers.clear();
+
+	// Drop main thread jobs, as objects they refer to may be gone
+	std::lock_guard<std::mutex> lock(_mainThreadJobsMutex);
+	_mainThreadJobs.clear();
+}
+
+unsigned int WorkerPool::GetQueueDepth() const
+{
+	std::lock_guard<std::mutex> lock(_jobsMutex);
+	return (unsigned int)_jobs.size();
+}
+
+unsigned int WorkerPool::GetMainThreadQueueDepth() const
+{
+	std::lock_guard<std::mutex> lock(_mainThreadJobsMutex);
+	return (unsigned int)_mainThreadJobs.size();
+}
+
+std::string WorkerPool::GetReport() const
+{
+	Latency workerLatency;
+	{
+		std::lock_guard<std::mutex> lock(_jobsMutex);
+		workerLatency = _workerLatency;
+	}
+	std::stringstream report;
+	report << std::fixed << std::setprecision(2)
+		<< "Queued: " << GetQueueDepth() << " / " << GetMainThreadQueueDepth() << "\n"
+		<< "Wait: " << workerLatency.average << " ms (max " << workerLatency.max << ")\n"
+		<< "Main thread wait: " << _mainThreadLatency.average << " ms (max " << _mainThreadLatency.max << ")\n";
+	return report.str();
+}
+
+void WorkerPool::Latency::Add(Clock::time_point queued)
+{
+	double wait = std::chrono::duration<double, std::milli>(Clock::now() - queued).count();
+	average = (count == 0) ? wait : ((1.0 - WORKER_POOL_AVERAGE_WEIGHT) * average) + (WORKER_POOL_AVERAGE_WEIGHT * wait);
+	max = std::max(max, wait);
+	count++;
+}
+
+void WorkerPool::Enqueue(std::function<void()> job)
+{
+	{
+		std::lock_guard<std::mutex> lock(_jobsMutex);
+		if (!_stopped)
+		{
+			_jobs.push_back({ job, Clock::now() });
+			_jobsCondition.notify_one();
+			return;
+		}
+	}
+
+	// Execute on calling thread after pool has been stopped
+	Execute(job);
+}
+
+void WorkerPool::Execute(const std::function<void()>& rJob)
+{
+	try
+	{
+		rJob();
+	}
+	catch (const std::exception& e)
+	{
+		LogError("WorkerPool: Job failed: ", e.what());
+	}
+	catch (...)
+	{
+		LogError("WorkerPool: Job failed with unknown exception");
+	}
+}
+
+void WorkerPool::WorkerLoop()
+{
+	while (true)
+	{
+		// Wait for job
+		Job job;
+		{
+			std::unique_lock<std::mutex> lock(_jobsMutex);
+			_jobsCondition.wait(lock, [this] { return _stopped || !_jobs.empty(); });
+			if (_jobs.empty()) { return; } // stopped and nothing left
+			job = std::move(_jobs.front());
+			_jobs.pop_front();
+			_workerLatency.Add(job.queued);
+		}
+
+		// Execute it without holding the lock
+		Execute(job.function);
+	}
+}
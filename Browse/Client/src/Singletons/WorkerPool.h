@@ -0,0 +1,164 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+// Singleton with fixed count of worker threads for background work like file
+// writing. Results may be handed to a continuation, which is executed on the
+// main thread by Update within a time budget per frame, so it can touch the
+// OpenGL context and GUI. Other threads may push jobs for the main thread,
+// too. Waiting times of both queues are measured for the debug overlay.
+// Jobs are finished at Stop, pending main thread jobs are dropped.
+
+#ifndef WORKERPOOL_H_
+#define WORKERPOOL_H_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+class WorkerPool
+{
+public:
+
+	// Jobs which must not run concurrently and of which only the latest queued
+	// one is of interest, like writing of same file. Older queued jobs are skipped
+	class Sequence
+	{
+	private:
+
+		friend class WorkerPool;
+		std::mutex _mutex; // held while job of sequence runs
+		std::atomic<unsigned int> _latestTicket{ 0 };
+	};
+
+	// Get instance
+	static WorkerPool& instance()
+	{
+		static WorkerPool _instance;
+		return _instance;
+	}
+
+	// Destructor
+	~WorkerPool() { Stop(); }
+
+	// Run job on worker. Returns future of result
+	template <typename F>
+	std::future<typename std::result_of<F()>::type> Run(F job)
+	{
+		typedef typename std::result_of<F()>::type Result;
+		auto spTask = std::make_shared<std::packaged_task<Result()> >(job);
+		std::future<Result> future = spTask->get_future();
+		Enqueue([spTask]() { (*spTask)(); });
+		return future;
+	}
+
+	// Run job on worker and call continuation with its result on main thread. Continuation
+	// of job returning void takes no parameter. Continuation is skipped when job throws
+	template <typename F, typename C>
+	void Run(F job, C continuation)
+	{
+		RunWithContinuation(job, continuation, std::is_void<typename std::result_of<F()>::type>());
+	}
+
+	// Run job of sequence on worker
+	void RunInSequence(std::shared_ptr<Sequence> spSequence, std::function<void()> job);
+
+	// Execute job on main thread at next update. May be called from any thread
+	void PushMainThreadJob(std::function<void()> job);
+
+	// Execute main thread jobs until time budget is spent, at least one. Called once per frame by master
+	void Update();
+
+	// Finish queued jobs and join workers. Later jobs are executed on calling thread
+	void Stop();
+
+	// Count of jobs waiting for worker and for main thread
+	unsigned int GetQueueDepth() const;
+	unsigned int GetMainThreadQueueDepth() const;
+
+	// Text for debug view
+	std::string GetReport() const;
+
+private:
+
+	typedef std::chrono::steady_clock Clock;
+
+	// Job with time of queueing
+	struct Job
+	{
+		std::function<void()> function;
+		Clock::time_point queued;
+	};
+
+	// Waiting time of jobs in milliseconds
+	struct Latency
+	{
+		double average = 0.0;
+		double max = 0.0;
+		unsigned long long count = 0;
+		void Add(Clock::time_point queued);
+	};
+
+	// Run job with result on worker and push continuation with it
+	template <typename F, typename C>
+	void RunWithContinuation(F job, C continuation, std::false_type)
+	{
+		typedef typename std::result_of<F()>::type Result;
+		Enqueue([this, job, continuation]() mutable
+		{
+			std::shared_ptr<Result> spResult = std::make_shared<Result>(job());
+			PushMainThreadJob([continuation, spResult]() mutable { continuation(std::move(*spResult)); });
+		});
+	}
+
+	// Run job without result on worker and push continuation
+	template <typename F, typename C>
+	void RunWithContinuation(F job, C continuation, std::true_type)
+	{
+		Enqueue([this, job, continuation]() mutable
+		{
+			job();
+			PushMainThreadJob(continuation);
+		});
+	}
+
+	// Queue job for workers
+	void Enqueue(std::function<void()> job);
+
+	// Execute job, exceptions are logged instead of terminating worker or main thread
+	static void Execute(const std::function<void()>& rJob);
+
+	// Loop of worker thread
+	void WorkerLoop();
+
+	// Workers and their queue
+	std::vector<std::thread> _workers;
+	std::deque<Job> _jobs;
+	mutable std::mutex _jobsMutex;
+	std::condition_variable _jobsCondition;
+	bool _stopped = false;
+
+	// Queue of main thread
+	std::deque<Job> _mainThreadJobs;
+	mutable std::mutex _mainThreadJobsMutex;
+
+	// Statistics, worker latency is guarded by mutex of jobs
+	Latency _workerLatency;
+	Latency _mainThreadLatency;
+
+	// Private copy / asignment constructors
+	WorkerPool();
+	WorkerPool(const WorkerPool&) {}
+	WorkerPool& operator = (const WorkerPool &) { return *this; }
+};
+
+#endif // WORKERPOOL_H_
@@ -13,6 +13,7 @@ BookmarkManager::BookmarkManager(std::string userDirectory)
 {
 	// Fill members
 	_fullpathBookmarks = userDirectory + BOOKMARKS_FILE;
+	_spSaveSequence = std::make_shared<WorkerPool::Sequence>();
 
 	// Load existing bookmarks
 	if (!LoadBookmarks()) { LogInfo("BookmarkManager: No bookmarks file found or parsing error"); }
@@ -31,7 +32,7 @@ bool BookmarkManager::AddBookmark(std::string URL)
 	// Check wether element was new for the set
 	if (result.second) // second element in pair indicates whether value was new
 	{
-		if (!SaveBoomarks()) { LogInfo("BookmarkManager: Failed to save bookmarks"); }
+		SaveBookmarks();
 		return true;
 	}
 	else
@@ -48,7 +49,7 @@ bool BookmarkManager::RemoveBookmark(std::string URL)
 	// Check wether element was new for the set
 	if (result > 0) // erase returns count of erased elements
 	{
-		if (!SaveBoomarks()) { LogInfo("BookmarkManager: Failed to save bookmarks"); }
+		SaveBookmarks();
 		return true;
 	}
 	else
@@ -75,7 +76,17 @@ bool BookmarkManager::IsBookmark(std::string URL) const
 	return _bookmarks.find(URL) != _bookmarks.end();
 }
 
-bool BookmarkManager::SaveBoomarks() const
+void BookmarkManager::SaveBookmarks() const
+{
+	std::string fullpath = _fullpathBookmarks;
+	std::set<std::string> bookmarks = _bookmarks;
+	WorkerPool::instance().RunInSequence(_spSaveSequence, [fullpath, bookmarks]()
+	{
+		if (!WriteBookmarks(fullpath, bookmarks)) { LogInfo("BookmarkManager: Failed to save bookmarks"); }
+	});
+}
+
+bool BookmarkManager::WriteBookmarks(const std::string& rFullpath, const std::set<std::string>& rBookmarks)
 {
 	// Create document
 	tinyxml2::XMLDocument doc;
@@ -86,7 +97,7 @@ bool BookmarkManager::SaveBoomarks() const
 
 	// Insert bookmarks
     tinyxml2::XMLElement* previousChild = NULL;
-	for (const auto& rBookmark : _bookmarks)
+	for (const auto& rBookmark : rBookmarks)
 	{
 		// Insert bookmark
 		tinyxml2::XMLElement* pElement = doc.NewElement("bookmark");
@@ -107,7 +118,7 @@ bool BookmarkManager::SaveBoomarks() const
 	}
 
 	// Try to save file
-	tinyxml2::XMLError result = doc.SaveFile(_fullpathBookmarks.c_str());
+	tinyxml2::XMLError result = doc.SaveFile(rFullpath.c_str());
 
 	// Return whether successful
 	return (result == tinyxml2::XMLError::XML_SUCCESS);
@@ -2,14 +2,16 @@
 // Distributed under the Apache License, Version 2.0.
 // Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
 //============================================================================
-// Manager of bookmarks.
+// Manager of bookmarks. Bookmarks file is written by the worker pool.
 
 #ifndef BOOKMARKMANAGER_H_
 #define BOOKMARKMANAGER_H_
 
+#include "src/Singletons/WorkerPool.h"
 #include <string>
 #include <set>
 #include <vector>
+#include <memory>
 
 class BookmarkManager
 {
@@ -38,8 +40,11 @@ public:
 
 private:
 
-	// Save bookmarks to hard disk. Returns whether successful
-	bool SaveBoomarks() const;
+	// Save copy of bookmarks to hard disk in background
+	void SaveBookmarks() const;
+
+	// Write bookmarks to hard disk. Called by worker. Returns whether successful
+	static bool WriteBookmarks(const std::string& rFullpath, const std::set<std::string>& rBookmarks);
 
 	// Load bookmarks from hard disk. Returns whether successful
 	bool LoadBookmarks();
@@ -50,6 +55,9 @@ private:
 	// Fullpath to bookmarks file
 	std::string _fullpathBookmarks;
 
+	// Writing of bookmarks file, only latest state is written
+	std::shared_ptr<WorkerPool::Sequence> _spSaveSequence;
+
 };
 
 #endif // BOOKMARKMANAGER_H_
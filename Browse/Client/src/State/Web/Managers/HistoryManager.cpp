@@ -14,6 +14,7 @@ HistoryManager::HistoryManager(std::string userDirectory)
 {
 	// Fill members
 	_fullpathHistory = userDirectory + HISTORY_FILE;
+	_spSaveSequence = std::make_shared<WorkerPool::Sequence>();
 
 	// Load existing history
 	if (!LoadHistory()) { LogInfo("HistoryManager: No history file found or parsing error"); }
@@ -36,75 +37,22 @@ void HistoryManager::AddPage(Page page)
 	// Add to vector storing pages
 	_pages.push_front(page);
 
-	// Try to open XML file
-	tinyxml2::XMLDocument doc;
-	tinyxml2::XMLError result = doc.LoadFile(_fullpathHistory.c_str());
-
-	// Try to create XML file on failure
-	tinyxml2::XMLNode* pRoot = NULL;
-	if (result != tinyxml2::XMLError::XML_SUCCESS)
-	{
-		// Create and insert root
-		pRoot = doc.NewElement("history");
-		doc.InsertFirstChild(pRoot);
-
-		// Try to save file
-		result = doc.SaveFile(_fullpathHistory.c_str());
-
-		// Return at failure
-		if (result != tinyxml2::XMLError::XML_SUCCESS)
-		{
-			LogInfo("HistoryManager: Failed to create history file");
-			return;
-		}
-	}
-	else
+	// Delete older pages if too many pages have been saved
+	if (_pages.size() > setup::HISTORY_MAX_PAGE_COUNT)
 	{
-        // Fetch root node when file exists
-		pRoot = doc.FirstChild();
+		_pages.resize(setup::HISTORY_MAX_PAGE_COUNT);
 	}
 
-	// Check whether root exists
-	if (pRoot == NULL)
+	// Save copy of pages in background
+	std::string fullpath = _fullpathHistory;
+	std::deque<Page> pages = _pages;
+	WorkerPool::instance().RunInSequence(_spSaveSequence, [fullpath, pages]()
 	{
-		LogInfo("HistoryManager: Failed to add page to history");
-		return;
-	}
-
-	// Create element for page
-	tinyxml2::XMLElement* pElement = doc.NewElement("page");
-	pElement->SetAttribute("url", page.URL.c_str());
-	pElement->SetAttribute("title", page.title.c_str());
-
-	// Append to top of XML file
-	pRoot->InsertFirstChild(pElement);
-
-	// Check length of vector and delete history if too many pages have been saved
-	int pagesSize = (int)_pages.size();
-    if (pagesSize > (int)setup::HISTORY_MAX_PAGE_COUNT)
-	{
-		// Count of pages that should be deleted
-		int deleteCount = pagesSize - setup::HISTORY_MAX_PAGE_COUNT;
-
-		// Delete older ones from vector
-		_pages.erase(_pages.begin(), _pages.begin() + deleteCount);
-
-		// Delete older ones from XML file
-		for (int i = 0; i < deleteCount; i++)
+		if (!SaveHistory(fullpath, pages))
 		{
-			auto pLastChild = pRoot->LastChild();
-			pRoot->DeleteChild(pLastChild);
+			LogInfo("HistoryManager: Failed to save history file");
 		}
-	}
-
-	// Try to save file
-	result = doc.SaveFile(_fullpathHistory.c_str());
-
-	// Log at failure
-	if (result != tinyxml2::XMLError::XML_SUCCESS)
-	{
-		LogInfo("HistoryManager: Failed to save history file");
-	}
+	});
 }
 
 std::deque<HistoryManager::Page> HistoryManager::GetHistory() const
@@ -184,6 +132,28 @@ bool HistoryManager::LoadHistory()
 	return true;
 }
 
+bool HistoryManager::SaveHistory(const std::string& rFullpath, const std::deque<Page>& rPages)
+{
+	// Create document
+	tinyxml2::XMLDocument doc;
+
+	// Create and insert root
+	tinyxml2::XMLNode* pRoot = doc.NewElement("history");
+	doc.InsertFirstChild(pRoot);
+
+	// Insert pages, newest first
+	for (const auto& rPage : rPages)
+	{
+		tinyxml2::XMLElement* pElement = doc.NewElement("page");
+		pElement->SetAttribute("url", rPage.URL.c_str());
+		pElement->SetAttribute("title", rPage.title.c_str());
+		pRoot->InsertEndChild(pElement);
+	}
+
+	// Try to save file
+	return doc.SaveFile(rFullpath.c_str()) == tinyxml2::XMLError::XML_SUCCESS;
+}
+
 bool HistoryManager::FilterPage(Page page) const
 {
 	// Go over filter list and test for equality
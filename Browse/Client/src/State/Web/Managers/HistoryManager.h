@@ -2,14 +2,17 @@
 // Distributed under the Apache License, Version 2.0.
 // Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
 //============================================================================
-// Manager of history.
+// Manager of history. History file is written by the worker pool, so adding
+// a page does not wait for hard disk.
 
 #ifndef HISTORYMANAGER_H_
 #define HISTORYMANAGER_H_
 
+#include "src/Singletons/WorkerPool.h"
 #include <string>
 #include <deque>
 #include <vector>
+#include <memory>
 
 class HistoryManager
 {
@@ -46,6 +49,9 @@ private:
 	// Load history from hard disk. Returns whether successful
 	bool LoadHistory();
 
+	// Save pages to hard disk. Called by worker. Returns whether successful
+	static bool SaveHistory(const std::string& rFullpath, const std::deque<Page>& rPages);
+
 	// Filter pages like about:blank. Returns true when page should be NOT added
 	bool FilterPage(Page page) const;
 
@@ -54,6 +60,9 @@ private:
 
 	// Fullpath to history file
 	std::string _fullpathHistory;
+
+	// Writing of history file, only latest state is written
+	std::shared_ptr<WorkerPool::Sequence> _spSaveSequence;
 };
 
 #endif // HISTORYMANAGER_H_
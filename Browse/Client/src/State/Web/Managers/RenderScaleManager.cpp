@@ -0,0 +1,89 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+
+#include "RenderScaleManager.h"
+#include "src/State/Web/Tab/Tab.h"
+#include "src/Global.h"
+#include "src/Setup.h"
+#include "src/Utils/Logger.h"
+#include "src/Utils/glmWrapper.h"
+
+RenderScaleManager::RenderScaleManager(float initialScale)
+{
+	_scale = glm::clamp(initialScale, setup::RENDER_SCALE_MIN, setup::RENDER_SCALE_MAX);
+}
+
+RenderScaleManager::~RenderScaleManager()
+{
+	// Nothing to do
+}
+
+void RenderScaleManager::Update(float tpf, float paintTime, const std::map<int, std::unique_ptr<Tab> >& rTabs, int currentTabId)
+{
+	// Smooth measurements
+	if (!_initialized)
+	{
+		_averageFrameTime = tpf;
+		_averagePaintTime = paintTime;
+		_initialized = true;
+	}
+	else
+	{
+		float weight = glm::min(1.f, tpf / RENDER_SCALE_AVERAGE_TIME);
+		_averageFrameTime = glm::mix(_averageFrameTime, tpf, weight);
+		_averagePaintTime = glm::mix(_averagePaintTime, paintTime, weight);
+	}
+
+	// Only change scale at safe point, which is while no pipeline is executed by current tab
+	auto iter = rTabs.find(currentTabId);
+	if (iter != rTabs.end() && iter->second->IsPipelineActive())
+	{
+		_decreaseTime = 0.f;
+		_increaseTime = 0.f;
+		return;
+	}
+
+	// Decrease when frames are dropped and painting takes part in it
+	const float target = setup::RENDER_SCALE_TARGET_FRAME_TIME;
+	bool decrease =
+		_scale > setup::RENDER_SCALE_MIN
+		&& _averageFrameTime > target * RENDER_SCALE_DECREASE_FRAME_TIME
+		&& _averagePaintTime > _averageFrameTime * RENDER_SCALE_DECREASE_PAINT_SHARE;
+
+	// Increase when frames are in time and painting would be still cheap. Paint time grows with count of pixels
+	float nextScale = glm::min(_scale + setup::RENDER_SCALE_STEP, setup::RENDER_SCALE_MAX);
+	float predictedPaintTime = _averagePaintTime * (nextScale * nextScale) / (_scale * _scale);
+	bool increase =
+		_scale < setup::RENDER_SCALE_MAX
+		&& _averageFrameTime <= target * RENDER_SCALE_INCREASE_FRAME_TIME
+		&& predictedPaintTime <= target * RENDER_SCALE_INCREASE_PAINT_SHARE;
+
+	_decreaseTime = decrease ? _decreaseTime + tpf : 0.f;
+	_increaseTime = increase ? _increaseTime + tpf : 0.f;
+
+	// Change scale when condition held long enough
+	float scale = _scale;
+	if (_decreaseTime >= RENDER_SCALE_HOLD_TIME)
+	{
+		scale = glm::max(_scale - setup::RENDER_SCALE_STEP, setup::RENDER_SCALE_MIN);
+	}
+	else if (_increaseTime >= RENDER_SCALE_HOLD_TIME)
+	{
+		scale = nextScale;
+	}
+	if (scale == _scale) { return; }
+
+	LogInfo("RenderScaleManager: Changed render scale from ", _scale, " to ", scale,
+		" (frame time: ", _averageFrameTime * 1000.f, " ms, paint time: ", _averagePaintTime * 1000.f, " ms).");
+	_scale = scale;
+	_decreaseTime = 0.f;
+	_increaseTime = 0.f;
+
+	// Apply to all tabs. Hibernated ones have no browser and take it at wake up
+	for (const auto& rIdTabPair : rTabs)
+	{
+		rIdTabPair.second->SetRenderScale(_scale);
+	}
+}
@@ -0,0 +1,57 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+// Manager of render scale, which is the device scale factor CEF renders the
+// web views with. Scale is decreased when frames take too long and painting
+// of CEF is a considerable part of them and it is increased when painting in
+// higher scale would still be cheap. Conditions have to hold for some time and
+// thresholds of decrease and increase differ, so the scale does not oscillate.
+// Scale is only changed while current tab executes no pipeline, e.g. zooming.
+
+#ifndef RENDERSCALEMANAGER_H_
+#define RENDERSCALEMANAGER_H_
+
+#include <map>
+#include <memory>
+
+// Forward declaration
+class Tab;
+
+class RenderScaleManager
+{
+public:
+
+	// Constructor
+	RenderScaleManager(float initialScale);
+
+	// Destructor
+	virtual ~RenderScaleManager();
+
+	// Update with duration of frame and time spent with painting of CEF in that frame, both in seconds.
+	// Applies changed scale to all tabs
+	void Update(float tpf, float paintTime, const std::map<int, std::unique_ptr<Tab> >& rTabs, int currentTabId);
+
+	// Getter for current scale
+	float GetScale() const { return _scale; }
+
+	// Getter for smoothed frame and paint time in seconds
+	float GetAverageFrameTime() const { return _averageFrameTime; }
+	float GetAveragePaintTime() const { return _averagePaintTime; }
+
+private:
+
+	// Current scale
+	float _scale;
+
+	// Smoothed measurements
+	float _averageFrameTime = 0.f;
+	float _averagePaintTime = 0.f;
+	bool _initialized = false;
+
+	// Time for which conditions of decrease or increase have held
+	float _decreaseTime = 0.f;
+	float _increaseTime = 0.f;
+};
+
+#endif // RENDERSCALEMANAGER_H_
@@ -0,0 +1,340 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+
+#include "SessionManager.h"
+#include "src/Global.h"
+#include "src/Setup.h"
+#include "src/Utils/Logger.h"
+#include <fstream>
+#include <iterator>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+
+// Layout of record: magic, payload length, checksum of payload, payload
+static const char SESSION_RECORD_MAGIC[4] = { 'G', 'T', 'W', 'S' };
+static const uint32_t SESSION_RECORD_VERSION = 1;
+static const size_t SESSION_RECORD_HEADER_SIZE = 12;
+
+// CRC-32 (IEEE) of data
+static uint32_t Checksum(const char* pData, size_t size)
+{
+	static uint32_t table[256];
+	static bool tableInitialized = false;
+	if (!tableInitialized)
+	{
+		for (uint32_t i = 0; i < 256; i++)
+		{
+			uint32_t value = i;
+			for (int j = 0; j < 8; j++)
+			{
+				value = (value & 1) ? (0xEDB88320u ^ (value >> 1)) : (value >> 1);
+			}
+			table[i] = value;
+		}
+		tableInitialized = true;
+	}
+
+	uint32_t crc = 0xFFFFFFFFu;
+	for (size_t i = 0; i < size; i++)
+	{
+		crc = table[(crc ^ (uint8_t)pData[i]) & 0xFF] ^ (crc >> 8);
+	}
+	return crc ^ 0xFFFFFFFFu;
+}
+
+// Helpers to write into and read from payload
+namespace
+{
+	template<typename T>
+	void Write(std::vector<char>& rPayload, const T& rValue)
+	{
+		const char* pBytes = reinterpret_cast<const char*>(&rValue);
+		rPayload.insert(rPayload.end(), pBytes, pBytes + sizeof(T));
+	}
+
+	void WriteString(std::vector<char>& rPayload, const std::string& rValue)
+	{
+		Write(rPayload, (uint32_t)rValue.size());
+		rPayload.insert(rPayload.end(), rValue.begin(), rValue.end());
+	}
+
+	class Reader
+	{
+	public:
+
+		Reader(const std::vector<char>& rPayload) : _rPayload(rPayload) {}
+
+		template<typename T>
+		bool Read(T& rValue)
+		{
+			if (_position + sizeof(T) > _rPayload.size()) { return false; }
+			std::memcpy(&rValue, _rPayload.data() + _position, sizeof(T));
+			_position += sizeof(T);
+			return true;
+		}
+
+		bool ReadBytes(size_t size, const char*& rpBytes)
+		{
+			if (_position + size > _rPayload.size()) { return false; }
+			rpBytes = _rPayload.data() + _position;
+			_position += size;
+			return true;
+		}
+
+		bool ReadString(std::string& rValue)
+		{
+			uint32_t size = 0;
+			const char* pBytes = NULL;
+			if (!Read(size) || !ReadBytes(size, pBytes)) { return false; }
+			rValue.assign(pBytes, size);
+			return true;
+		}
+
+	private:
+
+		const std::vector<char>& _rPayload;
+		size_t _position = 0;
+	};
+}
+
+SessionManager::SessionManager(std::string userDirectory)
+{
+	// Fill members
+	_fullpathSession = userDirectory + SESSION_FILE;
+
+	// Start background thread
+	_writer = std::thread(&SessionManager::WriterLoop, this);
+}
+
+SessionManager::~SessionManager()
+{
+	// Let background thread write pending session and stop it
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_stop = true;
+	}
+	_condition.notify_one();
+	_writer.join();
+}
+
+bool SessionManager::LoadSession(Session& rSession) const
+{
+	// Try session file and temporary file of interrupted compaction
+	std::vector<char> payload;
+	if (!ReadLastRecord(_fullpathSession, payload) && !ReadLastRecord(_fullpathSession + ".tmp", payload))
+	{
+		LogInfo("SessionManager: No session file found or no intact record in it");
+		return false;
+	}
+
+	if (!Deserialize(payload, rSession))
+	{
+		LogInfo("SessionManager: Failed to parse session");
+		return false;
+	}
+
+	LogInfo("SessionManager: Loaded session with ", rSession.tabs.size(), " tabs");
+	return true;
+}
+
+void SessionManager::StoreSession(Session session)
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_upPendingSession = std::unique_ptr<Session>(new Session(std::move(session)));
+	}
+	_condition.notify_one();
+}
+
+void SessionManager::WriterLoop()
+{
+	std::vector<char> payload;
+	while (true)
+	{
+		// Wait for session to write
+		std::unique_ptr<Session> upSession;
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			_condition.wait(lock, [this] { return _stop || _upPendingSession; });
+			if (!_upPendingSession && _stop) { return; }
+			upSession = std::move(_upPendingSession);
+		}
+
+		// Serialize and write it without holding the lock
+		payload.clear();
+		Serialize(*upSession, payload);
+		if (!WriteRecord(payload))
+		{
+			LogInfo("SessionManager: Failed to write session file");
+		}
+	}
+}
+
+bool SessionManager::WriteRecord(const std::vector<char>& rPayload)
+{
+	// Build header
+	char header[SESSION_RECORD_HEADER_SIZE];
+	uint32_t length = (uint32_t)rPayload.size();
+	uint32_t checksum = Checksum(rPayload.data(), rPayload.size());
+	std::memcpy(header, SESSION_RECORD_MAGIC, 4);
+	std::memcpy(header + 4, &length, 4);
+	std::memcpy(header + 8, &checksum, 4);
+
+	// Append record
+	std::streamoff fileSize = 0;
+	{
+		std::ofstream file(_fullpathSession, std::ios::binary | std::ios::app);
+		if (!file.is_open()) { return false; }
+		file.write(header, SESSION_RECORD_HEADER_SIZE);
+		file.write(rPayload.data(), rPayload.size());
+		file.flush();
+		if (!file.good()) { return false; }
+		file.seekp(0, std::ios::end);
+		fileSize = file.tellp();
+	}
+
+	// Compact file when too large. Record is written to temporary file first, which is read at loading when session file is missing
+	if (fileSize > (std::streamoff)setup::SESSION_FILE_COMPACTION_MB * 1024 * 1024)
+	{
+		const std::string fullpathTemporary = _fullpathSession + ".tmp";
+		{
+			std::ofstream file(fullpathTemporary, std::ios::binary | std::ios::trunc);
+			if (!file.is_open()) { return false; }
+			file.write(header, SESSION_RECORD_HEADER_SIZE);
+			file.write(rPayload.data(), rPayload.size());
+			file.flush();
+			if (!file.good()) { return false; }
+		}
+		std::remove(_fullpathSession.c_str()); // rename does not overwrite on Windows
+		if (std::rename(fullpathTemporary.c_str(), _fullpathSession.c_str()) != 0) { return false; }
+		LogDebug("SessionManager: Compacted session file");
+	}
+
+	return true;
+}
+
+bool SessionManager::ReadLastRecord(const std::string& rFullpath, std::vector<char>& rPayload) const
+{
+	std::ifstream file(rFullpath, std::ios::binary);
+	if (!file.is_open()) { return false; }
+
+	// Read whole file, which is kept small by compaction
+	std::vector<char> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+	// Go over records until end of file. After a damaged record, e.g. of a torn write,
+	// resynchronize at next magic, as intact records may have been appended behind it
+	bool found = false;
+	size_t position = 0;
+	size_t lastPosition = 0;
+	size_t lastLength = 0;
+	while (position + SESSION_RECORD_HEADER_SIZE <= data.size())
+	{
+		// Check header
+		const char* pHeader = data.data() + position;
+		uint32_t length = 0;
+		uint32_t checksum = 0;
+		std::memcpy(&length, pHeader + 4, 4);
+		std::memcpy(&checksum, pHeader + 8, 4);
+		if (std::memcmp(pHeader, SESSION_RECORD_MAGIC, 4) == 0
+			&& length <= data.size() - position - SESSION_RECORD_HEADER_SIZE
+			&& Checksum(pHeader + SESSION_RECORD_HEADER_SIZE, length) == checksum)
+		{
+			lastPosition = position + SESSION_RECORD_HEADER_SIZE;
+			lastLength = length;
+			found = true;
+			position += SESSION_RECORD_HEADER_SIZE + length;
+			continue;
+		}
+
+		// Damaged record, search next magic
+		LogInfo("SessionManager: Skipping damaged record in ", rFullpath);
+		position++;
+		while (position + SESSION_RECORD_HEADER_SIZE <= data.size() && std::memcmp(data.data() + position, SESSION_RECORD_MAGIC, 4) != 0)
+		{
+			position++;
+		}
+	}
+
+	if (found)
+	{
+		rPayload.assign(data.begin() + lastPosition, data.begin() + lastPosition + lastLength);
+	}
+	return found;
+}
+
+void SessionManager::Serialize(const Session& rSession, std::vector<char>& rPayload)
+{
+	Write(rPayload, SESSION_RECORD_VERSION);
+	Write(rPayload, (int32_t)rSession.currentTabIndex);
+	Write(rPayload, (uint32_t)rSession.tabs.size());
+	for (const auto& rTab : rSession.tabs)
+	{
+		WriteString(rPayload, rTab.URL);
+		WriteString(rPayload, rTab.title);
+		Write(rPayload, (uint32_t)rTab.backURLs.size());
+		for (const auto& rURL : rTab.backURLs)
+		{
+			WriteString(rPayload, rURL);
+		}
+		Write(rPayload, rTab.scrollingOffsetX);
+		Write(rPayload, rTab.scrollingOffsetY);
+		Write(rPayload, rTab.zoomLevel);
+		Write(rPayload, (int32_t)rTab.thumbnailWidth);
+		Write(rPayload, (int32_t)rTab.thumbnailHeight);
+		Write(rPayload, (uint32_t)rTab.thumbnail.size());
+		rPayload.insert(rPayload.end(), rTab.thumbnail.begin(), rTab.thumbnail.end());
+	}
+}
+
+bool SessionManager::Deserialize(const std::vector<char>& rPayload, Session& rSession)
+{
+	Reader reader(rPayload);
+
+	// Header of session
+	uint32_t version = 0;
+	int32_t currentTabIndex = -1;
+	uint32_t tabCount = 0;
+	if (!reader.Read(version) || version != SESSION_RECORD_VERSION) { return false; }
+	if (!reader.Read(currentTabIndex) || !reader.Read(tabCount)) { return false; }
+	rSession.currentTabIndex = currentTabIndex;
+
+	// Tabs
+	rSession.tabs.clear();
+	for (uint32_t i = 0; i < tabCount; i++)
+	{
+		TabSession tab;
+		uint32_t backURLCount = 0;
+		if (!reader.ReadString(tab.URL) || !reader.ReadString(tab.title) || !reader.Read(backURLCount)) { return false; }
+		tab.backURLs.resize(backURLCount);
+		for (auto& rURL : tab.backURLs)
+		{
+			if (!reader.ReadString(rURL)) { return false; }
+		}
+
+		int32_t thumbnailWidth = 0;
+		int32_t thumbnailHeight = 0;
+		uint32_t thumbnailSize = 0;
+		const char* pThumbnail = NULL;
+		if (!reader.Read(tab.scrollingOffsetX) || !reader.Read(tab.scrollingOffsetY) || !reader.Read(tab.zoomLevel)
+			|| !reader.Read(thumbnailWidth) || !reader.Read(thumbnailHeight)
+			|| !reader.Read(thumbnailSize) || !reader.ReadBytes(thumbnailSize, pThumbnail))
+		{
+			return false;
+		}
+
+		// Thumbnail is only used when it matches its resolution
+		if (thumbnailWidth > 0 && thumbnailHeight > 0 && thumbnailSize == (uint32_t)(thumbnailWidth * thumbnailHeight * 4))
+		{
+			tab.thumbnailWidth = thumbnailWidth;
+			tab.thumbnailHeight = thumbnailHeight;
+			tab.thumbnail.assign(pThumbnail, pThumbnail + thumbnailSize);
+		}
+
+		rSession.tabs.push_back(std::move(tab));
+	}
+
+	return true;
+}
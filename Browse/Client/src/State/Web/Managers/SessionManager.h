@@ -0,0 +1,84 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+// Manager of session store. Snapshots of all tabs are appended as checksummed
+// records to a local file by a background thread. At loading, the last intact
+// record is used, so a crash while writing loses only the latest snapshot.
+// Reading resynchronizes at the next magic behind a damaged record.
+// File is compacted to the latest record when it grows too large.
+
+#ifndef SESSIONMANAGER_H_
+#define SESSIONMANAGER_H_
+
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <memory>
+
+class SessionManager
+{
+public:
+
+	struct TabSession
+	{
+		std::string URL;
+		std::string title;
+		std::vector<std::string> backURLs; // oldest first
+		double scrollingOffsetX = 0;
+		double scrollingOffsetY = 0;
+		double zoomLevel = 1;
+		int thumbnailWidth = 0;
+		int thumbnailHeight = 0;
+		std::vector<unsigned char> thumbnail; // RGBA
+	};
+
+	struct Session
+	{
+		std::vector<TabSession> tabs; // in order of tab overview
+		int currentTabIndex = -1;
+	};
+
+	// Constructor
+	SessionManager(std::string userDirectory);
+
+	// Destructor, waits until pending session is written
+	virtual ~SessionManager();
+
+	// Load last intact session from hard disk. Returns whether successful
+	bool LoadSession(Session& rSession) const;
+
+	// Hand session over to background thread which writes it. Replaces pending session which is not yet written
+	void StoreSession(Session session);
+
+private:
+
+	// Loop of background thread
+	void WriterLoop();
+
+	// Append record to file and compact it when necessary. Returns whether successful
+	bool WriteRecord(const std::vector<char>& rPayload);
+
+	// Read last intact record of file. Returns whether successful
+	bool ReadLastRecord(const std::string& rFullpath, std::vector<char>& rPayload) const;
+
+	// Conversion between session and payload of record
+	static void Serialize(const Session& rSession, std::vector<char>& rPayload);
+	static bool Deserialize(const std::vector<char>& rPayload, Session& rSession);
+
+	// Fullpath to session file
+	std::string _fullpathSession;
+
+	// Session waiting for background thread
+	std::unique_ptr<Session> _upPendingSession;
+
+	// Background thread and its synchronization
+	std::thread _writer;
+	std::mutex _mutex;
+	std::condition_variable _condition;
+	bool _stop = false;
+};
+
+#endif // SESSIONMANAGER_H_
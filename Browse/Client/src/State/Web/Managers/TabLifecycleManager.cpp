@@ -0,0 +1,99 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+
+#include "TabLifecycleManager.h"
+#include "src/State/Web/Tab/Tab.h"
+#include "src/Global.h"
+#include "src/Utils/Logger.h"
+#include <algorithm>
+
+TabLifecycleManager::TabLifecycleManager(size_t budgetBytes)
+{
+	_budget = budgetBytes;
+	_timeUntilCheck = TAB_LIFECYCLE_CHECK_INTERVAL;
+}
+
+TabLifecycleManager::~TabLifecycleManager()
+{
+	// Nothing to do
+}
+
+void TabLifecycleManager::Touch(int id)
+{
+	Remove(id);
+	_usage.push_back(id);
+}
+
+void TabLifecycleManager::Remove(int id)
+{
+	_usage.erase(std::remove(_usage.begin(), _usage.end(), id), _usage.end());
+}
+
+void TabLifecycleManager::Update(float tpf, const std::map<int, std::unique_ptr<Tab> >& rTabs, int currentTabId)
+{
+	// Only check in interval
+	_timeUntilCheck -= tpf;
+	if (_timeUntilCheck > 0) { return; }
+	_timeUntilCheck = TAB_LIFECYCLE_CHECK_INTERVAL;
+
+	// Sum up memory of all tabs
+	auto report = GetMemoryReport(rTabs);
+	size_t total = 0;
+	for (const auto& rTabMemory : report)
+	{
+		total += rTabMemory.bytes;
+	}
+	if (total <= _budget) { return; }
+
+	LogInfo("TabLifecycleManager: Estimated memory of tabs (", total / (1024 * 1024), " MB) exceeds budget (", _budget / (1024 * 1024), " MB).");
+
+	// Hibernate least recently used tabs first
+	for (const auto& rTabMemory : report)
+	{
+		if (total <= _budget) { break; }
+		if (rTabMemory.id == currentTabId || rTabMemory.hibernated) { continue; }
+
+		// Hibernate tab and update total
+		const auto& rupTab = rTabs.at(rTabMemory.id);
+		rupTab->Hibernate();
+		total -= rTabMemory.bytes;
+		total += rupTab->GetEstimatedMemoryUsage();
+
+		LogInfo("TabLifecycleManager: Hibernated tab ", rTabMemory.id, " (", rTabMemory.bytes / 1024, " KB) with URL ", rTabMemory.URL);
+	}
+
+	// Report tabs
+	for (const auto& rTabMemory : GetMemoryReport(rTabs))
+	{
+		LogDebug("TabLifecycleManager: Tab ", rTabMemory.id, (rTabMemory.hibernated ? " (hibernated)" : ""), " uses ", rTabMemory.bytes / 1024, " KB: ", rTabMemory.URL);
+	}
+}
+
+std::vector<TabLifecycleManager::TabMemory> TabLifecycleManager::GetMemoryReport(const std::map<int, std::unique_ptr<Tab> >& rTabs) const
+{
+	std::vector<TabMemory> report;
+	report.reserve(rTabs.size());
+
+	// Tabs in order of usage
+	for (int id : _usage)
+	{
+		auto iter = rTabs.find(id);
+		if (iter != rTabs.end())
+		{
+			report.push_back({ id, iter->second->GetURL(), iter->second->IsHibernated(), iter->second->GetEstimatedMemoryUsage() });
+		}
+	}
+
+	// Tabs which have never been touched are least recently used
+	for (const auto& rPair : rTabs)
+	{
+		if (std::find(_usage.begin(), _usage.end(), rPair.first) == _usage.end())
+		{
+			report.insert(report.begin(), { rPair.first, rPair.second->GetURL(), rPair.second->IsHibernated(), rPair.second->GetEstimatedMemoryUsage() });
+		}
+	}
+
+	return report;
+}
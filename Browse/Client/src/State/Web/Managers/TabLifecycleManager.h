@@ -0,0 +1,65 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+// Manager of tab lifecycle. Keeps track of tab usage and hibernates least
+// recently used background tabs when estimated memory exceeds the budget.
+
+#ifndef TABLIFECYCLEMANAGER_H_
+#define TABLIFECYCLEMANAGER_H_
+
+#include <string>
+#include <deque>
+#include <vector>
+#include <map>
+#include <memory>
+
+// Forward declaration
+class Tab;
+
+class TabLifecycleManager
+{
+public:
+
+	struct TabMemory
+	{
+		int id;
+		std::string URL;
+		bool hibernated;
+		size_t bytes; // estimated
+	};
+
+	// Constructor
+	TabLifecycleManager(size_t budgetBytes);
+
+	// Destructor
+	virtual ~TabLifecycleManager();
+
+	// Mark tab as most recently used
+	void Touch(int id);
+
+	// Forget about tab
+	void Remove(int id);
+
+	// Hibernate background tabs until memory fits into budget. Checks only in interval
+	void Update(float tpf, const std::map<int, std::unique_ptr<Tab> >& rTabs, int currentTabId);
+
+	// Get estimated memory usage of each tab, ordered from least to most recently used
+	std::vector<TabMemory> GetMemoryReport(const std::map<int, std::unique_ptr<Tab> >& rTabs) const;
+
+	// Getter for budget
+	size_t GetBudget() const { return _budget; }
+
+private:
+
+	// Ids of tabs, least recently used at front
+	std::deque<int> _usage;
+
+	// Budget in bytes
+	size_t _budget;
+
+	// Time until next check of memory usage
+	float _timeUntilCheck;
+};
+
+#endif // TABLIFECYCLEMANAGER_H_
@@ -115,7 +115,7 @@ void Tab::InputTextData(int64 frameID, int nodeID, std::string text, bool submit
 
 std::weak_ptr<const DOMNode> Tab::GetNearestLink(glm::vec2 pagePixelCoordinate, float& rDistance) const
 {
-    if(_TextLinkMap.empty())
+    if(_TextLinks.Empty())
     {
         // No link available
         rDistance = -1;
@@ -127,25 +127,28 @@ std::weak_ptr<const DOMNode> Tab::GetNearestLink(glm::vec2 pagePixelCoordinate,
         float minDistance = std::numeric_limits<float>::max();
         std::weak_ptr<const DOMNode> wpResult;
 
-        // Go over links
-        for(const auto& idLinkPair : _TextLinkMap)
+        // Go over rectangles of all links
+        const std::vector<Rect>& rRects = _TextLinks.GetRects();
+        int nearestOwner = -1;
+        for(int i = 0; i < (int)rRects.size(); i++)
         {
-            // Go over rectangles of that link
-            for(const auto& rRect : idLinkPair.second->GetRects())
+            // Distance
+            const Rect& rRect = rRects[i];
+            float dx = glm::max(glm::abs(pagePixelCoordinate.x - rRect.Center().x) - (rRect.Width() / 2.f), 0.f);
+            float dy = glm::max(glm::abs(pagePixelCoordinate.y - rRect.Center().y) - (rRect.Height() / 2.f), 0.f);
+            float distance = glm::sqrt((dx * dx) + (dy * dy));
+
+            // Check whether distance is smaller
+            if(distance < minDistance)
             {
-                // Distance
-                float dx = glm::max(glm::abs(pagePixelCoordinate.x - rRect.Center().x) - (rRect.Width() / 2.f), 0.f);
-                float dy = glm::max(glm::abs(pagePixelCoordinate.y - rRect.Center().y) - (rRect.Height() / 2.f), 0.f);
-                float distance = glm::sqrt((dx * dx) + (dy * dy));
-
-                // Check whether distance is smaller
-                if(distance < minDistance)
-                {
-                    minDistance = distance;
-                    wpResult = idLinkPair.second;
-                }
+                minDistance = distance;
+                nearestOwner = _TextLinks.GetRectOwners()[i];
             }
         }
+        if(nearestOwner >= 0)
+        {
+            wpResult = _TextLinks.GetNodes()[nearestOwner];
+        }
 
         // Return result
         rDistance = minDistance;
@@ -178,14 +181,32 @@ void Tab::ConvertToCEFPixel(double& rWebViewPixelX, double& rWebViewPixelY) cons
 {
 	rWebViewPixelX = (rWebViewPixelX / (double)_upWebView->GetWidth()) * (double)_upWebView->GetResolutionX();
 	rWebViewPixelY = (rWebViewPixelY / (double)_upWebView->GetHeight()) * (double)_upWebView->GetResolutionY();
+
+	// Displayed page is shifted ahead of CEF while smooth scrolling
+	rWebViewPixelY += GetScrollingShiftY(rWebViewPixelX, rWebViewPixelY);
 }
 
 void Tab::ConvertToWebViewPixel(double& rCEFPixelX, double& rCEFPixelY) const
 {
+	rCEFPixelY -= GetScrollingShiftY(rCEFPixelX, rCEFPixelY);
 	rCEFPixelX = (rCEFPixelX / (double)_upWebView->GetResolutionX()) * (float)_upWebView->GetWidth();
 	rCEFPixelY = (rCEFPixelY / (float)_upWebView->GetResolutionY()) * (float)_upWebView->GetHeight();
 }
 
+double Tab::GetScrollingShiftY(double CEFPixelX, double CEFPixelY) const
+{
+	double shiftY = _scrollController.GetShiftY();
+	if (shiftY == 0) { return 0; }
+	for (const auto& rElements : _fixedElements)
+	{
+		for (const auto& rElement : rElements)
+		{
+			if (rElement.IsInside((float)CEFPixelX, (float)CEFPixelY)) { return 0; }
+		}
+	}
+	return shiftY;
+}
+
 void Tab::ReplyJSDialog(bool clickedOk, std::string userInput)
 {
 	_pCefMediator->ReplyJSDialog(this, clickedOk, userInput);
@@ -10,6 +10,7 @@
 #include "src/State/Web/Managers/HistoryManager.h"
 #include "src/State/Web/Tab/Pipelines/JSDialogPipeline.h"
 #include "src/Singletons/LabStreamMailer.h"
+#include "src/CEF/Mediator.h"
 #include <algorithm>
 
 void Tab::GetWebRenderResolution(int& rWidth, int& rHeight) const
@@ -22,6 +23,11 @@ void Tab::GetWebRenderResolution(int& rWidth, int& rHeight) const
 	rHeight = webViewInGUI.height * setup::WEB_VIEW_RESOLUTION_SCALE;
 }
 
+void Tab::FillZoomTexture(int width, int height, const unsigned char* pBuffer)
+{
+	_upWebView->FillZoomTexture(width, height, pBuffer, _scrollingOffsetX, _scrollingOffsetY);
+}
+
 void Tab::SetURL(std::string URL)
 {
 	_url = URL;
@@ -109,8 +115,8 @@ void Tab::AddDOMTextInput(int id)
 {
 	std::shared_ptr<DOMTextInput> spNode = std::make_shared<DOMTextInput>(id);
 
-	// Add node to ID->node map
-	_TextInputMap.emplace(id, spNode);
+	// Add node to store
+	_TextInputs.Add(id, spNode);
 
 	// Create DOMTrigger
 	std::unique_ptr<TextInputTrigger> upDOMTrigger = std::unique_ptr<TextInputTrigger>(new TextInputTrigger(this, _triggers, spNode));
@@ -127,15 +133,15 @@ void Tab::AddDOMTextInput(int id)
 
 void Tab::AddDOMLink(int id)
 {
-	_TextLinkMap.emplace(id, std::make_shared<DOMLink>(id));
+	_TextLinks.Add(id, std::make_shared<DOMLink>(id));
 }
 
 void Tab::AddDOMSelectField(int id)
 {
 	std::shared_ptr<DOMSelectField> spNode = std::make_shared<DOMSelectField>(id);
 
-	// Add node to ID->node map
-	_SelectFieldMap.emplace(id, spNode);
+	// Add node to store
+	_SelectFields.Add(id, spNode);
 
 	// Create DOMTrigger
 	std::unique_ptr<SelectFieldTrigger> upDOMTrigger = std::unique_ptr<SelectFieldTrigger>(new SelectFieldTrigger(this, _triggers, spNode));
@@ -152,28 +158,28 @@ void Tab::AddDOMSelectField(int id)
 
 void Tab::AddDOMOverflowElement(int id)
 {
-	_OverflowElementMap.emplace(id, std::make_shared<DOMOverflowElement>(id));
+	_OverflowElements.Add(id, std::make_shared<DOMOverflowElement>(id));
 }
 
 
 std::weak_ptr<DOMTextInput> Tab::GetDOMTextInput(int id)
 {
-	return (_TextInputMap.find(id) != _TextInputMap.end()) ? _TextInputMap.at(id) : std::weak_ptr<DOMTextInput>();
+	return _TextInputs.Get(id);
 }
 
 std::weak_ptr<DOMLink> Tab::GetDOMLink(int id)
 {
-	return (_TextLinkMap.find(id) != _TextLinkMap.end()) ? _TextLinkMap.at(id) : std::weak_ptr<DOMLink>();
+	return _TextLinks.Get(id);
 }
 
 std::weak_ptr<DOMSelectField> Tab::GetDOMSelectField(int id)
 {
-	return (_SelectFieldMap.find(id) != _SelectFieldMap.end()) ? _SelectFieldMap.at(id) : std::weak_ptr<DOMSelectField>();
+	return _SelectFields.Get(id);
 }
 
 std::weak_ptr<DOMOverflowElement> Tab::GetDOMOverflowElement(int id)
 {
-	return (_OverflowElementMap.find(id) != _OverflowElementMap.end()) ? _OverflowElementMap.at(id) : std::weak_ptr<DOMOverflowElement>();
+	return _OverflowElements.Get(id);
 }
 
 void Tab::ClearDOMNodes()
@@ -188,56 +194,51 @@ void Tab::ClearDOMNodes()
 	_textInputTriggers.clear();
 	_selectFieldTriggers.clear();
 
-	// Clear ID->node maps
-	_TextLinkMap.clear();
-	_TextInputMap.clear();
-	_SelectFieldMap.clear();
+	// Clear node stores
+	_TextLinks.Clear();
+	_TextInputs.Clear();
+	_SelectFields.Clear();
 
 	// Clear fixed elements
 	_fixedElements.clear();
 
 	// Clear overflow elements
-	_OverflowElementMap.clear();
+	_OverflowElements.Clear();
 }
 
 void Tab::RemoveDOMTextInput(int id)
 {
-	if (_TextInputMap.find(id) != _TextInputMap.end()) { _TextInputMap.erase(id); }
+	_TextInputs.Remove(id);
 
 	// TODO: Remove DOMTrigger, if corresponding DOMTextInput gets removed and destroyed?
 }
 
 void Tab::RemoveDOMLink(int id)
 {
-	if (_TextLinkMap.find(id) != _TextLinkMap.end()) { _TextLinkMap.erase(id); }
+	_TextLinks.Remove(id);
 }
 
 void Tab::RemoveDOMSelectField(int id)
 {
-	if (_SelectFieldMap.find(id) != _SelectFieldMap.end()) { _SelectFieldMap.erase(id); }
+	_SelectFields.Remove(id);
 }
 
 void Tab::RemoveDOMOverflowElement(int id)
 {
-	if (_OverflowElementMap.find(id) != _OverflowElementMap.end()) { _OverflowElementMap.erase(id); }
+	_OverflowElements.Remove(id);
 }
 
 
 void Tab::SetScrollingOffset(double x, double y)
 {
-	// Update page size information when nearly reached end of page size (in case of endless scrollable sites like e.g. Fb.com)
-	// (but don't do it if scrolling offset hasn't changed)
-	/*
-	auto webViewPositionAndSize = CalculateWebViewPositionAndSize();
-	if ((x != _scrollingOffsetX && abs(_pageWidth - webViewPositionAndSize.width - x) < 50)
-	|| (y != _scrollingOffsetY && abs(_pageHeight - webViewPositionAndSize.height - y) < 50))
-	{
-	_pCefMediator->GetPageResolution(this);
-	}
-	*/
-
 	_scrollingOffsetX = x;
 	_scrollingOffsetY = y;
+	_scrollController.OnScrollingOffsetChanged();
+}
+
+void Tab::SetRenderedScrollingOffset(double y)
+{
+	_renderedScrollingOffsetY = y;
 }
 
 void Tab::SetPageResolution(double width, double height)
@@ -325,6 +326,13 @@ void Tab::SetLoadingStatus(int64 frameID, bool isMain, bool isLoading)
                 _iconState = IconState::ICON_NOT_FOUND;
             }
 
+			// Scroll to position before hibernation
+			if (_restoreScrollingAfterLoad)
+			{
+				_pCefMediator->RestoreScrolling(this, _hibernationScrollingOffsetX, _hibernationScrollingOffsetY);
+				_restoreScrollingAfterLoad = false;
+			}
+
 			// Add page to history after loading
 			HistoryManager::Page page;
 			page.URL = _url;
@@ -79,6 +79,10 @@ void Tab::DrawDebuggingOverlay() const
 				rect.right -= _scrollingOffsetX;
 				rect.bottom -= _scrollingOffsetY;
 				rect.top -= _scrollingOffsetY;
+
+				// Displayed page is shifted ahead of CEF while smooth scrolling
+				rect.bottom -= _scrollController.GetShiftY();
+				rect.top -= _scrollController.GetShiftY();
 			}
 
 			// Scale from CEFPixel space to WebViewPixel
@@ -119,7 +123,7 @@ void Tab::DrawDebuggingOverlay() const
 			const auto& rDOMTrigger = rNodeTriggerPair.second;
 
 			// Render rects
-			for (const auto rRect : rDOMTrigger->GetDOMRects())
+			for (const auto& rRect : rDOMTrigger->GetDOMRects())
 			{
 				/*
 				if (!rDOMTrigger->GetDOMIsPasswordField()) // TODO: what is this? Different color for password fields?
@@ -143,25 +147,20 @@ void Tab::DrawDebuggingOverlay() const
 		// Set rendering up for DOMTextLink
 		_upDebugLineQuad->GetShader()->UpdateValue("color", DOM_TEXT_LINKS_DEBUG_COLOR);
 
-		// Go over all DOMTextLinks
-		for (const auto& rIdNodePair : _TextLinkMap)
+		// Go over rects of all DOMTextLinks
+		const std::vector<Rect>& rLinkRects = _TextLinks.GetRects();
+		for (int i = 0; i < (int)rLinkRects.size(); i++)
 		{
-			const auto& rDOMTextLink = rIdNodePair.second;
-			// Render rects
-			for (const auto rRect : rDOMTextLink->GetRects())
-			{
-				renderRect(
-					rRect, 
-					(rDOMTextLink->GetFixedId() >= 0)
-				);
-			}
+			renderRect(
+				rLinkRects[i],
+				(_TextLinks.GetFixedIds()[_TextLinks.GetRectOwners()[i]] >= 0)
+			);
 		}
 
 		// DEBUG - links containing line break are shown in another color
 		_upDebugLineQuad->GetShader()->UpdateValue("color", glm::vec3(1.f, 0.f, 1.f));
-		for (const auto& rIdNodePair : _TextLinkMap)
+		for (const auto& rDOMTextLink : _TextLinks.GetNodes())
 		{
-			const auto& rDOMTextLink = rIdNodePair.second;
 			if (rDOMTextLink->GetRects().size() > 1)
 				renderRect(
 					rDOMTextLink->GetRects()[1], 
@@ -172,11 +171,10 @@ void Tab::DrawDebuggingOverlay() const
 		// ### SELECT FIELDS ###
 		// Set rendering up for DOMSelectFields
 		_upDebugLineQuad->GetShader()->UpdateValue("color", DOM_SELECT_FIELD_DEBUG_COLOR);
-		for (const auto& rIdNodePair : _SelectFieldMap)
+		for (const auto& rDOMSelectField : _SelectFields.GetNodes())
 		{
-			const auto& rDOMSelectField = rIdNodePair.second;
 			// Render rects
-			for (const auto rRect : rDOMSelectField->GetRects())
+			for (const auto& rRect : rDOMSelectField->GetRects())
 			{
 				renderRect(
 					rRect, 
@@ -205,9 +203,8 @@ void Tab::DrawDebuggingOverlay() const
 		// ### OVERFLOW ELEMENTS ###
 		_upDebugLineQuad->GetShader()->UpdateValue("color", glm::vec3(255.f / 255.f, 127.f / 255.f, 35.f / 255.f));
 
-		for (const auto& rIdNodePair : _OverflowElementMap)
+		for (const auto& rOverflowElement : _OverflowElements.GetNodes())
 		{
-			const auto& rOverflowElement = rIdNodePair.second;
 			for (const auto& rect : rOverflowElement->GetRects())
 				renderRect(
 					rect,
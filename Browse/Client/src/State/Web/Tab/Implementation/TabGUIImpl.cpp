@@ -9,6 +9,7 @@
 #include "src/State/Web/Tab/Pipelines/PivotMenuPipeline.h"
 #include "src/State/Web/Tab/Pipelines/TextSelectionPipeline.h"
 #include "src/CEF/Mediator.h"
+#include "src/Setup.h"
 #include "src/Utils/MakeUnique.h"
 
 void Tab::TabButtonListener::down(eyegui::Layout* pLayout, std::string id)
@@ -100,13 +101,24 @@ void Tab::TabSensorListener::penetrated(eyegui::Layout* pLayout, std::string id,
 {
 	if (pLayout == _pTab->_pScrollingOverlayLayout)
 	{
+		// Positive wheel delta scrolls up, positive delta of scroll controller down
+		double delta = 0;
 		if (id == "scroll_up_sensor")
 		{
-            _pTab->_pCefMediator->EmulateMouseWheelScrolling(_pTab, 0, amount * 20.f);
+			delta = amount * 20.f;
 		}
 		else if (id == "scroll_down_sensor")
 		{
-            _pTab->_pCefMediator->EmulateMouseWheelScrolling(_pTab, 0, amount * -20.f);
+			delta = amount * -20.f;
+		}
+
+		if (setup::SMOOTH_SCROLLING)
+		{
+			_pTab->_scrollController.Scroll(-delta);
+		}
+		else if (delta != 0)
+		{
+			_pTab->_pCefMediator->EmulateMouseWheelScrolling(_pTab, 0, delta);
 		}
 	}
 }
@@ -9,9 +9,13 @@
 #include "src/Setup.h"
 #include "src/Utils/Helper.h"
 #include "src/Utils/Logger.h"
+#include "src/Singletons/FrameProfiler.h"
+#include "src/Singletons/TelemetryBus.h"
+#include "src/Singletons/GPUPool.h"
+#include "src/Singletons/WorkerPool.h"
 #include <algorithm>
 
-Tab::Tab(Master* pMaster, Mediator* pCefMediator, WebTabInterface* pWeb, std::string url)
+Tab::Tab(Master* pMaster, Mediator* pCefMediator, WebTabInterface* pWeb, std::string url, const SessionManager::TabSession* pSession)
 {
 	// Fill members
 	_pMaster = pMaster;
@@ -26,6 +30,16 @@ Tab::Tab(Master* pMaster, Mediator* pCefMediator, WebTabInterface* pWeb, std::st
 	_pPipelineAbortLayout = _pMaster->AddLayout("layouts/TabPipelineAbort.xeyegui", EYEGUI_TAB_LAYER, false);
     _pDebugLayout = _pMaster->AddLayout("layouts/TabDebug.xeyegui", EYEGUI_TAB_LAYER, false);
 
+	// Bind style properties which follow accent color
+	_pPanelColorStyle = _pMaster->GetStyleProperty("tab_panel", eyegui::StylePropertyVec4::Color);
+	_pOverlayColorStyle = _pMaster->GetStyleProperty("tab_overlay", eyegui::StylePropertyVec4::Color);
+	_pOverlayBackgroundColorStyle = _pMaster->GetStyleProperty("tab_overlay", eyegui::StylePropertyVec4::BackgroundColor);
+	_pOverlayNoBackColorStyle = _pMaster->GetStyleProperty("tab_overlay_noback", eyegui::StylePropertyVec4::Color);
+	_pOverlayPanelColorStyle = _pMaster->GetStyleProperty("tab_overlay_panel", eyegui::StylePropertyVec4::Color);
+	_pOverlayPanelBackgroundColorStyle = _pMaster->GetStyleProperty("tab_overlay_panel", eyegui::StylePropertyVec4::BackgroundColor);
+	_pScrollProgressColorStyle = _pMaster->GetStyleProperty("tab_overlay_scroll_progress", eyegui::StylePropertyVec4::Color);
+	_pScrollProgressBackgroundColorStyle = _pMaster->GetStyleProperty("tab_overlay_scroll_progress", eyegui::StylePropertyVec4::BackgroundColor);
+
 	// Create scroll up and down floating frames in special overlay layout which always on top of standard overlay
 	_scrollUpProgressFrameIndex = eyegui::addFloatingFrameWithBrick(
 		_pScrollingOverlayLayout,
@@ -88,8 +102,28 @@ Tab::Tab(Master* pMaster, Mediator* pCefMediator, WebTabInterface* pWeb, std::st
 	auto webViewInGUI = eyegui::getAbsolutePositionAndSizeOfElement(_pPanelLayout, "web_view");
     _upWebView = std::unique_ptr<WebView>(new WebView(webViewInGUI.x, webViewInGUI.y, webViewInGUI.width, webViewInGUI.height));
 
-	// Register itself and painted texture in mediator to receive DOMNodes
-	_pCefMediator->RegisterTab(this);
+	// Restore tab from session. It stays hibernated with thumbnail until activated
+	if (pSession)
+	{
+		_title = pSession->title;
+		_restoredBackURLs = pSession->backURLs;
+		_zoomLevel = pSession->zoomLevel;
+		_scrollingOffsetX = pSession->scrollingOffsetX;
+		_scrollingOffsetY = pSession->scrollingOffsetY;
+		_renderedScrollingOffsetY = pSession->scrollingOffsetY;
+		_hibernationScrollingOffsetX = pSession->scrollingOffsetX;
+		_hibernationScrollingOffsetY = pSession->scrollingOffsetY;
+		if (!pSession->thumbnail.empty())
+		{
+			_upWebView->ShowSnapshot(pSession->thumbnailWidth, pSession->thumbnailHeight, pSession->thumbnail);
+		}
+		_hibernated = true;
+	}
+	else
+	{
+		// Register itself and painted texture in mediator to receive DOMNodes
+		_pCefMediator->RegisterTab(this);
+	}
 
 	// Prepare debugging overlay
 	InitDebuggingOverlay();
@@ -116,6 +150,8 @@ Tab::~Tab()
 
 void Tab::Update(float tpf, Input& rInput)
 {
+	ProfilerScope profilerScope("Tab::Update");
+
 	// #######################
 	// ### UPDATE WEB VIEW ###
 	// #######################
@@ -128,6 +164,19 @@ void Tab::Update(float tpf, Input& rInput)
 		webViewInGUI.width,
 		webViewInGUI.height);
 
+	// Let CEF render zoomed region in high resolution
+	bool zoomRepaint = false;
+	float zoomDeviceScaleFactor = _upWebView->UpdateZoom(tpf, _webViewParameters, _scrollingOffsetX, _scrollingOffsetY, zoomRepaint);
+	if (zoomDeviceScaleFactor != _zoomDeviceScaleFactor)
+	{
+		_zoomDeviceScaleFactor = zoomDeviceScaleFactor;
+		_pCefMediator->NotifyScreenInfoChanged(this);
+	}
+	else if (zoomRepaint)
+	{
+		_pCefMediator->RepaintTab(this);
+	}
+
 	// ######################
 	// ### UPDATE OVERLAY ###
 	// ######################
@@ -187,16 +236,7 @@ void Tab::Update(float tpf, Input& rInput)
 	double CEFPixelGazeY = tabInput.webViewPixelGazeY;
 
 	// Update highlight rectangle of webview
-	// TODO: alternative: give webview shared pointer to DOM nodes
-	std::vector<Rect> rects;
-	for (const auto& rIdNodePair : _TextLinkMap)
-	{
-		for (const auto& rRect : rIdNodePair.second->GetRects())
-		{
-			rects.push_back(rRect);
-		}
-	}
-	_upWebView->SetHighlightRects(rects);
+	_upWebView->SetHighlightRects(_TextLinks.GetRects());
 
 	// ###########################
 	// ### UPDATE COLOR OF GUI ###
@@ -240,14 +280,31 @@ void Tab::Update(float tpf, Input& rInput)
 		_gazeDebuggingQueue.pop_back();
 	}
 
-	// Update text in layout
-    eyegui::setContentOfTextBlock(
-        _pDebugLayout,
-        "web_view_coordinate",
+	// Update text in layout when changed
+    std::string debugText =
         "Fixed:\n"
         + std::to_string(webViewPixelGazeX) + ", " + std::to_string(webViewPixelGazeY) + "\n"
         + "Scrolled:\n"
-        + std::to_string((int)(webViewPixelGazeX + _scrollingOffsetX)) + ", " + std::to_string((int)(webViewPixelGazeY + _scrollingOffsetY)));
+        + std::to_string((int)(webViewPixelGazeX + _scrollingOffsetX)) + ", " + std::to_string((int)(webViewPixelGazeY + _scrollingOffsetY)) + "\n"
+        + "Telemetry dropped:\n"
+        + std::to_string(TelemetryBus::instance().GetDroppedCount()) + "\n"
+        + "Worker pool:\n"
+        + WorkerPool::instance().GetReport()
+        + "GPU pool:\n"
+        + GPUPool::instance().GetReport()
+        + "Paints:\n"
+        + _pCefMediator->GetPaintReport();
+    if (debugText != _debugText)
+    {
+        _debugText = debugText;
+        eyegui::setContentOfTextBlock(_pDebugLayout, "web_view_coordinate", _debugText);
+    }
+
+	// Show frame profile
+	if (FrameProfiler::instance().IsActive())
+	{
+		eyegui::setContentOfTextBlock(_pDebugLayout, "frame_profile", FrameProfiler::instance().GetOverlayText());
+	}
 
 	// #######################################
     // ### UPDATE PIPELINE OR STANDARD GUI ###
@@ -263,7 +320,10 @@ void Tab::Update(float tpf, Input& rInput)
 		eyegui::setInputUsageOfLayout(_pPipelineAbortLayout, true);
 
 		// Update current pipeline (if there is one)
-		if (_pipelines.front()->Update(tpf, tabInput))
+		FrameProfiler::instance().BeginStage("Pipeline::Update");
+		bool pipelineFinished = _pipelines.front()->Update(tpf, tabInput);
+		FrameProfiler::instance().EndStage();
+		if (pipelineFinished)
 		{
 			// Remove front element from pipelines
 			_pipelines.front()->Deactivate();
@@ -291,14 +351,6 @@ void Tab::Update(float tpf, Input& rInput)
             EmulateMouseCursor(tabInput.webViewPixelGazeX, tabInput.webViewPixelGazeY);
         }
 
-		// Ask for page resolution
-		_timeUntilGetPageResolution -= tpf;
-		if (_timeUntilGetPageResolution <= 0)
-		{
-			_timeUntilGetPageResolution = TAB_GET_PAGE_RES_INTERVAL;
-			_pCefMediator->GetPageResolution(this);
-		}
-
 		// Enable input for panel layout and disable it for pipeline abort layout
 		eyegui::setInputUsageOfLayout(_pPanelLayout, true);
 		eyegui::setInputUsageOfLayout(_pPipelineAbortLayout, false);
@@ -391,39 +443,45 @@ void Tab::Update(float tpf, Input& rInput)
 		// Use value of auto scrolling to scroll
         if(_autoScrollingValue != 0.0f)
         {
-            _pCefMediator->EmulateMouseWheelScrolling(this, 0.0, (double)(20.f * _autoScrollingValue));
+            if (setup::SMOOTH_SCROLLING)
+            {
+                _scrollController.Scroll((double)(-setup::SMOOTH_SCROLLING_SPEED * _autoScrollingValue * tpf));
+            }
+            else
+            {
+                _pCefMediator->EmulateMouseWheelScrolling(this, 0.0, (double)(20.f * _autoScrollingValue));
+            }
         }
 
 		// Autoscroll inside of DOMOverflowElement if gazed upon
-		bool overflowScrolling = false;
-		for (const auto& rIdOverflowPair : _OverflowElementMap)
+		const std::vector<Rect>& rOverflowRects = _OverflowElements.GetRects();
+		const std::vector<int>& rOverflowOwners = _OverflowElements.GetRectOwners();
+		const std::vector<int>& rOverflowFixedIds = _OverflowElements.GetFixedIds();
+		int lastScrolledOwner = -1;
+		for (int i = 0; i < (int)rOverflowRects.size(); i++)
 		{
-			const auto& rOverflowElement = rIdOverflowPair.second;
-			if (rOverflowElement)
+			// Only first hit rect of each element scrolls it
+			const int owner = rOverflowOwners[i];
+			if (owner == lastScrolledOwner)
 			{
-				for (const auto& rRect : rOverflowElement->GetRects())
-				{
-					int scrolledCEFPixelGazeX = CEFPixelGazeX;
-					int scrolledCEFPixelGazeY = CEFPixelGazeY;
-
-					// Do NOT add scrolling offset if element is fixed
-					if (!rOverflowElement->GetFixedId())
-					{
-						scrolledCEFPixelGazeX += _scrollingOffsetX;
-						scrolledCEFPixelGazeY += _scrollingOffsetY;
-					}
-
-					// Check if current gaze is inside of overflow element, if so execute scrolling method in corresponding Javascript object
-					if (rRect.IsInside(scrolledCEFPixelGazeX, scrolledCEFPixelGazeY))
-					{
-						ScrollOverflowElement(rOverflowElement->GetId(), CEFPixelGazeX, CEFPixelGazeY);
-						break;
-					}
-				}
-				if (overflowScrolling)
-				{
-					break;
-				}
+				continue;
+			}
+
+			int scrolledCEFPixelGazeX = CEFPixelGazeX;
+			int scrolledCEFPixelGazeY = CEFPixelGazeY;
+
+			// Do NOT add scrolling offset if element is fixed
+			if (!rOverflowFixedIds[owner])
+			{
+				scrolledCEFPixelGazeX += _scrollingOffsetX;
+				scrolledCEFPixelGazeY += _scrollingOffsetY;
+			}
+
+			// Check if current gaze is inside of overflow element, if so execute scrolling method in corresponding Javascript object
+			if (rOverflowRects[i].IsInside(scrolledCEFPixelGazeX, scrolledCEFPixelGazeY))
+			{
+				ScrollOverflowElement(_OverflowElements.GetNodes()[owner]->GetId(), CEFPixelGazeX, CEFPixelGazeY);
+				lastScrolledOwner = owner;
 			}
 		}
 		//LogDebug(tabInput.webViewGazeX, "\t",tabInput.webViewGazeY);
@@ -437,6 +495,16 @@ void Tab::Update(float tpf, Input& rInput)
 			pTrigger->Update(tpf, tabInput);
 		}
 	}
+
+	// Request collected scrolling from CEF in steps. Also done while pipeline is active, so shift settles
+	if (setup::SMOOTH_SCROLLING)
+	{
+		double scrollingRequest = _scrollController.Update(tpf, _scrollingOffsetY, _renderedScrollingOffsetY, _pageHeight - _upWebView->GetResolutionY());
+		if (scrollingRequest != 0)
+		{
+			_pCefMediator->EmulateMouseWheelScrolling(this, 0.0, -scrollingRequest); // positive wheel delta scrolls up
+		}
+	}
 }
 
 void Tab::Draw() const
@@ -447,7 +515,9 @@ void Tab::Draw() const
 		_pMaster->GetWindowWidth(),
 		_pMaster->GetWindowHeight(),
 		_scrollingOffsetX,
-		_scrollingOffsetY);
+		_scrollingOffsetY,
+		_scrollController.GetTextureShiftY(),
+		_fixedElements);
 
 	// Decide what to draw
 	if (_pipelineActive)
@@ -473,6 +543,12 @@ void Tab::Draw() const
 
 void Tab::Activate()
 {
+	// Restore browser if tab has been hibernated
+	if (_hibernated)
+	{
+		WakeUp();
+	}
+
 	// Show layouts
 	eyegui::setVisibilityOfLayout(_pOverlayLayout, true, true, false);
 	eyegui::setVisibilityOfLayout(_pScrollingOverlayLayout, true, true, false);
@@ -520,6 +596,7 @@ void Tab::OpenURL(std::string URL)
 	// Reset scrolling
 	_scrollingOffsetX = 0.0;
 	_scrollingOffsetY = 0.0;
+	_renderedScrollingOffsetY = 0.0;
 }
 
 void Tab::AbortAndClearPipelines()
@@ -536,7 +613,27 @@ void Tab::GoForward()
 
 void Tab::GoBack()
 {
-	_pCefMediator->GoBack(this);
+	if (_canGoBack)
+	{
+		_pCefMediator->GoBack(this);
+	}
+	else if (!_restoredBackURLs.empty())
+	{
+		// Browser cannot be told about history from before its creation, so create new one for previous page
+		std::string URL = _restoredBackURLs.back();
+		_restoredBackURLs.pop_back();
+
+		ClearDOMNodes();
+		AbortAndClearPipelines();
+		_loadingFrames.clear();
+		_pCefMediator->UnregisterTab(this);
+
+		_url = URL;
+		_scrollingOffsetX = 0.0;
+		_scrollingOffsetY = 0.0;
+		_renderedScrollingOffsetY = 0.0;
+		_pCefMediator->RegisterTab(this);
+	}
 }
 
 void Tab::Reload()
@@ -550,6 +647,109 @@ void Tab::PushBackPointingEvaluationPipeline(PointingApproach approach)
 	PushBackPipeline(std::unique_ptr<PointingEvaluationPipeline>(new PointingEvaluationPipeline(this, approach)));
 }
 
+void Tab::Hibernate()
+{
+	if (_hibernated) { return; }
+
+	LogInfo("Tab: Hibernating tab with URL ", _url);
+
+	// Keep downscaled snapshot of page for tab overview and until browser has painted again
+	_upWebView->Hibernate(TAB_HIBERNATION_SNAPSHOT_MIP_MAP_LEVEL);
+
+	// Remember scrolling offset, since it is overwritten while new browser loads the page
+	_hibernationScrollingOffsetX = _scrollingOffsetX;
+	_hibernationScrollingOffsetY = _scrollingOffsetY;
+
+	// History of browser is lost when it is closed, so keep it
+	std::vector<std::string> backURLs;
+	CollectBackHistory(backURLs);
+	_restoredBackURLs = backURLs;
+
+	// Nodes and pipelines are bound to the browser
+	ClearDOMNodes();
+	AbortAndClearPipelines();
+	_loadingFrames.clear();
+
+	// Close browser. Title, favicon and URL stay in members
+	_pCefMediator->UnregisterTab(this);
+	_hibernated = true;
+}
+
+void Tab::WakeUp()
+{
+	if (!_hibernated) { return; }
+
+	LogInfo("Tab: Waking up tab with URL ", _url);
+
+	// Create browser again, which loads current URL
+	_hibernated = false;
+	_restoreScrollingAfterLoad = true;
+	_pCefMediator->RegisterTab(this);
+}
+
+void Tab::SetRenderScale(float renderScale)
+{
+	if (renderScale == _upWebView->GetRenderScale()) { return; }
+
+	// Browser asks for device scale factor again when told about changed screen
+	_upWebView->SetRenderScale(renderScale);
+	if (_zoomDeviceScaleFactor <= 1.f)
+	{
+		_pCefMediator->NotifyScreenInfoChanged(this);
+	}
+}
+
+size_t Tab::GetEstimatedMemoryUsage() const
+{
+	size_t bytes = _upWebView->GetEstimatedMemoryUsage();
+	if (!_hibernated)
+	{
+		bytes += (size_t)TAB_ESTIMATED_RENDERER_MEMORY_MB * 1024 * 1024;
+	}
+	return bytes;
+}
+
+void Tab::GetSession(SessionManager::TabSession& rSession, bool withThumbnail)
+{
+	rSession.URL = _url;
+	rSession.title = _title;
+	CollectBackHistory(rSession.backURLs);
+	rSession.scrollingOffsetX = _hibernated ? _hibernationScrollingOffsetX : _scrollingOffsetX;
+	rSession.scrollingOffsetY = _hibernated ? _hibernationScrollingOffsetY : _scrollingOffsetY;
+	rSession.zoomLevel = _zoomLevel;
+
+	// Read back downscaled rendering
+	if (withThumbnail
+		&& !_upWebView->GetSnapshot(SESSION_THUMBNAIL_MIP_MAP_LEVEL, rSession.thumbnailWidth, rSession.thumbnailHeight, rSession.thumbnail))
+	{
+		rSession.thumbnail.clear();
+		rSession.thumbnailWidth = 0;
+		rSession.thumbnailHeight = 0;
+	}
+}
+
+void Tab::CollectBackHistory(std::vector<std::string>& rURLs)
+{
+	// History from before browser creation
+	rURLs = _restoredBackURLs;
+
+	// History of browser. Blank page is loaded by every new browser before actual URL
+	std::vector<std::string> browserURLs;
+	if (!_hibernated && _pCefMediator->GetBackHistory(this, browserURLs))
+	{
+		for (const auto& rURL : browserURLs)
+		{
+			if (rURL != BLANK_PAGE_URL) { rURLs.push_back(rURL); }
+		}
+	}
+
+	// Keep only most recent entries
+	if (rURLs.size() > SESSION_MAX_BACK_URLS)
+	{
+		rURLs.erase(rURLs.begin(), rURLs.end() - SESSION_MAX_BACK_URLS);
+	}
+}
+
 void Tab::SetPipelineActivity(bool active)
 {
 	if (active)
@@ -626,54 +826,22 @@ void Tab::UpdateAccentColor(float tpf)
 		backgroundAccentColor.a * backgroundAlpha);
 
 	// Set color of tab_panel style
-	_pMaster->SetStyleTreePropertyValue(
-		"tab_panel",
-		eyegui::StylePropertyVec4::Color,
-		RGBAToHexString(colorAccent)
-	);
+	_pPanelColorStyle->Set(colorAccent);
 
 	// Set color of tab_overlay style
-	_pMaster->SetStyleTreePropertyValue(
-		"tab_overlay",
-		eyegui::StylePropertyVec4::Color,
-		RGBAToHexString(colorAccent)
-	);
-	_pMaster->SetStyleTreePropertyValue(
-		"tab_overlay",
-		eyegui::StylePropertyVec4::BackgroundColor,
-		RGBAToHexString(backgroundAccentColor)
-	);
+	_pOverlayColorStyle->Set(colorAccent);
+	_pOverlayBackgroundColorStyle->Set(backgroundAccentColor);
 
 	// Set color of tab_overlay_noback style
-	_pMaster->SetStyleTreePropertyValue(
-		"tab_overlay_noback",
-		eyegui::StylePropertyVec4::Color,
-		RGBAToHexString(colorAccent)
-	);
+	_pOverlayNoBackColorStyle->Set(colorAccent);
 
 	// Set color of tab_overlay_panel style
-	_pMaster->SetStyleTreePropertyValue(
-		"tab_overlay_panel",
-		eyegui::StylePropertyVec4::Color,
-		RGBAToHexString(backgroundAccentColor)
-	);
-	_pMaster->SetStyleTreePropertyValue(
-		"tab_overlay_panel",
-		eyegui::StylePropertyVec4::BackgroundColor,
-		RGBAToHexString(panelBackgroundAccentColor)
-	);
+	_pOverlayPanelColorStyle->Set(backgroundAccentColor);
+	_pOverlayPanelBackgroundColorStyle->Set(panelBackgroundAccentColor);
 
 	// Set color and background of tab_overlay_scroll_progress
-	_pMaster->SetStyleTreePropertyValue(
-		"tab_overlay_scroll_progress",
-		eyegui::StylePropertyVec4::Color,
-		RGBAToHexString(transparentColorAccent)
-	);
-	_pMaster->SetStyleTreePropertyValue(
-		"tab_overlay_scroll_progress",
-		eyegui::StylePropertyVec4::BackgroundColor,
-		RGBAToHexString(transparentBackgroundColorAccent)
-	);
+	_pScrollProgressColorStyle->Set(transparentColorAccent);
+	_pScrollProgressBackgroundColorStyle->Set(transparentBackgroundColorAccent);
 }
 
 
@@ -56,6 +56,9 @@ public:
 	// Convert CEFPixel coordinate to WebViewPixel coordinate
 	virtual void ConvertToWebViewPixel(double& rCEFPixelX, double& rCEFPixelY) const = 0;
 
+	// Get shift of displayed page ahead of CEF while smooth scrolling. Zero upon fixed elements, as those are not shifted
+	virtual double GetScrollingShiftY(double CEFPixelX, double CEFPixelY) const = 0;
+
 	// Reply JavaScript dialog callback
 	virtual void ReplyJSDialog(bool clickedOk, std::string userInput) = 0;
 
@@ -29,6 +29,10 @@ public:
     // Tell CEF callback which resolution web view texture should have
     virtual void GetWebRenderResolution(int& rWidth, int& rHeight) const = 0;
 
+    // Tell CEF callback with which device scale factor to render. Render scale is used outside of zooming
+    virtual float GetDeviceScaleFactor() const = 0;
+    virtual float GetRenderScale() const = 0;
+
     // Getter and setter for favicon URL
     virtual std::string GetFavIconURL() const = 0;
     virtual void SetFavIconURL(std::string url) = 0;
@@ -47,6 +51,9 @@ public:
     // Get weak pointer to texture of web view
     virtual std::weak_ptr<Texture> GetWebViewTexture() = 0;
 
+    // Receive rendering with device scale factor above one, of which web view keeps zoomed region only
+    virtual void FillZoomTexture(int width, int height, const unsigned char* pBuffer) = 0;
+
 	// Add, remove and update Tab's current DOMNodes
     virtual void AddDOMTextInput(int id) = 0;
 	virtual void AddDOMLink(int id) = 0;
@@ -67,6 +74,9 @@ public:
     // Receive callbacks from CefMediator upon scrolling offset changes
     virtual void SetScrollingOffset(double x, double y) = 0;
 
+    // Receive vertical scrolling offset of paint which has been uploaded into texture of web view
+    virtual void SetRenderedScrollingOffset(double y) = 0;
+
     // Getter for URL
     virtual std::string GetURL() const = 0;
 
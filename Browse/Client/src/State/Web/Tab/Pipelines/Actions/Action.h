@@ -41,51 +41,31 @@ public:
 
 	// Set input data value
 	template <typename T>
-	void SetInputValue(std::string type, T value) { _inputData.SetValue(type, value); }
+	void SetInputValue(ActionSlot<T> slot, typename ActionSlotValue<T>::type value) { _inputData.SetValue(slot, value); }
 
     // Get output data value in reference and returns, whether value was filled
 	template <typename T>
-	bool GetOutputValue(std::string type, T& rValue) const { return _outputData.GetValue(type, rValue); }
+	bool GetOutputValue(ActionSlot<T> slot, T& rValue) const { return _outputData.GetValue(slot, rValue); }
+
+	// Access data maps, used by connectors to resolve slots once
+	ActionDataMap& GetInputData() { return _inputData; }
+	const ActionDataMap& GetOutputData() const { return _outputData; }
 
 protected:
 
-    // Add slot to data maps with default values
-	void AddIntInputSlot		(std::string type)	{ _inputData.AddIntSlot(type); }
-	void AddInt64InputSlot		(std::string type)	{ _inputData.AddInt64Slot(type); }
-	void AddFloatInputSlot		(std::string type)	{ _inputData.AddFloatSlot(type); }
-    void AddVec2InputSlot		(std::string type)	{ _inputData.AddVec2Slot(type); }
-    void AddStringInputSlot		(std::string type)	{ _inputData.AddStringSlot(type); }
-	void AddString16InputSlot	(std::string type)	{ _inputData.AddString16Slot(type); }
-
-	void AddIntOutputSlot		(std::string type)	{ _outputData.AddIntSlot(type); }
-    void AddInt64OutputSlot		(std::string type)	{ _outputData.AddInt64Slot(type); }
-    void AddFloatOutputSlot		(std::string type)	{ _outputData.AddFloatSlot(type); }
-    void AddVec2OutputSlot		(std::string type)	{ _outputData.AddVec2Slot(type); }
-    void AddStringOutputSlot	(std::string type)	{ _outputData.AddStringSlot(type); }
-    void AddString16OutputSlot	(std::string type)	{ _outputData.AddString16Slot(type); }
-
-	// Add slot to data maps with custom values
-	void AddIntInputSlot		(std::string type, int value)				{ _inputData.AddIntSlot(type, value); }
-	void AddInt64InputSlot		(std::string type, int64 value)				{ _inputData.AddInt64Slot(type, value); }
-	void AddFloatInputSlot		(std::string type, float value)				{ _inputData.AddFloatSlot(type, value); }
-	void AddVec2InputSlot		(std::string type, glm::vec2 value)			{ _inputData.AddVec2Slot(type, value); }
-	void AddStringInputSlot		(std::string type, std::string value)		{ _inputData.AddStringSlot(type, value); }
-	void AddString16InputSlot	(std::string type, std::u16string value)	{ _inputData.AddString16Slot(type, value); }
-
-	void AddIntOutputSlot		(std::string type, int value)				{ _outputData.AddIntSlot(type, value); }
-	void AddInt64OutputSlot		(std::string type, int64 value)				{ _outputData.AddInt64Slot(type, value); }
-	void AddFloatOutputSlot		(std::string type, float value)				{ _outputData.AddFloatSlot(type, value); }
-	void AddVec2OutputSlot		(std::string type, glm::vec2 value)			{ _outputData.AddVec2Slot(type, value); }
-	void AddStringOutputSlot	(std::string type, std::string value)		{ _outputData.AddStringSlot(type, value); }
-	void AddString16OutputSlot	(std::string type, std::u16string value)	{ _outputData.AddString16Slot(type, value); }
+    // Add slot to data maps with default or custom value
+	template <typename T>
+	void AddInputSlot(ActionSlot<T> slot, typename ActionSlotValue<T>::type value = T()) { _inputData.AddSlot(slot, value); }
+	template <typename T>
+	void AddOutputSlot(ActionSlot<T> slot, typename ActionSlotValue<T>::type value = T()) { _outputData.AddSlot(slot, value); }
 
     // Get input data value in reference and returns, whether value was filled
 	template <typename T>
-	bool GetInputValue(std::string type, T& rValue) const { return _inputData.GetValue(type, rValue); }
+	bool GetInputValue(ActionSlot<T> slot, T& rValue) const { return _inputData.GetValue(slot, rValue); }
 
     // Set output data value
 	template <typename T>
-	void SetOutputValue(std::string type, T value) { _outputData.SetValue(type, value); }
+	void SetOutputValue(ActionSlot<T> slot, typename ActionSlotValue<T>::type value) { _outputData.SetValue(slot, value); }
 
     // Pointer to interface which enables interaction with tab
     TabInteractionInterface* _pTab;
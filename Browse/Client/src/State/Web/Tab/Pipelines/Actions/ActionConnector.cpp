@@ -13,35 +13,17 @@ ActionConnector::ActionConnector(std::weak_ptr<const Action> wpPrevious, std::we
 
 void ActionConnector::Execute()
 {
-    // Connect per datatype
-	Execute<int>(_intConnections);
-	Execute<float>(_floatConnections);
-	Execute<glm::vec2>(_vec2Connections);
-	Execute<std::string>(_stringConnections);
-	Execute<std::u16string>(_string16Connections);
-}
-
-void ActionConnector::ConnectInt(std::string previousType, std::string nextType)
-{
-   _intConnections[previousType] = nextType;
-}
-
-void ActionConnector::ConnectFloat(std::string previousType, std::string nextType)
-{
-    _floatConnections[previousType] = nextType;
-}
+	auto spPrevious = _wpPrevious.lock();
+	auto spNext = _wpNext.lock();
+	if (!spPrevious || !spNext) { return; }
+	const ActionDataMap& rPrevious = spPrevious->GetOutputData();
+	ActionDataMap& rNext = spNext->GetInputData();
 
-void ActionConnector::ConnectVec2(std::string previousType, std::string nextType)
-{
-    _vec2Connections[previousType] = nextType;
-}
-
-void ActionConnector::ConnectString(std::string previousType, std::string nextType)
-{
-    _stringConnections[previousType] = nextType;
+    // Connect per datatype
+	Execute<int>(rPrevious, rNext, _intConnections);
+	Execute<int64>(rPrevious, rNext, _int64Connections);
+	Execute<float>(rPrevious, rNext, _floatConnections);
+	Execute<glm::vec2>(rPrevious, rNext, _vec2Connections);
+	Execute<std::string>(rPrevious, rNext, _stringConnections);
+	Execute<std::u16string>(rPrevious, rNext, _string16Connections);
 }
-
-void ActionConnector::ConnectString16(std::string previousType, std::string nextType)
-{
-	_string16Connections[previousType] = nextType;
-}
\ No newline at end of file
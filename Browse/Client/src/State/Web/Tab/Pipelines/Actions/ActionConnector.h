@@ -3,13 +3,16 @@
 // Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
 //============================================================================
 // Connects output ActionDataMap of one Action with input ActionDataMap of other.
+// Slots are resolved to positions in the data maps when connected, so
+// execution only copies values.
 
 #ifndef ACTIONCONNECTOR_H_
 #define ACTIONCONNECTOR_H_
 
 #include "src/State/Web/Tab/Pipelines/Actions/Action.h"
-#include <map>
 #include <memory>
+#include <utility>
+#include <vector>
 
 class ActionConnector
 {
@@ -24,37 +27,58 @@ public:
     // Get pointer to previous to decide about execution
 	std::weak_ptr<const Action> GetPreviousAction() const { return _wpPrevious; }
 
-    // Connect
-    void ConnectInt(std::string previousType, std::string nextType);
-    void ConnectFloat(std::string previousType, std::string nextType);
-    void ConnectVec2(std::string previousType, std::string nextType);
-    void ConnectString(std::string previousType, std::string nextType);
-    void ConnectString16(std::string previousType, std::string nextType);
+    // Connect output slot of previous action with input slot of next. Returns whether both slots exist
+	template <typename T>
+	bool Connect(ActionSlot<T> previousSlot, ActionSlot<T> nextSlot)
+	{
+		auto spPrevious = _wpPrevious.lock();
+		auto spNext = _wpNext.lock();
+		if (!spPrevious || !spNext) { return false; }
+		const int previousIndex = spPrevious->GetOutputData().GetIndex(previousSlot);
+		const int nextIndex = spNext->GetInputData().GetIndex(nextSlot);
+		if (previousIndex < 0 || nextIndex < 0)
+		{
+			LogBug("ActionConnector cannot connect ", previousSlot.name, " with ", nextSlot.name);
+			return false;
+		}
+		Connections((T*)nullptr).push_back(std::make_pair(previousIndex, nextIndex));
+		return true;
+	}
 
 private:
 
-	// Private execute. Executes copying of values for one datatype.
+	// Pair of position in output map of previous and input map of next action
+	typedef std::vector<std::pair<int, int> > ConnectionList;
+
+	// Private execute. Executes copying of values for one datatype
 	template <typename T>
-	void Execute(std::map<std::string, std::string>& rConnectionMap)
+	void Execute(const ActionDataMap& rPrevious, ActionDataMap& rNext, const ConnectionList& rConnections)
 	{
-		for (const auto& rConnection : rConnectionMap)
+		for (const auto& rConnection : rConnections)
 		{
-			T value;
-			if (auto spPrevious = _wpPrevious.lock()) { spPrevious->GetOutputValue(rConnection.first, value); }
-			if (auto spNext = _wpNext.lock()) { spNext->SetInputValue(rConnection.second, value); }
+			rNext.GetData<T>(rConnection.second).SetValue(rPrevious.GetData<T>(rConnection.first).GetValue());
 		}
 	}
 
+	// Connections per datatype, selected by type of pointer
+	ConnectionList& Connections(int*)				{ return _intConnections; }
+	ConnectionList& Connections(int64*)				{ return _int64Connections; }
+	ConnectionList& Connections(float*)				{ return _floatConnections; }
+	ConnectionList& Connections(glm::vec2*)			{ return _vec2Connections; }
+	ConnectionList& Connections(std::string*)		{ return _stringConnections; }
+	ConnectionList& Connections(std::u16string*)	{ return _string16Connections; }
+
     // Pointer to actions
     std::weak_ptr<const Action> _wpPrevious;
 	std::weak_ptr<Action> _wpNext;
 
-    // Map of connections
-    std::map<std::string, std::string> _intConnections;
-    std::map<std::string, std::string> _floatConnections;
-    std::map<std::string, std::string> _vec2Connections;
-    std::map<std::string, std::string> _stringConnections;
-    std::map<std::string, std::string> _string16Connections;
+    // Connections
+	ConnectionList _intConnections;
+	ConnectionList _int64Connections;
+	ConnectionList _floatConnections;
+	ConnectionList _vec2Connections;
+	ConnectionList _stringConnections;
+	ConnectionList _string16Connections;
 };
 
 #endif // ACTIONCONNECTOR_H_
@@ -2,92 +2,111 @@
 // Distributed under the Apache License, Version 2.0.
 // Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
 //============================================================================
-// Map of string, defining type of data or semantic of data, and C++ data type.
+// Slots of data, addressed by typed keys. Data is stored in flat vectors per
+// C++ data type and a table maps slot id to position in them, so access
+// involves neither string comparison nor allocation.
 // Every action has one ActionDataMap as input and one as output.
 
 #ifndef ACTIONDATAMAP_H_
 #define ACTIONDATAMAP_H_
 
 #include "src/State/Web/Tab/Pipelines/Actions/ActionData.h"
+#include "src/State/Web/Tab/Pipelines/Actions/ActionSlot.h"
 #include "src/Typedefs.h"
 #include "src/Utils/glmWrapper.h"
 #include "src/Utils/Logger.h"
-#include <map>
-#include <memory>
+#include <vector>
 
 class ActionDataMap
 {
 public:
 
-    // Add slot to map
-    void AddIntSlot(std::string type, int value = 0);
-    void AddInt64Slot(std::string type, int64 value = 0);
-	void AddFloatSlot(std::string type, float value = 0.f);
-    void AddVec2Slot(std::string type, glm::vec2 value = glm::vec2(0.f, 0.f));
-    void AddStringSlot(std::string type, std::string value = "");
-    void AddString16Slot(std::string type, std::u16string value = u"");
+	// Constructor
+	ActionDataMap();
 
-    // Set value of data
-    void SetValue(std::string type, int value)				{ SetValue<int>(type, value, _intMap); }
-    void SetValue(std::string type, int64 value)			{ SetValue<int64>(type, value, _int64Map); }
-    void SetValue(std::string type, float value)			{ SetValue<float>(type, value, _floatMap); }
-    void SetValue(std::string type, glm::vec2 value)		{ SetValue<glm::vec2>(type, value, _vec2Map); }
-    void SetValue(std::string type, std::string value)		{ SetValue<std::string>(type, value, _stringMap); }
-    void SetValue(std::string type, std::u16string value)	{ SetValue<std::u16string>(type, value, _string16Map); }
-
-    // Fills value into given reference variable. Returns whether value was filled actively
-    bool GetValue(std::string type, int& rValue) const				{ return GetValue<int>(type, rValue, _intMap); }
-    bool GetValue(std::string type, int64& rValue) const			{ return GetValue<int64>(type, rValue, _int64Map); }
-    bool GetValue(std::string type, float& rValue) const			{ return GetValue<float>(type, rValue, _floatMap); }
-    bool GetValue(std::string type, glm::vec2& rValue) const		{ return GetValue<glm::vec2>(type, rValue, _vec2Map); }
-    bool GetValue(std::string type, std::string& rValue) const		{ return GetValue<std::string>(type, rValue, _stringMap); }
-	bool GetValue(std::string type, std::u16string& rValue) const	{ return GetValue<std::u16string>(type, rValue, _string16Map); }
-
-private:
-
-	// Type definition of data map
-	template <typename T>
-	using InternalDataMap = std::map<std::string, std::unique_ptr<ActionData< T > > >;
-
-	// Set value template method
+	// Add slot to map. Replaces value of existing slot
 	template <typename T>
-	void SetValue(std::string type, T value, InternalDataMap<T>& rMap)
+	void AddSlot(ActionSlot<T> slot, typename ActionSlotValue<T>::type value = T())
 	{
-		auto iter = rMap.find(type);
-		if (iter != rMap.end())
+		int& rIndex = _indices[(int)slot.id];
+		std::vector<ActionData<T> >& rStorage = Storage((T*)nullptr);
+		if (rIndex >= 0)
 		{
-			iter->second->SetValue(value);
+			rStorage[rIndex] = ActionData<T>(value);
 		}
 		else
 		{
-			LogBug("No slot in ActionDataMap for ", type);
+			rIndex = (int)rStorage.size();
+			rStorage.push_back(ActionData<T>(value));
 		}
 	}
 
-	// Get value template method. Returns whether value was filled actively
+	// Set value of data
 	template <typename T>
-	bool GetValue(std::string type, T& rValue, const InternalDataMap<T>& rMap) const
+	void SetValue(ActionSlot<T> slot, typename ActionSlotValue<T>::type value)
 	{
-		auto iter = rMap.find(type);
-		if (iter != rMap.end())
+		const int index = GetIndex(slot);
+		if (index >= 0)
 		{
-			rValue = iter->second->GetValue();
-			return iter->second->IsFilled();
+			Storage((T*)nullptr)[index].SetValue(value);
 		}
 		else
 		{
-			LogBug("No slot in ActionDataMap for ", type);
+			LogBug("No slot in ActionDataMap for ", slot.name);
 		}
+	}
+
+	// Fills value into given reference variable. Returns whether value was filled actively
+	template <typename T>
+	bool GetValue(ActionSlot<T> slot, T& rValue) const
+	{
+		const int index = GetIndex(slot);
+		if (index >= 0)
+		{
+			const ActionData<T>& rData = Storage((T*)nullptr)[index];
+			rValue = rData.GetValue();
+			return rData.IsFilled();
+		}
+		LogBug("No slot in ActionDataMap for ", slot.name);
 		return false;
 	}
 
-    // Maps with data
-	InternalDataMap<int>			_intMap;
-	InternalDataMap<int64>			_int64Map;
-	InternalDataMap<float>			_floatMap;
-	InternalDataMap<glm::vec2>		_vec2Map;
-	InternalDataMap<std::string>	_stringMap;
-	InternalDataMap<std::u16string>	_string16Map;
+	// Get position of slot in storage of its data type. Returns -1 if slot does not exist
+	template <typename T>
+	int GetIndex(ActionSlot<T> slot) const { return _indices[(int)slot.id]; }
+
+	// Access data by position, which is retrieved once through GetIndex
+	template <typename T>
+	ActionData<T>& GetData(int index) { return Storage((T*)nullptr)[index]; }
+	template <typename T>
+	const ActionData<T>& GetData(int index) const { return Storage((T*)nullptr)[index]; }
+
+private:
+
+	// Storage per data type, selected by type of pointer
+	std::vector<ActionData<int> >& Storage(int*)								{ return _ints; }
+	std::vector<ActionData<int64> >& Storage(int64*)							{ return _int64s; }
+	std::vector<ActionData<float> >& Storage(float*)							{ return _floats; }
+	std::vector<ActionData<glm::vec2> >& Storage(glm::vec2*)					{ return _vec2s; }
+	std::vector<ActionData<std::string> >& Storage(std::string*)				{ return _strings; }
+	std::vector<ActionData<std::u16string> >& Storage(std::u16string*)			{ return _string16s; }
+	const std::vector<ActionData<int> >& Storage(int*) const					{ return _ints; }
+	const std::vector<ActionData<int64> >& Storage(int64*) const				{ return _int64s; }
+	const std::vector<ActionData<float> >& Storage(float*) const				{ return _floats; }
+	const std::vector<ActionData<glm::vec2> >& Storage(glm::vec2*) const		{ return _vec2s; }
+	const std::vector<ActionData<std::string> >& Storage(std::string*) const	{ return _strings; }
+	const std::vector<ActionData<std::u16string> >& Storage(std::u16string*) const { return _string16s; }
+
+	// Position of each slot in storage of its type, -1 if not added
+	int _indices[(int)ActionSlotId::COUNT];
+
+	// Storage with data
+	std::vector<ActionData<int> >				_ints;
+	std::vector<ActionData<int64> >				_int64s;
+	std::vector<ActionData<float> >				_floats;
+	std::vector<ActionData<glm::vec2> >			_vec2s;
+	std::vector<ActionData<std::string> >		_strings;
+	std::vector<ActionData<std::u16string> >	_string16s;
 };
 
 #endif // ACTIONDATAMAP_H_
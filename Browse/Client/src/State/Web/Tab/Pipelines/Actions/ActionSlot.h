@@ -0,0 +1,51 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+// Keys of data slots of actions. Each key binds semantic of data to its C++
+// data type, so accessing a slot with wrong type or connecting slots of
+// different types does not compile. Ids index flat storage of ActionDataMap.
+
+#ifndef ACTIONSLOT_H_
+#define ACTIONSLOT_H_
+
+#include "src/Typedefs.h"
+#include "src/Utils/glmWrapper.h"
+#include <string>
+
+// Ids of all slots. Add key below for new ones
+enum class ActionSlotId
+{
+	Coordinate, Visualize, Scrolling, FrameId, NodeId, Text, Submit, ClickedOk, UserInput,
+	COUNT
+};
+
+// Key of slot with data type
+template <typename T>
+struct ActionSlot
+{
+	ActionSlotId id;
+	const char* name;
+};
+
+// Helper to prevent deduction of data type from value instead of slot
+template <typename T>
+struct ActionSlotValue
+{
+	typedef T type;
+};
+
+namespace slot
+{
+	static const ActionSlot<glm::vec2>		Coordinate	= { ActionSlotId::Coordinate,	"coordinate" };
+	static const ActionSlot<int>			Visualize	= { ActionSlotId::Visualize,	"visualize" };
+	static const ActionSlot<glm::vec2>		Scrolling	= { ActionSlotId::Scrolling,	"scrolling" };
+	static const ActionSlot<int64>			FrameId		= { ActionSlotId::FrameId,		"frameId" };
+	static const ActionSlot<int>			NodeId		= { ActionSlotId::NodeId,		"nodeId" };
+	static const ActionSlot<std::u16string>	Text		= { ActionSlotId::Text,			"text" };
+	static const ActionSlot<int>			Submit		= { ActionSlotId::Submit,		"submit" };
+	static const ActionSlot<int>			ClickedOk	= { ActionSlotId::ClickedOk,	"clickedOk" };
+	static const ActionSlot<std::u16string>	UserInput	= { ActionSlotId::UserInput,	"userInput" };
+}
+
+#endif // ACTIONSLOT_H_
@@ -16,7 +16,7 @@ DriftCorrectionAction::DriftCorrectionAction(TabInteractionInterface* pTab, bool
 	_doDimming = doDimming;
 
     // Add in- and output data slots
-    AddVec2OutputSlot("coordinate");
+    AddOutputSlot(slot::Coordinate);
 }
 
 bool DriftCorrectionAction::Update(float tpf, TabInput tabInput)
@@ -134,7 +134,7 @@ bool DriftCorrectionAction::Update(float tpf, TabInput tabInput)
 		pageCoordinate(_logZoom, _relativeZoomCoordinate, _relativeCenterOffset, pixelGazeCoordinate);
 
 		// Set coordinate in output value. Use current gaze position
-		SetOutputValue("coordinate", pixelGazeCoordinate);
+		SetOutputValue(slot::Coordinate, pixelGazeCoordinate);
 
 		// Return success
 		finished = true;
@@ -188,7 +188,7 @@ bool DriftCorrectionAction::Update(float tpf, TabInput tabInput)
 				glm::vec2 drift = pixelGazeCoordinate - samplePixelGazeCoordinate;
 				float radius = glm::length(drift) / ((1.f/_logZoom) - (1.f/_sampleData.logZoom));
 				glm::vec2 fixation = (glm::normalize(drift) * radius) + samplePixelZoomCoordinate;
-				SetOutputValue("coordinate", fixation);
+				SetOutputValue(slot::Coordinate, fixation);
 
 				// Return success
 				// finished = true; // TODO debugging
@@ -247,7 +247,7 @@ void DriftCorrectionAction::Draw() const
 
 		// Click coordinate
 		glm::vec2 coordinate;
-		if (GetOutputValue("coordinate", coordinate)) // only show when set
+		if (GetOutputValue(slot::Coordinate, coordinate)) // only show when set
 		{
 			// TODO: convert from CEF Pixel space to WebView Pixel space
 			_pTab->Debug_DrawRectangle(coordinate, glm::vec2(5, 5), glm::vec3(0, 1, 0));
@@ -16,7 +16,7 @@ DynamicDriftCorrectionAction::DynamicDriftCorrectionAction(TabInteractionInterfa
 	_doDimming = doDimming;
 
     // Add in- and output data slots
-    AddVec2OutputSlot("coordinate");
+    AddOutputSlot(slot::Coordinate);
 }
 
 bool DynamicDriftCorrectionAction::Update(float tpf, TabInput tabInput)
@@ -134,7 +134,7 @@ bool DynamicDriftCorrectionAction::Update(float tpf, TabInput tabInput)
 		pageCoordinate(_logZoom, _relativeZoomCoordinate, _relativeCenterOffset, pixelGazeCoordinate); // CEFPixel space
 
 		// Set coordinate in output value. Use current gaze position
-		SetOutputValue("coordinate", pixelGazeCoordinate);
+		SetOutputValue(slot::Coordinate, pixelGazeCoordinate);
 
 		// Return success
 		finished = true;
@@ -190,7 +190,7 @@ bool DynamicDriftCorrectionAction::Update(float tpf, TabInput tabInput)
 				// Decide to go directly for zoom coordinate (good calibration) or drift corrected coordinate (poor calibration) or continue zooming
 				if (zoomCoordinateDelta < 1.f) // zoom coordinate has not changed in pixels on page
 				{
-					SetOutputValue("coordinate", _relativeZoomCoordinate * cefPixels);
+					SetOutputValue(slot::Coordinate, _relativeZoomCoordinate * cefPixels);
 					// finished = true; // TODO debugging
 					_state = State::DEBUG;
 					LogInfo("Zoom coordinate used");
@@ -210,7 +210,7 @@ bool DynamicDriftCorrectionAction::Update(float tpf, TabInput tabInput)
 
 					// Actual fixation point
 					glm::vec2 fixation = (glm::normalize(zoomCoordinateDeltaVector) * radius) + samplePixelZoomCoordinate;
-					SetOutputValue("coordinate", fixation);
+					SetOutputValue(slot::Coordinate, fixation);
 
 					// finished = true; // TODO debugging
 					_state = State::DEBUG;
@@ -274,7 +274,7 @@ void DynamicDriftCorrectionAction::Draw() const
 
 		// Click coordinate
 		glm::vec2 coordinate;
-		if (GetOutputValue("coordinate", coordinate)) // only show when set
+		if (GetOutputValue(slot::Coordinate, coordinate)) // only show when set
 		{
 			// TODO: convert from CEF Pixel space to WebView Pixel space
 			_pTab->Debug_DrawRectangle(coordinate, glm::vec2(5, 5), glm::vec3(0, 1, 0));
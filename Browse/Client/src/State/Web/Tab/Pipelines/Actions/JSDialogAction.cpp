@@ -10,7 +10,7 @@
 JSDialogAction::JSDialogAction(TabInteractionInterface* pTab, std::string message, bool enableCancel) : Action(pTab)
 {
 	// Add output slot for clickedOk
-	AddIntOutputSlot("clickedOk");
+	AddOutputSlot(slot::ClickedOk);
 
     // Create id, which is unique in overlay
     _overlayOkButtonId = "jsdialog_ok_button";
@@ -38,7 +38,7 @@ JSDialogAction::JSDialogAction(TabInteractionInterface* pTab, std::string messag
         _overlayOkButtonId,
         [&]() // down callback
         {
-			SetOutputValue("clickedOk", 1);
+			SetOutputValue(slot::ClickedOk, 1);
             this->_done = true;
         },
         [](){}); // up callback
@@ -46,7 +46,7 @@ JSDialogAction::JSDialogAction(TabInteractionInterface* pTab, std::string messag
 		_overlayCancelButtonId,
 		[&]() // down callback
 		{
-			SetOutputValue("clickedOk", 0);
+			SetOutputValue(slot::ClickedOk, 0);
 			this->_done = true;
 		},
 		[]() {}); // up callback
@@ -12,9 +12,9 @@
 KeyboardAction::KeyboardAction(TabInteractionInterface *pTab) : Action(pTab)
 {
     // Add in- and output data slots
-	AddString16InputSlot("text");
-    AddString16OutputSlot("text");
-    AddIntOutputSlot("submit");
+	AddInputSlot(slot::Text);
+    AddOutputSlot(slot::Text);
+    AddOutputSlot(slot::Submit);
 
     // Create id, which is unique in overlay
     _overlayKeyboardId = "text_input_action_keyboard";
@@ -425,10 +425,10 @@ bool KeyboardAction::Update(float tpf, TabInput tabInput)
     if (_complete)
     {
         // Fill collected input to output
-        SetOutputValue("text", _pTab->GetContentOfTextEdit(_overlayTextEditId));
+        SetOutputValue(slot::Text, _pTab->GetContentOfTextEdit(_overlayTextEditId));
 
         // Submit text directly if wished
-        SetOutputValue("submit", _submit);
+        SetOutputValue(slot::Submit, _submit);
 
 		JSMailer::instance().Send("submit");
 
@@ -453,7 +453,7 @@ void KeyboardAction::Activate()
 
 	// Get text from input
 	std::u16string text;
-	GetInputValue<std::u16string>("text", text);
+	GetInputValue(slot::Text, text);
 
 	// Put text into preview
 	_pTab->AddContentAtCursorInTextEdit(_overlayTextEditId, text); // TODO: set content would be better here
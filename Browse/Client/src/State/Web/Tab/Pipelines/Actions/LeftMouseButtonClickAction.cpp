@@ -9,19 +9,19 @@
 LeftMouseButtonClickAction::LeftMouseButtonClickAction(TabInteractionInterface* pTab) : Action(pTab)
 {
     // Add in- and output data slots
-    AddVec2InputSlot("coordinate");
-	AddIntInputSlot("visualize", 1);
+    AddInputSlot(slot::Coordinate);
+	AddInputSlot(slot::Visualize, 1);
 }
 
 bool LeftMouseButtonClickAction::Update(float tpf, TabInput tabInput)
 {
     // Get coordinate from input slot
     glm::vec2 coordinate;
-    GetInputValue("coordinate", coordinate);
+    GetInputValue(slot::Coordinate, coordinate);
 
 	// Get whether should be visualized
     int visualize = 0;
-	GetInputValue("visualize", visualize);
+	GetInputValue(slot::Visualize, visualize);
 
     // Emulate left mouse button click
     _pTab->EmulateLeftMouseButtonClick((double)(coordinate.x), (double)(coordinate.y), visualize > 0);
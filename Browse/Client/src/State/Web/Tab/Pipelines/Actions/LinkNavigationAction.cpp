@@ -12,23 +12,23 @@
 LinkNavigationAction::LinkNavigationAction(TabInteractionInterface* pTab) : Action(pTab)
 {
     // Add in- and output data slots
-    AddVec2InputSlot("coordinate");
-	AddIntInputSlot("visualize", 1);
+    AddInputSlot(slot::Coordinate);
+	AddInputSlot(slot::Visualize, 1);
 }
 
 bool LinkNavigationAction::Update(float tpf, TabInput tabInput)
 {
     // Get coordinate from input slot (WebViewPixel space)
     glm::vec2 coordinate;
-    GetInputValue("coordinate", coordinate);
+    GetInputValue(slot::Coordinate, coordinate);
 
 	// Get whether should be visualized
     int visualize = 0;
-	GetInputValue("visualize", visualize);
+	GetInputValue(slot::Visualize, visualize);
 
     // Decide what to click
 	double CEFPixelX = coordinate.x;
-	double CEFPixelY = coordinate.y;
+	double CEFPixelY = coordinate.y + _pTab->GetScrollingShiftY(coordinate.x, coordinate.y); // coordinate is on displayed page
     double scrollingX, scrollingY;
     _pTab->GetScrollingOffset(scrollingX, scrollingY);
 
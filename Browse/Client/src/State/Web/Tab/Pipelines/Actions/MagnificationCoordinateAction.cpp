@@ -14,7 +14,7 @@ MagnificationCoordinateAction::MagnificationCoordinateAction(TabInteractionInter
 	_doDimming = doDimming;
 
     // Add in- and output data slots
-    AddVec2OutputSlot("coordinate");
+    AddOutputSlot(slot::Coordinate);
 }
 
 bool MagnificationCoordinateAction::Update(float tpf, TabInput tabInput)
@@ -49,7 +49,7 @@ bool MagnificationCoordinateAction::Update(float tpf, TabInput tabInput)
 			// Set output
 			glm::vec2 coordinate = relativeGazeCoordinate;
 			pageCoordinate(zoom, relativeMagnificationCenter, relativeCenterOffset, coordinate); // transform gaze relative to WebView to page coordinates
-			SetOutputValue("coordinate", coordinate); // into pixel space of CEF
+			SetOutputValue(slot::Coordinate, coordinate); // into pixel space of CEF
 			
 			// Finish this action
 			finished = true;
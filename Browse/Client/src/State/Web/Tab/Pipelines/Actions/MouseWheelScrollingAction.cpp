@@ -9,14 +9,14 @@
 MouseWheelScrollingAction::MouseWheelScrollingAction(TabInteractionInterface* pTab) : Action(pTab)
 {
     // Add in- and output data slots
-    AddVec2InputSlot("scrolling");
+    AddInputSlot(slot::Scrolling);
 }
 
 bool MouseWheelScrollingAction::Update(float tpf, TabInput tabInput)
 {
     // Get coordinate from input slot
     glm::vec2 scrolling;
-    GetInputValue("scrolling", scrolling);
+    GetInputValue(slot::Scrolling, scrolling);
     _pTab->EmulateMouseWheelScrolling(scrolling.x, scrolling.y);
     return true;
 }
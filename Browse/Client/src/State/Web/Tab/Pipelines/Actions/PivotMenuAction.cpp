@@ -12,7 +12,7 @@
 PivotMenuAction::PivotMenuAction(TabInteractionInterface *pTab) : Action(pTab)
 {
     // Add in- and output data slots
-    AddVec2InputSlot("coordinate");
+    AddInputSlot(slot::Coordinate);
 
     // ### Menu overlay ###
 	float sizeX, sizeY;
@@ -42,7 +42,7 @@ PivotMenuAction::PivotMenuAction(TabInteractionInterface *pTab) : Action(pTab)
         {
 			// If coordinate set, do left mouse button click
 			glm::vec2 coordinate;
-			if (this->GetInputValue("coordinate", coordinate))
+			if (this->GetInputValue(slot::Coordinate, coordinate))
 			{
 				_pTab->PushBackPipeline(std::unique_ptr<LeftMouseButtonClickPipeline>(new LeftMouseButtonClickPipeline(_pTab, coordinate)));
 			}
@@ -57,7 +57,7 @@ PivotMenuAction::PivotMenuAction(TabInteractionInterface *pTab) : Action(pTab)
 		{
 			// If coordinate set, do left mouse button click
 			glm::vec2 coordinate;
-			if (this->GetInputValue("coordinate", coordinate))
+			if (this->GetInputValue(slot::Coordinate, coordinate))
 			{
 				_pTab->PushBackPipeline(std::unique_ptr<LeftMouseButtonDoubleClickPipeline>(new LeftMouseButtonDoubleClickPipeline(_pTab, coordinate)));
 			}
@@ -115,7 +115,7 @@ void PivotMenuAction::Activate()
 {
     // Use coordinate for positioning floating elements
     glm::vec2 coordinate;
-    GetInputValue("coordinate", coordinate);
+    GetInputValue(slot::Coordinate, coordinate);
 
     // Position of menu
     float verticalPosition = (coordinate.y > (_pTab->GetWebViewHeight() / 2)) ? 0.1f : (0.5f + _menuHeight);
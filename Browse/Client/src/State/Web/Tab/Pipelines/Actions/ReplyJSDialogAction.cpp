@@ -10,8 +10,8 @@
 ReplyJSDialogAction::ReplyJSDialogAction(TabInteractionInterface* pTab) : Action(pTab)
 {
 	// Add in- and output data slots
-	AddIntInputSlot("clickedOk");
-	AddString16InputSlot("userInput");
+	AddInputSlot(slot::ClickedOk);
+	AddInputSlot(slot::UserInput);
 }
 
 ReplyJSDialogAction::~ReplyJSDialogAction()
@@ -28,8 +28,8 @@ bool ReplyJSDialogAction::Update(float tpf, TabInput tabInput)
 	// Get values out of slots
 	int clickedOk;
 	std::u16string userInput;
-	GetInputValue("clickedOk", clickedOk);
-	GetInputValue("userInput", userInput);
+	GetInputValue(slot::ClickedOk, clickedOk);
+	GetInputValue(slot::UserInput, userInput);
 	std::string userInput8;
 	eyegui_helper::convertUTF16ToUTF8(userInput, userInput8);
 	_pTab->ReplyJSDialog(clickedOk != 0, userInput8);
@@ -10,10 +10,10 @@
 TextInputAction::TextInputAction(TabInteractionInterface *pTab) : Action(pTab)
 {
     // Add in- and output data slots
-    AddInt64InputSlot("frameId");
-    AddIntInputSlot("nodeId");
-    AddString16InputSlot("text");
-    AddIntInputSlot("submit");
+    AddInputSlot(slot::FrameId);
+    AddInputSlot(slot::NodeId);
+    AddInputSlot(slot::Text);
+    AddInputSlot(slot::Submit);
 }
 
 TextInputAction::~TextInputAction()
@@ -28,10 +28,10 @@ bool TextInputAction::Update(float tpf, TabInput tabInput)
     int nodeId = 0;
     std::u16string text;
     int submit = 0;
-    GetInputValue("frameId", frameId);
-    GetInputValue("nodeId", nodeId);
-    GetInputValue("text", text);
-    GetInputValue("submit", submit);
+    GetInputValue(slot::FrameId, frameId);
+    GetInputValue(slot::NodeId, nodeId);
+    GetInputValue(slot::Text, text);
+    GetInputValue(slot::Submit, submit);
 
 	// Convert u16string to string
 	std::string text8;
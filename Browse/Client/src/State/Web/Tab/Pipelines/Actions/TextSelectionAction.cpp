@@ -10,7 +10,7 @@
 TextSelectionAction::TextSelectionAction(TabInteractionInterface *pTab) : ZoomCoordinateAction(pTab, false)
 {
 	// Add in- and output data slots
-	AddVec2InputSlot("coordinate");
+	AddInputSlot(slot::Coordinate);
 }
 
 bool TextSelectionAction::Update(float tpf, TabInput tabInput)
@@ -27,7 +27,7 @@ bool TextSelectionAction::Update(float tpf, TabInput tabInput)
 	{
 		// End selection procedure
 		glm::vec2 coordinate;
-		this->GetOutputValue("coordinate", coordinate);
+		this->GetOutputValue(slot::Coordinate, coordinate);
 		_pTab->EmulateLeftMouseButtonUp(coordinate.x, coordinate.y, false, setup::TEXT_SELECTION_MARGIN);
 
 		LogInfo("Up: ", coordinate.x, ", ", coordinate.y);
@@ -51,7 +51,7 @@ void TextSelectionAction::Activate()
 
 	// Set starting point of selection
 	glm::vec2 startCoordinate;
-	GetInputValue("coordinate", startCoordinate);
+	GetInputValue(slot::Coordinate, startCoordinate);
 	_pTab->EmulateLeftMouseButtonDown(startCoordinate.x, startCoordinate.y, false, -setup::TEXT_SELECTION_MARGIN);
 
 	LogInfo("Down: ", startCoordinate.x, ", ", startCoordinate.y);
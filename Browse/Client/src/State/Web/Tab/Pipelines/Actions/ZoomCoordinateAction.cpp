@@ -14,7 +14,7 @@ ZoomCoordinateAction::ZoomCoordinateAction(TabInteractionInterface* pTab, bool d
 	_doDimming = doDimming;
 
     // Add in- and output data slots
-    AddVec2OutputSlot("coordinate");
+    AddOutputSlot(slot::Coordinate);
 }
 
 bool ZoomCoordinateAction::Update(float tpf, TabInput tabInput)
@@ -107,7 +107,7 @@ bool ZoomCoordinateAction::Update(float tpf, TabInput tabInput)
 	if (!tabInput.gazeUsed && tabInput.instantInteraction) // user demands on instant interaction
 	{
 		// Set coordinate in output value. Use current gaze position
-		SetOutputValue("coordinate", pixelGazeCoordinate);
+		SetOutputValue(slot::Coordinate, pixelGazeCoordinate);
 
 		// Return success
 		finished = true;
@@ -117,7 +117,7 @@ bool ZoomCoordinateAction::Update(float tpf, TabInput tabInput)
 		|| ((_logZoom <= 0.45f) && (_deviation < 0.01f))) // coordinate seems to be quite fixed, just do it
 	{
 		// Set coordinate in output value
-        SetOutputValue("coordinate", glm::vec2(_relativeZoomCoordinate * glm::vec2(_pTab->GetWebViewResolutionX(), _pTab->GetWebViewResolutionY()))); // into pixel space of CEF
+        SetOutputValue(slot::Coordinate, glm::vec2(_relativeZoomCoordinate * glm::vec2(_pTab->GetWebViewResolutionX(), _pTab->GetWebViewResolutionY()))); // into pixel space of CEF
 
 		// Return success
 		finished = true;
@@ -37,7 +37,7 @@ JSDialogPipeline::JSDialogPipeline(TabInteractionInterface* pTab, JavaScriptDial
 		// Connect keyboard and reply
 		std::unique_ptr<ActionConnector> upConnector =
 			std::unique_ptr<ActionConnector>(new ActionConnector(spKeyboardAction, spReplyJSDialogAction));
-		upConnector->ConnectString16("text", "userInput");
+		upConnector->Connect(slot::Text, slot::UserInput);
 		_connectors.push_back(std::move(upConnector));
 	}
 	else // Ok or cancel
@@ -53,6 +53,6 @@ JSDialogPipeline::JSDialogPipeline(TabInteractionInterface* pTab, JavaScriptDial
 	// Connect dialog and reply
 	std::unique_ptr<ActionConnector> upConnector =
 		std::unique_ptr<ActionConnector>(new ActionConnector(spJSDialogAction, spReplyJSDialogAction));
-	upConnector->ConnectInt("clickedOk", "clickedOk");
+	upConnector->Connect(slot::ClickedOk, slot::ClickedOk);
 	_connectors.push_back(std::move(upConnector));	
 }
@@ -11,6 +11,6 @@ LeftMouseButtonClickPipeline::LeftMouseButtonClickPipeline(TabInteractionInterfa
 	// Add action and set coordinate
     std::unique_ptr<LeftMouseButtonClickAction> upLeftMouseButtonClickAction =
         std::unique_ptr<LeftMouseButtonClickAction>(new LeftMouseButtonClickAction(_pTab));
-	upLeftMouseButtonClickAction->SetInputValue("coordinate", coordinate);
+	upLeftMouseButtonClickAction->SetInputValue(slot::Coordinate, coordinate);
     _actions.push_back(std::move(upLeftMouseButtonClickAction));
 }
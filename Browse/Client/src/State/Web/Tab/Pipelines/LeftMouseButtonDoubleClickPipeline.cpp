@@ -12,7 +12,7 @@ LeftMouseButtonDoubleClickPipeline::LeftMouseButtonDoubleClickPipeline(TabIntera
 {
 	// Add first left click action and set coordinate
     auto upLeftMouseButtonClickAction1 = std::make_unique<LeftMouseButtonClickAction>(_pTab);
-	upLeftMouseButtonClickAction1->SetInputValue("coordinate", coordinate);
+	upLeftMouseButtonClickAction1->SetInputValue(slot::Coordinate, coordinate);
     _actions.push_back(std::move(upLeftMouseButtonClickAction1));
 
 	// Add delay between clicks
@@ -21,6 +21,6 @@ LeftMouseButtonDoubleClickPipeline::LeftMouseButtonDoubleClickPipeline(TabIntera
 
 	// Add second left click action and set coordinate
 	auto upLeftMouseButtonClickAction2 = std::make_unique<LeftMouseButtonClickAction>(_pTab);
-	upLeftMouseButtonClickAction2->SetInputValue("coordinate", coordinate);
+	upLeftMouseButtonClickAction2->SetInputValue(slot::Coordinate, coordinate);
 	_actions.push_back(std::move(upLeftMouseButtonClickAction2));
 }
@@ -54,6 +54,6 @@ PointingEvaluationPipeline::PointingEvaluationPipeline(TabInteractionInterface*
 	// Connect actions (TODO: pointing is in CEFPixel space, mouse action in WebView space. Fix that!!!)
 	std::unique_ptr<ActionConnector> upConnector =
 		std::unique_ptr<ActionConnector>(new ActionConnector(spPointingAction, spMouseAction));
-	upConnector->ConnectVec2("coordinate", "coordinate");
+	upConnector->Connect(slot::Coordinate, slot::Coordinate);
 	_connectors.push_back(std::move(upConnector));
 }
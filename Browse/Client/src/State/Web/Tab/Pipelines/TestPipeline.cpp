@@ -25,7 +25,7 @@ TestPipeline::TestPipeline(TabInteractionInterface* pTab) : Pipeline(pTab)
     // Connect those actions
     std::unique_ptr<ActionConnector> upConnector =
         std::unique_ptr<ActionConnector>(new ActionConnector(pZoomCoordinateAction, pLeftMouseButtonClickAction));
-    upConnector->ConnectVec2("coordinate", "coordinate");
+    upConnector->Connect(slot::Coordinate, slot::Coordinate);
     _connectors.push_back(std::move(upConnector));
 	*/
 }
@@ -19,7 +19,7 @@ TextInputPipeline::TextInputPipeline(TabInteractionInterface* pTab, std::shared_
 
     // Then, do input via keyboard
 	std::shared_ptr<KeyboardAction> spKeyboardAction = std::make_shared<KeyboardAction>(_pTab);
-	spKeyboardAction->SetInputValue<std::u16string>("text", text16);
+	spKeyboardAction->SetInputValue(slot::Text, text16);
 	_actions.push_back(spKeyboardAction);
 
     // At last, fill input into text field
@@ -36,13 +36,13 @@ TextInputPipeline::TextInputPipeline(TabInteractionInterface* pTab, std::shared_
 		_pTab->ConvertToWebViewPixel(webViewPixelX, webViewPixelY);
 	}
 
-    //spTextInputAction->SetInputValue("frameId", spNode->GetFrameID());	// DEPRECATED
-    spTextInputAction->SetInputValue("nodeId", spNode->GetId());
+    //spTextInputAction->SetInputValue(slot::FrameId, spNode->GetFrameID());	// DEPRECATED
+    spTextInputAction->SetInputValue(slot::NodeId, spNode->GetId());
 
     // Connect those actions
     std::unique_ptr<ActionConnector> upConnector =
         std::unique_ptr<ActionConnector>(new ActionConnector(spKeyboardAction, spTextInputAction));
-    upConnector->ConnectString16("text", "text");
-    upConnector->ConnectInt("submit", "submit");
+    upConnector->Connect(slot::Text, slot::Text);
+    upConnector->Connect(slot::Submit, slot::Submit);
     _connectors.push_back(std::move(upConnector));
 }
@@ -30,6 +30,6 @@ TextSelectionPipeline::TextSelectionPipeline(TabInteractionInterface* pTab) : Pi
     // Connect actions
     auto upConnector =
         std::make_unique<ActionConnector>(spZoomCoordinateAction, spTextSelectionAction);
-    upConnector->ConnectVec2("coordinate", "coordinate");
+    upConnector->Connect(slot::Coordinate, slot::Coordinate);
     _connectors.push_back(std::move(upConnector));
 }
@@ -20,6 +20,6 @@ ZoomClickPipeline::ZoomClickPipeline(TabInteractionInterface* pTab) : Pipeline(p
     // Connect actions
     std::unique_ptr<ActionConnector> upConnector =
         std::unique_ptr<ActionConnector>(new ActionConnector(spZoomCoordinateAction, spLinkNavigationAction));
-    upConnector->ConnectVec2("coordinate", "coordinate");
+    upConnector->Connect(slot::Coordinate, slot::Coordinate);
     _connectors.push_back(std::move(upConnector));
 }
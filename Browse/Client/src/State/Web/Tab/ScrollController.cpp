@@ -0,0 +1,93 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+
+#include "ScrollController.h"
+#include "src/Setup.h"
+#include "src/Utils/glmWrapper.h"
+
+void ScrollController::Scroll(double deltaY)
+{
+	if (deltaY != 0)
+	{
+		_targetY += deltaY;
+		_scrolled = true;
+	}
+}
+
+double ScrollController::Update(float tpf, double scrollingOffsetY, double renderedScrollingOffsetY, double maxScrollingOffsetY)
+{
+	// Start at offset of page
+	if (!_initialized)
+	{
+		_targetY = scrollingOffsetY;
+		_initialized = true;
+	}
+
+	// Update timers
+	_idleTime = _scrolled ? 0.f : _idleTime + tpf;
+	_scrolled = false;
+	if (_requestPending)
+	{
+		_requestTime += tpf;
+		if (_requestTime >= setup::SMOOTH_SCROLLING_REQUEST_TIMEOUT)
+		{
+			// CEF did not scroll, e.g. because end of page is reached
+			_requestPending = false;
+		}
+	}
+
+	// Adopt offset of CEF when nothing happened for a while, e.g. after scrolling by page itself or end of page reached
+	if (!_requestPending && _idleTime >= setup::SMOOTH_SCROLLING_SETTLE_TIME)
+	{
+		_targetY = scrollingOffsetY;
+	}
+
+	// Keep target on page and not too far away from what CEF has rendered, since texture has no content beyond
+	_targetY = glm::max(0.0, _targetY);
+	if (maxScrollingOffsetY > 0)
+	{
+		_targetY = glm::min(maxScrollingOffsetY, _targetY);
+	}
+	_targetY = glm::clamp(
+		_targetY,
+		scrollingOffsetY - setup::SMOOTH_SCROLLING_MAX_SHIFT,
+		scrollingOffsetY + setup::SMOOTH_SCROLLING_MAX_SHIFT);
+
+	// Request scrolling from CEF. While scrolling, only full steps are requested. Remainder is requested when idle
+	double request = 0;
+	double delta = _targetY - scrollingOffsetY;
+	if (!_requestPending)
+	{
+		if (glm::abs(delta) >= setup::SMOOTH_SCROLLING_STEP)
+		{
+			request = glm::trunc(delta / setup::SMOOTH_SCROLLING_STEP) * setup::SMOOTH_SCROLLING_STEP;
+		}
+		else if (_idleTime > 0.f && glm::abs(delta) >= 1.0)
+		{
+			request = glm::round(delta);
+		}
+
+		if (request != 0)
+		{
+			_requestPending = true;
+			_requestTime = 0.f;
+		}
+	}
+
+	// Shift texture by what is not yet in it, which may include a step CEF has already scrolled but not uploaded.
+	// Bounded, so a jump of the page itself does not move texture out of view until its paint arrives
+	_shiftY = _targetY - scrollingOffsetY;
+	_textureShiftY = glm::clamp(
+		_targetY - renderedScrollingOffsetY,
+		-2.0 * setup::SMOOTH_SCROLLING_MAX_SHIFT,
+		2.0 * setup::SMOOTH_SCROLLING_MAX_SHIFT);
+
+	return request;
+}
+
+void ScrollController::OnScrollingOffsetChanged()
+{
+	_requestPending = false;
+}
@@ -0,0 +1,57 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+// Smooth vertical scrolling of web view. Collects scrolling in CEF pixels
+// each frame and requests it from CEF only in coarse steps. The difference
+// between targeted scrolling offset and the one of the paint in the texture
+// is returned as texture shift, which the web view applies to the already
+// uploaded texture. So scrolling moves at display rate while CEF repaints
+// only once per step. Offset reported by CEF may be ahead of the texture,
+// as paints arrive later and may be kept back before upload.
+
+#ifndef SCROLLCONTROLLER_H_
+#define SCROLLCONTROLLER_H_
+
+class ScrollController
+{
+public:
+
+	// Scroll by given amount of CEF pixels. Positive values scroll down
+	void Scroll(double deltaY);
+
+	// Update once per frame with scrolling offset as reported by CEF, scrolling offset of
+	// paint in texture and maximal scrolling offset (zero or less if unknown). Returns amount
+	// of CEF pixels which should be requested from CEF via scrolling, zero if none
+	double Update(float tpf, double scrollingOffsetY, double renderedScrollingOffsetY, double maxScrollingOffsetY);
+
+	// Tell that CEF reported new scrolling offset
+	void OnScrollingOffsetChanged();
+
+	// Difference between targeted scrolling offset and the one reported by CEF in CEF pixels.
+	// Maps displayed page to viewport of CEF, e.g. for clicks
+	double GetShiftY() const { return _shiftY; }
+
+	// Difference between targeted scrolling offset and the one of paint in texture in CEF pixels
+	double GetTextureShiftY() const { return _textureShiftY; }
+
+private:
+
+	// Targeted scrolling offset
+	double _targetY = 0;
+	bool _initialized = false;
+
+	// Current shifts
+	double _shiftY = 0;
+	double _textureShiftY = 0;
+
+	// Request sent to CEF which is not yet answered by new scrolling offset
+	bool _requestPending = false;
+	float _requestTime = 0.f;
+
+	// Time since last call of scroll
+	float _idleTime = 0.f;
+	bool _scrolled = false;
+};
+
+#endif // SCROLLCONTROLLER_H_
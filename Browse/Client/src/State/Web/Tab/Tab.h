@@ -24,11 +24,15 @@
 #include "src/State/Web/Tab/Interface/TabCEFInterface.h"
 #include "src/State/Web/WebTabInterface.h"
 #include "src/CEF/Data/DOMNode.h"
+#include "src/CEF/Data/DOMNodeStore.h"
 #include "src/State/Web/Tab/WebView.h"
+#include "src/State/Web/Tab/ScrollController.h"
+#include "src/State/Web/Managers/SessionManager.h"
 #include "src/State/Web/Tab/Pipelines/Pipeline.h"
 #include "src/State/Web/Tab/Triggers/TextInputTrigger.h"
 #include "src/State/Web/Tab/Triggers/SelectFieldTrigger.h"
 #include "src/Utils/glmWrapper.h"
+#include "src/Utils/StyleProperty.h"
 #include "src/Input/Input.h"
 #include "src/Global.h"
 #include "src/State/Web/Tab/Pipelines/PointingEvaluationPipeline.h"
@@ -53,8 +57,8 @@ public:
 	// >>> Implemented in TabImpl.cpp >>>
 	// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
 
-    // Constructor
-    Tab(Master* pMaster, Mediator* pCefMediator, WebTabInterface* pWeb, std::string url);
+    // Constructor. When session is given, tab is restored from it and browser is created not before first activation
+    Tab(Master* pMaster, Mediator* pCefMediator, WebTabInterface* pWeb, std::string url, const SessionManager::TabSession* pSession = NULL);
 
     // Destructor
     virtual ~Tab();
@@ -87,12 +91,36 @@ public:
     void Reload();
 
     // Can go back / forward
-    bool CanGoBack() const { return _canGoBack; }
+    bool CanGoBack() const { return _canGoBack || !_restoredBackURLs.empty(); }
     bool CanGoForward() const { return _canGoForward; }
 
 	// Pushs back pointing evaluation pipeline
 	void PushBackPointingEvaluationPipeline(PointingApproach approach);
 
+	// Close browser of tab but keep snapshot, title, favicon, URL and scrolling offset
+	void Hibernate();
+
+	// Create browser again and restore page and scrolling offset
+	void WakeUp();
+
+	// Whether tab is currently without browser
+	bool IsHibernated() const { return _hibernated; }
+
+	// Whether some pipeline is executed, e.g. zooming
+	bool IsPipelineActive() const { return _pipelineActive; }
+
+	// Whether any frame of page is loading
+	bool IsLoading() const { return !_loadingFrames.empty(); }
+
+	// Set device scale factor with which CEF renders outside of zooming
+	void SetRenderScale(float renderScale);
+
+	// Estimation of memory occupied by tab in bytes
+	size_t GetEstimatedMemoryUsage() const;
+
+	// Fill session of tab for session store. Thumbnail is only updated when requested, since it is read back from GPU
+	void GetSession(SessionManager::TabSession& rSession, bool withThumbnail);
+
     // #################################
     // ### TAB INTERACTIVE INTERFACE ###
     // #################################
@@ -256,6 +284,9 @@ public:
 	// Convert CEFPixel coordinate to WebViewPixel coordinate
 	void ConvertToWebViewPixel(double& rCEFPixelX, double& rCEFPixelY) const;
 
+	// Get shift of displayed page ahead of CEF while smooth scrolling. Zero upon fixed elements, as those are not shifted
+	virtual double GetScrollingShiftY(double CEFPixelX, double CEFPixelY) const;
+
 	// Reply JavaScript dialog callback
 	virtual void ReplyJSDialog(bool clickedOk, std::string userInput);
 
@@ -272,6 +303,10 @@ public:
     // Tell CEF callback which resolution web view texture should have
     virtual void GetWebRenderResolution(int& rWidth, int& rHeight) const;
 
+    // Tell CEF callback with which device scale factor to render. Render scale is used outside of zooming
+    virtual float GetDeviceScaleFactor() const { return (_zoomDeviceScaleFactor > 1.f) ? _zoomDeviceScaleFactor : GetRenderScale(); }
+    virtual float GetRenderScale() const { return _upWebView->GetRenderScale(); }
+
     // Getter and setter for favicon URL
     virtual std::string GetFavIconURL() const { return _favIconUrl; }
     virtual void SetFavIconURL(std::string url) { _favIconUrl = url; }
@@ -290,6 +325,9 @@ public:
     // Get weak pointer to texture of web view
     virtual std::weak_ptr<Texture> GetWebViewTexture() { return _upWebView->GetTexture(); }
 
+    // Receive rendering with device scale factor above one, of which web view keeps zoomed region only
+    virtual void FillZoomTexture(int width, int height, const unsigned char* pBuffer);
+
     // Add, remove and update Tab's current DOMNodes
 	virtual void AddDOMTextInput(int id);
 	virtual void AddDOMLink(int id);
@@ -310,6 +348,9 @@ public:
     // Receive callbacks from CefMediator upon scrolling offset changes
     virtual void SetScrollingOffset(double x, double y);
 
+    // Receive vertical scrolling offset of paint which has been uploaded into texture of web view
+    virtual void SetRenderedScrollingOffset(double y);
+
     // Getter for URL
     virtual std::string GetURL() const { return _url; }
 
@@ -486,11 +527,11 @@ private:
 	// Collection of all triggers
 	std::vector<Trigger*> _triggers;
 
-	// Map nodeID to node itself, in order to access it when it has to be updated
-	std::map<int, std::shared_ptr<DOMLink> > _TextLinkMap;
-	std::map<int, std::shared_ptr<DOMTextInput> > _TextInputMap;
-	std::map<int, std::shared_ptr<DOMSelectField> > _SelectFieldMap;
-	std::map<int, std::shared_ptr<DOMOverflowElement> > _OverflowElementMap;
+	// Stores of nodes by nodeID, in order to access them when they have to be updated
+	DOMNodeStore<DOMLink> _TextLinks;
+	DOMNodeStore<DOMTextInput> _TextInputs;
+	DOMNodeStore<DOMSelectField> _SelectFields;
+	DOMNodeStore<DOMOverflowElement> _OverflowElements;
 
     // Web view in which website is rendered and displayed
     std::unique_ptr<WebView> _upWebView;
@@ -519,6 +560,19 @@ private:
     glm::vec4 _currentColorAccent = TAB_DEFAULT_COLOR_ACCENT;
     float _colorInterpolation = 1.f;
 
+    // Style properties colored by accent, bound at construction
+    StylePropertyVec4Handle* _pPanelColorStyle;
+    StylePropertyVec4Handle* _pOverlayColorStyle;
+    StylePropertyVec4Handle* _pOverlayBackgroundColorStyle;
+    StylePropertyVec4Handle* _pOverlayNoBackColorStyle;
+    StylePropertyVec4Handle* _pOverlayPanelColorStyle;
+    StylePropertyVec4Handle* _pOverlayPanelBackgroundColorStyle;
+    StylePropertyVec4Handle* _pScrollProgressColorStyle;
+    StylePropertyVec4Handle* _pScrollProgressBackgroundColorStyle;
+
+    // Content of debug text block, which is only passed to eyeGUI when changed
+    std::string _debugText;
+
     // Bool to indicate whether some pipeline is active
     bool _pipelineActive = false;
 
@@ -526,12 +580,18 @@ private:
     bool _autoScrolling = false;
     float _autoScrollingValue = 0; // [-1..1]
 
+    // Smooth scrolling of web view
+    ScrollController _scrollController;
+
     // Gaze mouse
     bool _gazeMouse = true;
 
     // Level of zooming
     double _zoomLevel = 1;
 
+    // Device scale factor of rendering for high resolution zooming, one if not zoomed
+    float _zoomDeviceScaleFactor = 1.f;
+
     // Pointer to mediator
     Mediator* _pCefMediator;
 
@@ -556,9 +616,6 @@ private:
     std::map<std::string, std::function<void(std::u16string)> > _overlayKeyboardPressCallbacks;
     std::map<std::string, std::function<void(std::u16string)> > _overlayWordSuggestCallbacks;
 
-    // Time until Cef is asked for page resolution
-    float _timeUntilGetPageResolution = TAB_GET_PAGE_RES_INTERVAL;
-
 	// Vector with click visualizations, holding pairs of frame index and fading
 	std::vector<ClickVisualization> _clickVisualizations;
 
@@ -574,6 +631,7 @@ private:
     // Scroll offset
     double _scrollingOffsetX = 0;
     double _scrollingOffsetY = 0;
+    double _renderedScrollingOffsetY = 0; // offset of paint currently in texture of web view, may lag behind
 
     // Can go back / forward
     bool _canGoBack = false;
@@ -596,6 +654,18 @@ private:
 
 	// Current loading icon frame
 	int _loadingIconFrame = 0;
+
+	// Hibernation, where browser is closed and only snapshot is kept
+	bool _hibernated = false;
+	bool _restoreScrollingAfterLoad = false;
+	double _hibernationScrollingOffsetX = 0;
+	double _hibernationScrollingOffsetY = 0;
+
+	// Back history which browser does not know, since it has been created after hibernation or session restore
+	std::vector<std::string> _restoredBackURLs; // oldest first
+
+	// Collect back history of restored one and browser, oldest first
+	void CollectBackHistory(std::vector<std::string>& rURLs);
 };
 
 #endif // TAB_H_
@@ -37,7 +37,7 @@ public:
     virtual void Deactivate();
 
 	// Get rects of DOMNode
-    std::vector<Rect> GetDOMRects() const { return _spNode->GetRects(); }
+    const std::vector<Rect>& GetDOMRects() const { return _spNode->GetRects(); }
 
     // Get whether DOMNode is marked as fixed
     bool GetDOMFixed() const { return _spNode->GetFixedId() >= 0; } // TODO: call real "isFixed" method so not checked for being zero
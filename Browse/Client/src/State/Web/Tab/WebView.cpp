@@ -5,7 +5,9 @@
 
 #include "WebView.h"
 #include "src/Utils/Texture.h"
+#include "src/Singletons/GPUPool.h"
 #include "src/Setup.h"
+#include "src/Global.h"
 #include "submodules/glm/glm/gtc/matrix_transform.hpp"
 
 // Shaders
@@ -83,16 +85,35 @@ const std::string compositionFragmentShaderSource =
 "in vec2 uv;\n"
 "out vec4 fragColor;\n"
 "uniform sampler2D tex;\n"
+"uniform sampler2D zoomTex;\n" // zoomed region rendered in high resolution
+"uniform sampler2D pageTex;\n" // rendering of CEF which is magnified
+"uniform vec4 zoomTextureRegion;\n" // minX, minY, maxX, maxY of region in zoom texture. Origin upper left!
+"uniform float zoomBlend;\n"
+"uniform float dim;\n"
 "uniform vec2 centerOffset;\n"
 "uniform vec2 zoomPosition;\n"
 "uniform float zoom;\n"
+"uniform float scrollingShift;\n"
+"uniform vec4 fixedRects[" + std::to_string(WEB_VIEW_MAX_FIXED_RECTS) + "];\n" // minX, minY, maxX, maxY of fixed elements, which are not shifted. Origin upper left!
+"uniform int fixedRectCount;\n"
 "void main() {\n"
 "   vec2 coords = uv;\n"
 "   coords += centerOffset;" // move towards center
 "   coords -= zoomPosition;" // move zoom position to origin
 "   coords *= zoom;" // scale coords
 "   coords += zoomPosition;" // move it back
-"   fragColor = texture(tex, coords);\n"
+"   vec2 pageCoords = vec2(coords.x, 1.0 - coords.y);\n" // page coordinates with origin in upper left
+"   vec2 shiftedCoords = vec2(coords.x, coords.y - scrollingShift);\n" // shift by scrolling not yet rendered by CEF
+"   for (int i = 0; i < fixedRectCount; i++) {\n"
+"       if (all(greaterThanEqual(pageCoords, fixedRects[i].xy)) && all(lessThanEqual(pageCoords, fixedRects[i].zw))) { shiftedCoords = coords; }\n"
+"   }\n"
+"   bool revealed = (shiftedCoords.y < 0.0 || shiftedCoords.y > 1.0) && coords.y >= 0.0 && coords.y <= 1.0;\n" // area without content
+"   fragColor = revealed ? vec4(1.0) : texture(tex, shiftedCoords);\n"
+"   if (zoomBlend > 0.0 && all(greaterThanEqual(pageCoords, zoomTextureRegion.xy)) && all(lessThanEqual(pageCoords, zoomTextureRegion.zw))) {\n"
+"       vec3 sharp = texture(zoomTex, (pageCoords - zoomTextureRegion.xy) / (zoomTextureRegion.zw - zoomTextureRegion.xy)).rgb;\n"
+"       vec3 blurry = texture(pageTex, pageCoords).rgb;\n"
+"       fragColor.rgb += (sharp - blurry) * (1.0 - dim) * zoomBlend;\n" // add detail only, so highlights in framebuffer are kept
+"   }\n"
 "}\n";
 
 WebView::WebView(int x, int y, int width, int height)
@@ -104,7 +125,13 @@ WebView::WebView(int x, int y, int width, int height)
 	_height = height;
 
     // Generate texture
-    _spTexture = std::shared_ptr<Texture>(new Texture(_width, _height, GL_RGBA, Texture::Filter::LINEAR, Texture::Wrap::BORDER));
+    // Lease texture in resolution CEF will render, so first paint does not reallocate it
+    _spTexture = GPUPool::instance().LeaseTexture(
+        glm::max(1, (int)(_width * setup::WEB_VIEW_RESOLUTION_SCALE)),
+        glm::max(1, (int)(_height * setup::WEB_VIEW_RESOLUTION_SCALE)),
+        GL_RGBA,
+        Texture::Filter::LINEAR,
+        Texture::Wrap::BORDER);
 
     // Render items
 	_upWebpageRenderItem = std::unique_ptr<RenderItem>(new RenderItem(vertexShaderSource, geometryShaderSource, webpageFragmentShaderSource));
@@ -112,10 +139,7 @@ WebView::WebView(int x, int y, int width, int height)
     _upCompositeRenderItem = std::unique_ptr<RenderItem>(new RenderItem(vertexShaderSource, geometryShaderSource, compositionFragmentShaderSource));
 
     // Framebuffer
-    _upFramebuffer = std::unique_ptr<Framebuffer>(new Framebuffer(_width, _height));
-    _upFramebuffer->Bind();
-    _upFramebuffer->AddAttachment(Framebuffer::ColorFormat::RGB, true);
-    _upFramebuffer->Unbind();
+    _spFramebuffer = GPUPool::instance().LeaseFramebuffer(_width, _height, Framebuffer::ColorFormat::RGB, true);
 }
 
 WebView::~WebView()
@@ -129,12 +153,11 @@ void WebView::Update(
     int width,
     int height)
 {
-    // Update framebuffer size
-    if((width != _width) || (height != _height))
+    // Lease framebuffer of new size. Old one goes back to pool, e.g. to be reused when size changes back
+    if((width != _width) || (height != _height) || !_spFramebuffer)
     {
-        _upFramebuffer->Bind();
-        _upFramebuffer->Resize(width, height);
-        _upFramebuffer->Unbind();
+        _spFramebuffer.reset();
+        _spFramebuffer = GPUPool::instance().LeaseFramebuffer(width, height, Framebuffer::ColorFormat::RGB, true);
     }
 
     // Set members
@@ -149,12 +172,17 @@ void WebView::Draw(
 	int windowWidth,
 	int windowHeight,
 	double scrollingOffsetX,
-	double scrollingOffsetY) const
+	double scrollingOffsetY,
+	double scrollingShiftY,
+	const std::vector<std::vector<Rect> >& rFixedElements) const
 {
+    // Nothing to draw while framebuffer is released at hibernation
+    if (!_spFramebuffer) { return; }
+
     // ### FILL FRAMEBUFFER ###
 
     // Just render to framebuffer
-    _upFramebuffer->Bind();
+    _spFramebuffer->Bind();
 
     // Rescue current viewport and set own which fits rendered webpage
     GLint viewport[4];
@@ -230,7 +258,7 @@ void WebView::Draw(
     glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
 
     // Unbind framebuffer
-    _upFramebuffer->Unbind();
+    _spFramebuffer->Unbind();
 
     // ### COMPOSITING INCLUSIVE ZOOMING ###
 
@@ -239,7 +267,7 @@ void WebView::Draw(
 
     // Bind texture with webpage and custom rendered elements
     glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_2D, _upFramebuffer->GetAttachment(0));
+    glBindTexture(GL_TEXTURE_2D, _spFramebuffer->GetAttachment(0));
 
     // Fill uniforms (TODO: here, coordinate sytem is not completely correctly translated. Would be only a problem at vertical transformation)
     _upCompositeRenderItem->GetShader()->UpdateValue(
@@ -254,7 +282,48 @@ void WebView::Draw(
     _upCompositeRenderItem->GetShader()->UpdateValue("centerOffset", glm::vec2(parameters.centerOffset.x, -parameters.centerOffset.y)); // center offset y has to be taken negative because OpenGL coordinates
     _upCompositeRenderItem->GetShader()->UpdateValue("zoomPosition", glm::vec2(parameters.zoomPosition.x, 1.f - parameters.zoomPosition.y)); // zoomPosition has origin in upper left but lower left is necessary
     _upCompositeRenderItem->GetShader()->UpdateValue("zoom", parameters.zoom);
+    _upCompositeRenderItem->GetShader()->UpdateValue("scrollingShift", (float)(scrollingShiftY / (double)GetResolutionY())); // relative to framebuffer
+
+    // Fixed elements stay in place while page is shifted
+    int fixedRectCount = 0;
+    if (scrollingShiftY != 0)
+    {
+        for (const auto& rRects : rFixedElements)
+        {
+            for (const auto& rRect : rRects)
+            {
+                if (fixedRectCount >= WEB_VIEW_MAX_FIXED_RECTS) { break; }
+                _upCompositeRenderItem->GetShader()->UpdateValue(
+                    "fixedRects[" + std::to_string(fixedRectCount) + "]",
+                    glm::vec4(
+                        rRect.left / (float)GetResolutionX(),
+                        rRect.top / (float)GetResolutionY(),
+                        rRect.right / (float)GetResolutionX(),
+                        rRect.bottom / (float)GetResolutionY())); // relative to framebuffer
+                fixedRectCount++;
+            }
+        }
+    }
+    _upCompositeRenderItem->GetShader()->UpdateValue("fixedRectCount", fixedRectCount);
+
+    // Zoom texture is only valid while page has not been scrolled since its capture
+    float zoomBlend = 0.f;
+    if (_spZoomTexture
+        && scrollingShiftY == 0
+        && scrollingOffsetX == _zoomTextureScrollingOffsetX
+        && scrollingOffsetY == _zoomTextureScrollingOffsetY)
+    {
+        zoomBlend = _zoomTextureBlend;
+        _spZoomTexture->Bind(1);
+        _spTexture->Bind(2);
+    }
+    _upCompositeRenderItem->GetShader()->UpdateValue("zoomTex", 1);
+    _upCompositeRenderItem->GetShader()->UpdateValue("pageTex", 2);
+    _upCompositeRenderItem->GetShader()->UpdateValue("zoomTextureRegion", _zoomTextureRegion);
+    _upCompositeRenderItem->GetShader()->UpdateValue("zoomBlend", zoomBlend);
+    _upCompositeRenderItem->GetShader()->UpdateValue("dim", parameters.dim);
     _upCompositeRenderItem->Draw(GL_POINTS);
+    glActiveTexture(GL_TEXTURE0);
 }
 
 std::weak_ptr<Texture> WebView::GetTexture()
@@ -262,9 +331,9 @@ std::weak_ptr<Texture> WebView::GetTexture()
     return _spTexture;
 }
 
-void WebView::SetHighlightRects(std::vector<Rect> rects)
+void WebView::SetHighlightRects(const std::vector<Rect>& rRects)
 {
-    _rects = rects;
+    _rects = rRects;
 }
 
 int WebView::GetX() const
@@ -289,10 +358,179 @@ int WebView::GetHeight() const
 
 int WebView::GetResolutionX() const
 {
-	return _spTexture->GetWidth();
+	// Same as resolution CEF lays out page with, texture may be larger due to device scale factor
+	return glm::max(1, (int)(_width * setup::WEB_VIEW_RESOLUTION_SCALE));
 }
 
 int WebView::GetResolutionY() const
 {
-	return _spTexture->GetHeight();
+	return glm::max(1, (int)(_height * setup::WEB_VIEW_RESOLUTION_SCALE));
+}
+
+bool WebView::Hibernate(int snapshotMipMapLevel)
+{
+	// Fetch downscaled version of current rendering
+	std::vector<unsigned char> snapshotData;
+	int snapshotWidth;
+	int snapshotHeight;
+	if (!GetSnapshot(snapshotMipMapLevel, snapshotWidth, snapshotHeight, snapshotData))
+	{
+		return false;
+	}
+
+	// Reallocate texture with snapshot only. CEF fills it in full resolution again after wake up
+	ShowSnapshot(snapshotWidth, snapshotHeight, snapshotData);
+
+	return true;
+}
+
+bool WebView::GetSnapshot(int mipMapLevel, int& rWidth, int& rHeight, std::vector<unsigned char>& rData) const
+{
+	// Texture may already contain downscaled snapshot, so take fewer mip map levels then
+	int expectedWidth = (int)((float)_width * setup::WEB_VIEW_RESOLUTION_SCALE * _renderScale);
+	int textureWidth = glm::max(1, _spTexture->GetWidth());
+	int snapshotLevel = 0;
+	while ((textureWidth << (snapshotLevel + 1)) <= expectedWidth)
+	{
+		snapshotLevel++;
+	}
+	return _spTexture->GetPixelsFromMipMap(glm::max(0, mipMapLevel - snapshotLevel), rWidth, rHeight, rData);
+}
+
+void WebView::ShowSnapshot(int width, int height, const std::vector<unsigned char>& rData)
+{
+	// Replace rendering by snapshot in small texture and give full resolution one back to pool
+	_spTexture = GPUPool::instance().LeaseTexture(width, height, GL_RGBA, Texture::Filter::LINEAR, Texture::Wrap::BORDER);
+	_spTexture->Fill(width, height, GL_RGBA, rData.data());
+
+	// Framebuffer is not used while hidden
+	_spFramebuffer.reset();
+
+	// Zoomed region does not belong to snapshot
+	_spZoomTexture.reset();
+	_zoomTextureBlend = 0.f;
+}
+
+size_t WebView::GetEstimatedMemoryUsage() const
+{
+	// Texture has mip maps (about one third on top) and framebuffer has single RGB attachment (assume padding to four bytes)
+	size_t textureBytes = ((size_t)_spTexture->GetWidth() * (size_t)_spTexture->GetHeight() * 4 * 4) / 3;
+	size_t framebufferBytes = _spFramebuffer ? (size_t)_width * (size_t)_height * 4 : 0;
+	return textureBytes + framebufferBytes;
+}
+
+float WebView::UpdateZoom(float tpf, const WebViewParameters& rParameters, double scrollingOffsetX, double scrollingOffsetY, bool& rRepaint)
+{
+	rRepaint = false;
+
+	// Only render in high resolution when zoomed in noticeably
+	float magnification = 1.f / rParameters.zoom;
+	if (!setup::ZOOM_HIGH_RESOLUTION || magnification < setup::ZOOM_HIGH_RESOLUTION_MIN_MAGNIFICATION || !_spFramebuffer)
+	{
+		_spZoomTexture.reset();
+		_zoomTextureBlend = 0.f;
+		_zoomRepaintPending = false;
+		_deviceScaleFactor = 1.f;
+		return _deviceScaleFactor;
+	}
+
+	// Region of page visible in web view, same mapping as in composition shader
+	glm::vec2 minCoords = (glm::vec2(0.f, 0.f) + rParameters.centerOffset - rParameters.zoomPosition) * rParameters.zoom + rParameters.zoomPosition;
+	glm::vec2 maxCoords = (glm::vec2(1.f, 1.f) + rParameters.centerOffset - rParameters.zoomPosition) * rParameters.zoom + rParameters.zoomPosition;
+	_zoomRegion = glm::clamp(glm::vec4(minCoords, maxCoords), 0.f, 1.f);
+
+	// Device scale factor which renders region in at least display resolution. Power of two, so
+	// CEF has not to re-layout the page at every change of zoom
+	float targetScale = magnification * ((float)_width / (float)glm::max(1, GetResolutionX()));
+	float deviceScaleFactor = 1.f;
+	while (deviceScaleFactor < targetScale && deviceScaleFactor < setup::ZOOM_HIGH_RESOLUTION_MAX_SCALE)
+	{
+		deviceScaleFactor *= 2.f;
+	}
+	deviceScaleFactor = glm::min(deviceScaleFactor, setup::ZOOM_HIGH_RESOLUTION_MAX_SCALE);
+
+	// Rendering in render scale may be sharp enough already
+	if (deviceScaleFactor <= _renderScale)
+	{
+		_spZoomTexture.reset();
+		_zoomTextureBlend = 0.f;
+		_zoomRepaintPending = false;
+		_deviceScaleFactor = 1.f;
+		return _deviceScaleFactor;
+	}
+
+	// Change of device scale factor makes CEF paint again anyway
+	bool covered =
+		_spZoomTexture
+		&& scrollingOffsetX == _zoomTextureScrollingOffsetX
+		&& scrollingOffsetY == _zoomTextureScrollingOffsetY
+		&& _zoomRegion.x >= _zoomTextureRegion.x
+		&& _zoomRegion.y >= _zoomTextureRegion.y
+		&& _zoomRegion.z <= _zoomTextureRegion.z
+		&& _zoomRegion.w <= _zoomTextureRegion.w;
+	if (deviceScaleFactor != _deviceScaleFactor)
+	{
+		_deviceScaleFactor = deviceScaleFactor;
+		_zoomRepaintPending = true;
+		_zoomRepaintTime = 0.f;
+	}
+	else if (!covered)
+	{
+		// Ask for new paint when previous request is answered or timed out
+		_zoomRepaintTime += tpf;
+		if (!_zoomRepaintPending || _zoomRepaintTime >= setup::ZOOM_HIGH_RESOLUTION_REPAINT_TIMEOUT)
+		{
+			_zoomRepaintPending = true;
+			_zoomRepaintTime = 0.f;
+			rRepaint = true;
+		}
+	}
+
+	// Blend towards zoom texture
+	if (_spZoomTexture)
+	{
+		_zoomTextureBlend = glm::min(1.f, _zoomTextureBlend + (tpf / setup::ZOOM_HIGH_RESOLUTION_BLEND_DURATION));
+	}
+
+	return _deviceScaleFactor;
+}
+
+void WebView::FillZoomTexture(int width, int height, const unsigned char* pBuffer, double scrollingOffsetX, double scrollingOffsetY)
+{
+	_zoomRepaintPending = false;
+
+	// Nothing to capture when not zoomed anymore
+	if (_deviceScaleFactor <= 1.f) { return; }
+
+	// Region to capture is visible region with some margin, so small movements of zoom do not require new capture
+	glm::vec2 size = glm::vec2(_zoomRegion.z - _zoomRegion.x, _zoomRegion.w - _zoomRegion.y);
+	glm::vec4 region = glm::clamp(
+		glm::vec4(
+			_zoomRegion.x - (size.x * setup::ZOOM_HIGH_RESOLUTION_MARGIN),
+			_zoomRegion.y - (size.y * setup::ZOOM_HIGH_RESOLUTION_MARGIN),
+			_zoomRegion.z + (size.x * setup::ZOOM_HIGH_RESOLUTION_MARGIN),
+			_zoomRegion.w + (size.y * setup::ZOOM_HIGH_RESOLUTION_MARGIN)),
+		0.f, 1.f);
+
+	// Convert to pixels of buffer
+	int x = (int)(region.x * width);
+	int y = (int)(region.y * height);
+	int regionWidth = glm::max(1, glm::min(width - x, (int)glm::ceil(region.z * width) - x));
+	int regionHeight = glm::max(1, glm::min(height - y, (int)glm::ceil(region.w * height) - y));
+
+	// Upload only region into texture
+	if (!_spZoomTexture || _spZoomTexture->GetWidth() != regionWidth || _spZoomTexture->GetHeight() != regionHeight)
+	{
+		_spZoomTexture = GPUPool::instance().LeaseTexture(regionWidth, regionHeight, GL_RGBA, Texture::Filter::LINEAR, Texture::Wrap::BORDER);
+	}
+	_spZoomTexture->FillFromRegion(width, x, y, regionWidth, regionHeight, GL_BGRA, pBuffer);
+
+	// Remember what has been captured
+	_zoomTextureRegion = glm::vec4(
+		(float)x / (float)width,
+		(float)y / (float)height,
+		(float)(x + regionWidth) / (float)width,
+		(float)(y + regionHeight) / (float)height);
+	_zoomTextureScrollingOffsetX = scrollingOffsetX;
+	_zoomTextureScrollingOffsetY = scrollingOffsetY;
 }
@@ -42,19 +42,22 @@ public:
         int width,
         int height);
 
-    // Draw
+    // Draw. Scrolling shift in CEF pixels moves rendered page up to show scrolling not yet rendered by CEF,
+    // except for rects of fixed elements which are given in CEF pixels of the viewport
     void Draw(
 		const WebViewParameters& parameters,
 		int windowWidth,
 		int windowHeight,
 		double scrollingOffsetX,
-		double scrollingOffsetY) const;
+		double scrollingOffsetY,
+		double scrollingShiftY,
+		const std::vector<std::vector<Rect> >& rFixedElements) const;
 
     // Getter for weak pointer of texture
     std::weak_ptr<Texture> GetTexture();
 
     // Set rects which are not dimmed
-    void SetHighlightRects(std::vector<Rect> rects);
+    void SetHighlightRects(const std::vector<Rect>& rRects);
 
 	// Getter for values of GUI element. Resolution may not be same as web page rendering
 	int GetX() const;
@@ -62,13 +65,36 @@ public:
 	int GetWidth() const;
 	int GetHeight() const;
 
-	// Getter for web view resolution (aka CEFPixels)
+	// Getter for web view resolution (aka CEFPixels). Texture has that resolution multiplied by render scale
 	int GetResolutionX() const;
 	int GetResolutionY() const;
 
+	// Setter and getter for render scale, which is device scale factor of CEF outside of zooming
+	void SetRenderScale(float renderScale) { _renderScale = renderScale; }
+	float GetRenderScale() const { return _renderScale; }
+
+	// Replace content of texture by downscaled snapshot and shrink framebuffer. Returns whether successful
+	bool Hibernate(int snapshotMipMapLevel);
+
+	// Get downscaled snapshot of current rendering as RGBA. Returns whether successful
+	bool GetSnapshot(int mipMapLevel, int& rWidth, int& rHeight, std::vector<unsigned char>& rData) const;
+
+	// Replace content of texture by snapshot, e.g. of restored session, until CEF paints again
+	void ShowSnapshot(int width, int height, const std::vector<unsigned char>& rData);
+
+	// Estimation of bytes currently occupied on GPU by texture and framebuffer
+	size_t GetEstimatedMemoryUsage() const;
+
+	// Update high resolution rendering of zoomed region. Returns device scale factor CEF should render with for zooming, one if none.
+	// Repaint is set when CEF should paint again, because captured region does not cover zoomed one
+	float UpdateZoom(float tpf, const WebViewParameters& rParameters, double scrollingOffsetX, double scrollingOffsetY, bool& rRepaint);
+
+	// Fill zoom texture with zoomed region out of rendering in higher resolution than web view
+	void FillZoomTexture(int width, int height, const unsigned char* pBuffer, double scrollingOffsetX, double scrollingOffsetY);
+
 private:
 
-    // Texture object which belongs here but filled by CEF and read maybe by other
+    // Texture object which belongs here but filled by CEF and read maybe by other. Leased from pool
     std::shared_ptr<Texture> _spTexture;
 
     // Render item
@@ -85,8 +111,32 @@ private:
     // Vector with rects used for highlighting
     std::vector<Rect> _rects;
 
-    // Framebuffer to render highlights etc on webpage and later zoom in
-    std::unique_ptr<Framebuffer> _upFramebuffer;
+    // Framebuffer to render highlights etc on webpage and later zoom in. Leased from pool and released at hibernation
+    std::shared_ptr<Framebuffer> _spFramebuffer;
+
+	// Texture with zoomed region in high resolution and the relative region of page it covers (minX, minY, maxX, maxY, origin upper left)
+	std::shared_ptr<Texture> _spZoomTexture;
+	glm::vec4 _zoomTextureRegion;
+
+	// Relative region of page which is currently visible in zoomed web view (origin upper left)
+	glm::vec4 _zoomRegion;
+
+	// Scrolling offset at capture of zoom texture. Zoom texture is not used when offset has changed since
+	double _zoomTextureScrollingOffsetX = 0;
+	double _zoomTextureScrollingOffsetY = 0;
+
+	// Blending from magnified texture to zoom texture
+	float _zoomTextureBlend = 0.f;
+
+	// Device scale factor requested from CEF for zooming
+	float _deviceScaleFactor = 1.f;
+
+	// Device scale factor of CEF outside of zooming
+	float _renderScale = 1.f;
+
+	// Repaint requested from CEF, which has not been answered yet
+	bool _zoomRepaintPending = false;
+	float _zoomRepaintTime = 0.f;
 };
 
 #endif // WEBVIEW_H_
@@ -7,9 +7,11 @@
 #include "src/State/Web/Tab/Tab.h"
 #include "src/Master.h"
 #include "src/Global.h"
+#include "src/Setup.h"
 #include "src/Utils/Helper.h"
 #include "src/Utils/Texture.h"
 #include "src/Utils/MakeUnique.h"
+#include "src/Utils/Logger.h"
 #include <algorithm>
 
 // Include singleton for mailing to JavaScript
@@ -26,6 +28,15 @@ Web::Web(Master* pMaster, Mediator* pCefMediator) : State(pMaster)
 	// Create hisotry manager
 	_upHistoryManager = std::unique_ptr<HistoryManager>(new HistoryManager(pMaster->GetUserDirectory()));
 
+	// Create tab lifecycle manager
+	_upTabLifecycleManager = std::unique_ptr<TabLifecycleManager>(new TabLifecycleManager((size_t)setup::TAB_MEMORY_BUDGET_MB * 1024 * 1024));
+
+	// Create render scale manager
+	if (setup::ADAPTIVE_RENDER_SCALE)
+	{
+		_upRenderScaleManager = std::unique_ptr<RenderScaleManager>(new RenderScaleManager(1.f));
+	}
+
 	// Create History
 	_upHistory = std::unique_ptr<History>(new History(_pMaster, _upHistoryManager.get()));
 
@@ -68,7 +79,7 @@ Web::~Web()
     // TODO: Delete layouts?
 }
 
-int Web::AddTab(std::string URL, bool show)
+int Web::AddTab(std::string URL, bool show, const SessionManager::TabSession* pSession)
 {
     // Go over existing pairs and determine first free id
     int id = 0;
@@ -91,7 +102,7 @@ int Web::AddTab(std::string URL, bool show)
 
     // Create tab
     std::unique_ptr<Tab> upTab =
-        std::unique_ptr<Tab>(new Tab(_pMaster, _pCefMediator, this, URL));
+        std::unique_ptr<Tab>(new Tab(_pMaster, _pCefMediator, this, URL, pSession));
 
     // Put tab in map
     _tabs.emplace(id, std::move(upTab));
@@ -99,8 +110,17 @@ int Web::AddTab(std::string URL, bool show)
     // Push back at order
     _tabIdOrder.push_back(id);
 
-    // Decide currently displayed tab
-    if(show || _currentTabId < 0)
+    // Tell lifecycle manager about new tab
+    _upTabLifecycleManager->Touch(id);
+
+    // Render in current scale
+    if (_upRenderScaleManager)
+    {
+        _tabs.at(id)->SetRenderScale(_upRenderScaleManager->GetScale());
+    }
+
+    // Decide currently displayed tab (restored tab would create its browser at activation)
+    if(show || (_currentTabId < 0 && !pSession))
     {
         // Switch to tab
         SwitchToTab(id);
@@ -210,6 +230,8 @@ void Web::RemoveTab(int id)
 		// Deactivate and remove from map
 		_tabs.at(id)->Deactivate(); // should be already done but second time should not hurt
 		_tabs.erase(id);
+		_upTabLifecycleManager->Remove(id);
+		_tabSessions.erase(id);
 
 		// Update icon of tab overview button
 		UpdateTabOverviewIcon();
@@ -232,6 +254,73 @@ void Web::RemoveAllTabs()
 	}
 }
 
+bool Web::StartSessionStore()
+{
+	_upSessionManager = std::unique_ptr<SessionManager>(new SessionManager(_pMaster->GetUserDirectory()));
+	_timeUntilSessionSnapshot = setup::SESSION_SNAPSHOT_INTERVAL;
+
+	// Load last session
+	SessionManager::Session session;
+	if (!_upSessionManager->LoadSession(session) || session.tabs.empty())
+	{
+		return false;
+	}
+
+	// Add tabs, which show their thumbnails until activated
+	for (int i = 0; i < (int)session.tabs.size(); i++)
+	{
+		const auto& rTabSession = session.tabs.at(i);
+		int id = AddTab(rTabSession.URL, i == session.currentTabIndex, &rTabSession);
+		_tabSessions[id] = rTabSession;
+	}
+
+	// Show first tab if current one was not stored
+	if (_currentTabId < 0 && !_tabIdOrder.empty())
+	{
+		SwitchToTab(_tabIdOrder.front());
+	}
+
+	LogInfo("Web: Restored ", session.tabs.size(), " tabs of last session");
+	return true;
+}
+
+bool Web::IsCurrentTabLoading() const
+{
+	auto iter = _tabs.find(_currentTabId);
+	return iter != _tabs.end() && iter->second->IsLoading();
+}
+
+float Web::GetRenderScale() const
+{
+	return _upRenderScaleManager ? _upRenderScaleManager->GetScale() : 1.f;
+}
+
+void Web::StoreSession()
+{
+	if (!_upSessionManager) { return; }
+
+	// Collect tabs in order. Thumbnail is only read back for current tab and tabs without one
+	SessionManager::Session session;
+	session.tabs.reserve(_tabIdOrder.size());
+	for (int i = 0; i < (int)_tabIdOrder.size(); i++)
+	{
+		int id = _tabIdOrder.at(i);
+		auto iter = _tabs.find(id);
+		if (iter == _tabs.end()) { continue; }
+
+		auto& rTabSession = _tabSessions[id];
+		iter->second->GetSession(rTabSession, id == _currentTabId || rTabSession.thumbnail.empty());
+		if (id == _currentTabId)
+		{
+			session.currentTabIndex = (int)session.tabs.size();
+		}
+		session.tabs.push_back(rTabSession);
+	}
+
+	// Writing is done in background
+	_upSessionManager->StoreSession(std::move(session));
+}
+
 bool Web::SwitchToTab(int id)
 {
 	bool success = false;
@@ -256,6 +345,7 @@ bool Web::SwitchToTab(int id)
 
         // Set new tab as current
         _currentTabId = id;
+        _upTabLifecycleManager->Touch(id);
 
         // Activate tab
         if(_active)
@@ -436,6 +526,30 @@ StateType Web::Update(float tpf, Input& rInput)
 		_tabs.at(_currentTabId)->Update(tpf, rInput);
     }
 
+    // Adapt render scale to frame time and time spent with painting
+    float paintTime = _pCefMediator->TakePaintTime();
+    if (_upRenderScaleManager)
+    {
+        _upRenderScaleManager->Update(tpf, paintTime, _tabs, _currentTabId);
+    }
+
+    // Hibernate background tabs when running out of memory
+    if (setup::TAB_HIBERNATION)
+    {
+        _upTabLifecycleManager->Update(tpf, _tabs, _currentTabId);
+    }
+
+    // Store session periodically
+    if (_upSessionManager)
+    {
+        _timeUntilSessionSnapshot -= tpf;
+        if (_timeUntilSessionSnapshot <= 0)
+        {
+            _timeUntilSessionSnapshot = setup::SESSION_SNAPSHOT_INTERVAL;
+            StoreSession();
+        }
+    }
+
     // Decide what to do next
     if (_goToSettings)
     {
@@ -630,14 +744,8 @@ void Web::UpdateTabOverview()
         }
 
 		// Styling
-        if (tabId == _currentTabId)
-        {
-			_pMaster->SetStyleTreePropertyValue("tab_preview_" + std::to_string(i), eyegui::StylePropertyVec4::BackgroundColor, "0x50BAA6FF");
-        }
-        else
-        {
-			_pMaster->SetStyleTreePropertyValue("tab_preview_" + std::to_string(i), eyegui::StylePropertyVec4::BackgroundColor, "0x607d8bFF");
-        }
+        _pMaster->GetStyleProperty("tab_preview_" + std::to_string(i), eyegui::StylePropertyVec4::BackgroundColor)->Set(
+            tabId == _currentTabId ? WEB_TAB_PREVIEW_CURRENT_COLOR : WEB_TAB_PREVIEW_COLOR);
     }
 
     // Fill the rest with empty blanks before adding new tab button (otherwise there would be two of them for a moment and id would conflict)
@@ -11,6 +11,9 @@
 #include "src/State/Web/Tab/Tab.h"
 #include "src/State/Web/Managers/BookmarkManager.h"
 #include "src/State/Web/Managers/HistoryManager.h"
+#include "src/State/Web/Managers/TabLifecycleManager.h"
+#include "src/State/Web/Managers/RenderScaleManager.h"
+#include "src/State/Web/Managers/SessionManager.h"
 #include "src/State/Web/Screens/URLInput.h"
 #include "src/State/Web/Screens/History.h"
 #include <map>
@@ -32,8 +35,8 @@ public:
     // Destructor
     virtual ~Web();
 
-    // Add tab and return id of it
-    int AddTab(std::string URL, bool show = true);
+    // Add tab and return id of it. Tab restored from session is not shown unless requested
+    int AddTab(std::string URL, bool show = true, const SessionManager::TabSession* pSession = NULL);
 
     // Add tab after another
     int AddTabAfter(Tab* other, std::string URL, bool show = true);
@@ -62,6 +65,18 @@ public:
 	// Pushs back pointing evaluation pipeline in current tab
 	void PushBackPointingEvaluationPipeline(PointingApproach approach);
 
+	// Start storing session periodically and restore tabs of last session. Returns whether tabs were restored
+	bool StartSessionStore();
+
+	// Hand snapshot of all tabs over to session store, if started
+	void StoreSession();
+
+	// Whether page in current tab is loading
+	bool IsCurrentTabLoading() const;
+
+	// Device scale factor CEF currently renders with
+	float GetRenderScale() const;
+
     // #############
     // ### STATE ###
     // #############
@@ -220,6 +235,21 @@ private:
 	// History manager
 	std::unique_ptr<HistoryManager> _upHistoryManager;
 
+	// Tab lifecycle manager
+	std::unique_ptr<TabLifecycleManager> _upTabLifecycleManager;
+
+	// Render scale manager, only available when render scale is adaptive
+	std::unique_ptr<RenderScaleManager> _upRenderScaleManager;
+
+	// Session manager, only available when session store is started
+	std::unique_ptr<SessionManager> _upSessionManager;
+
+	// Time until next session snapshot
+	float _timeUntilSessionSnapshot = 0.f;
+
+	// Last snapshot of each tab, keeps thumbnails of background tabs
+	std::map<int, SessionManager::TabSession> _tabSessions;
+
 	// History object
 	std::unique_ptr<History> _upHistory;
 
@@ -40,6 +40,10 @@ public:
     // Add attachment (needs bound framebuffer)
 	void AddAttachment(ColorFormat colorFormat, bool clampToBorder = false);
 
+    // Getter for width and height
+    int GetWidth() const { return _width; }
+    int GetHeight() const { return _height; }
+
     // Get texture handle of color attachment
     GLuint GetAttachment(int number) const { return _colorAttachments.at(number).first; }
 
@@ -9,19 +9,24 @@
 #include <cmath>
 #include <vector>
 
-std::string RGBAToHexString(glm::vec4 color)
+unsigned int RGBAToHex(glm::vec4 color)
 {
     // Clamp color
-    glm::clamp(color, glm::vec4(0,0,0,0), glm::vec4(1,1,1,1));
+    color = glm::clamp(color, glm::vec4(0,0,0,0), glm::vec4(1,1,1,1));
 
     // Get 8-Bits out of it
-    unsigned int r = (unsigned int) (color.r * 255);
-    unsigned int g = (unsigned int) (color.g * 255);
-    unsigned int b = (unsigned int) (color.b * 255);
-    unsigned int a = (unsigned int) (color.a * 255);
+    unsigned int r = (unsigned int) std::round(color.r * 255);
+    unsigned int g = (unsigned int) std::round(color.g * 255);
+    unsigned int b = (unsigned int) std::round(color.b * 255);
+    unsigned int a = (unsigned int) std::round(color.a * 255);
 
     // Create hexadecimal out of it
-    unsigned int hexNumber = ((r & 0xff) << 24) + ((g & 0xff) << 16) + ((b & 0xff) << 8) + (a & 0xff);
+    return ((r & 0xff) << 24) + ((g & 0xff) << 16) + ((b & 0xff) << 8) + (a & 0xff);
+}
+
+std::string RGBAToHexString(glm::vec4 color)
+{
+    unsigned int hexNumber = RGBAToHex(color);
 
     // Make string out of it
     std::stringstream ss;
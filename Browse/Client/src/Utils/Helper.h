@@ -11,6 +11,9 @@
 #include <string>
 #include <vector>
 
+// Convert color [0..1] to eight bits per channel, packed as RGBA
+unsigned int RGBAToHex(glm::vec4 color);
+
 // Convert color [0..1] to hexadecimal string
 std::string RGBAToHexString(glm::vec4 color);
 
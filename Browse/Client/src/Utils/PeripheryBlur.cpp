@@ -0,0 +1,196 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+
+#include "PeripheryBlur.h"
+#include "src/Singletons/GPUPool.h"
+#include "src/Singletons/FrameProfiler.h"
+
+// Count of blurred levels. Composition shader expects exactly that count
+static const int PERIPHERY_BLUR_LEVEL_COUNT = 4;
+
+// Shaders
+const std::string peripheryVertexShaderSource =
+"#version 330 core\n"
+"void main() {\n"
+"}\n";
+
+const std::string peripheryGeometryShaderSource =
+"#version 330 core\n"
+"layout(points) in;\n"
+"layout(triangle_strip, max_vertices = 4) out;\n"
+"out vec2 uv;\n"
+"void main() {\n"
+"    gl_Position = vec4(1.0, 1.0, 0.0, 1.0);\n"
+"    uv = vec2(1.0, 1.0);\n"
+"    EmitVertex();\n"
+"    gl_Position = vec4(-1.0, 1.0, 0.0, 1.0);\n"
+"    uv = vec2(0.0, 1.0);\n"
+"    EmitVertex();\n"
+"    gl_Position = vec4(1.0, -1.0, 0.0, 1.0);\n"
+"    uv = vec2(1.0, 0.0);\n"
+"    EmitVertex();\n"
+"    gl_Position = vec4(-1.0, -1.0, 0.0, 1.0);\n"
+"    uv = vec2(0.0, 0.0);\n"
+"    EmitVertex();\n"
+"    EndPrimitive();\n"
+"}\n";
+
+// Bilinear sample between four texels of level above averages them
+const std::string downsampleFragmentShaderSource =
+"#version 330 core\n"
+"in vec2 uv;\n"
+"out vec4 fragColor;\n"
+"uniform sampler2D tex;\n"
+"void main() {\n"
+"   fragColor = vec4(texture(tex, uv).rgb, 1.0);\n"
+"}\n";
+
+// Nine tap Gaussian with five bilinear samples along direction
+const std::string blurFragmentShaderSource =
+"#version 330 core\n"
+"in vec2 uv;\n"
+"out vec4 fragColor;\n"
+"uniform sampler2D tex;\n"
+"uniform vec2 direction;\n" // one texel in direction of pass
+"void main() {\n"
+"   vec3 color = texture(tex, uv).rgb * 0.2270270270;\n"
+"   color += texture(tex, uv + direction * 1.3846153846).rgb * 0.3162162162;\n"
+"   color += texture(tex, uv - direction * 1.3846153846).rgb * 0.3162162162;\n"
+"   color += texture(tex, uv + direction * 3.2307692308).rgb * 0.0702702703;\n"
+"   color += texture(tex, uv - direction * 3.2307692308).rgb * 0.0702702703;\n"
+"   fragColor = vec4(color, 1.0);\n"
+"}\n";
+
+const std::string compositeFragmentShaderSource =
+"#version 330 core\n"
+"in vec2 uv;\n"
+"out vec4 fragColor;\n"
+"uniform sampler2D tex;\n"
+"uniform sampler2D level1;\n"
+"uniform sampler2D level2;\n"
+"uniform sampler2D level3;\n"
+"uniform sampler2D level4;\n"
+"uniform vec2 focusPixelPosition;\n"
+"uniform float focusPixelRadius;\n"
+"uniform float peripheryMultiplier;\n"
+"void main() {\n"
+"   float eccentricity = min(distance(focusPixelPosition, gl_FragCoord.xy) / focusPixelRadius, 1.0);\n"
+"   float level = eccentricity * 4.0;\n" // continuous level of blur, zero is sharp
+"   vec3 color = texture(tex, uv).rgb * max(1.0 - level, 0.0);\n"
+"   color += texture(level1, uv).rgb * max(1.0 - abs(level - 1.0), 0.0);\n"
+"   color += texture(level2, uv).rgb * max(1.0 - abs(level - 2.0), 0.0);\n"
+"   color += texture(level3, uv).rgb * max(1.0 - abs(level - 3.0), 0.0);\n"
+"   color += texture(level4, uv).rgb * max(level - 3.0, 0.0);\n"
+"   color *= mix(1.0, peripheryMultiplier, eccentricity);\n"
+"   fragColor = vec4(color, 1.0);\n"
+"}\n";
+
+PeripheryBlur::PeripheryBlur(int width, int height)
+{
+	// Render items
+	_upDownsampleRenderItem = std::unique_ptr<RenderItem>(new RenderItem(peripheryVertexShaderSource, peripheryGeometryShaderSource, downsampleFragmentShaderSource));
+	_upBlurRenderItem = std::unique_ptr<RenderItem>(new RenderItem(peripheryVertexShaderSource, peripheryGeometryShaderSource, blurFragmentShaderSource));
+	_upCompositeRenderItem = std::unique_ptr<RenderItem>(new RenderItem(peripheryVertexShaderSource, peripheryGeometryShaderSource, compositeFragmentShaderSource));
+
+	// Levels
+	Resize(width, height);
+}
+
+PeripheryBlur::~PeripheryBlur()
+{
+	// Nothing to do
+}
+
+void PeripheryBlur::Resize(int width, int height)
+{
+	// Lease framebuffers of new size. Old ones go back to pool
+	_levels.clear();
+	for (int i = 1; i <= PERIPHERY_BLUR_LEVEL_COUNT; i++)
+	{
+		int levelWidth = glm::max(1, width >> i);
+		int levelHeight = glm::max(1, height >> i);
+		Level level;
+		level.spBlurred = GPUPool::instance().LeaseFramebuffer(levelWidth, levelHeight, Framebuffer::ColorFormat::RGB);
+		level.spIntermediate = GPUPool::instance().LeaseFramebuffer(levelWidth, levelHeight, Framebuffer::ColorFormat::RGB);
+		_levels.push_back(level);
+	}
+}
+
+void PeripheryBlur::Update(GLuint sourceTexture)
+{
+	ProfilerScope profilerScope("PeripheryBlur", true);
+
+	// Rescue current viewport, which is changed for each level
+	GLint viewport[4];
+	glGetIntegerv(GL_VIEWPORT, viewport);
+
+	// Levels are filled completely, so depth is of no interest
+	GLboolean depthTest = glIsEnabled(GL_DEPTH_TEST);
+	glDisable(GL_DEPTH_TEST);
+
+	// Each level is downsampled from blurred level above and blurred again, so blur accumulates
+	GLuint source = sourceTexture;
+	for (const auto& rLevel : _levels)
+	{
+		const float texelX = 1.f / (float)rLevel.spBlurred->GetWidth();
+		const float texelY = 1.f / (float)rLevel.spBlurred->GetHeight();
+
+		// Downsample
+		Pass(*_upDownsampleRenderItem, source, *rLevel.spBlurred);
+
+		// Horizontal pass
+		_upBlurRenderItem->Bind();
+		_upBlurRenderItem->GetShader()->UpdateValue("direction", glm::vec2(texelX, 0.f));
+		Pass(*_upBlurRenderItem, rLevel.spBlurred->GetAttachment(0), *rLevel.spIntermediate);
+
+		// Vertical pass
+		_upBlurRenderItem->GetShader()->UpdateValue("direction", glm::vec2(0.f, texelY));
+		Pass(*_upBlurRenderItem, rLevel.spIntermediate->GetAttachment(0), *rLevel.spBlurred);
+
+		source = rLevel.spBlurred->GetAttachment(0);
+	}
+
+	// Restore viewport and depth test
+	glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+	if (depthTest) { glEnable(GL_DEPTH_TEST); }
+}
+
+void PeripheryBlur::Draw(GLuint sourceTexture, glm::vec2 focusPixelPosition, float focusPixelRadius, float peripheryMultiplier) const
+{
+	// Bind rendering and levels
+	glActiveTexture(GL_TEXTURE0);
+	glBindTexture(GL_TEXTURE_2D, sourceTexture);
+	for (int i = 0; i < (int)_levels.size(); i++)
+	{
+		glActiveTexture(GL_TEXTURE1 + i);
+		glBindTexture(GL_TEXTURE_2D, _levels.at(i).spBlurred->GetAttachment(0));
+	}
+
+	// Composite
+	_upCompositeRenderItem->Bind();
+	_upCompositeRenderItem->GetShader()->UpdateValue("tex", 0);
+	_upCompositeRenderItem->GetShader()->UpdateValue("level1", 1);
+	_upCompositeRenderItem->GetShader()->UpdateValue("level2", 2);
+	_upCompositeRenderItem->GetShader()->UpdateValue("level3", 3);
+	_upCompositeRenderItem->GetShader()->UpdateValue("level4", 4);
+	_upCompositeRenderItem->GetShader()->UpdateValue("focusPixelPosition", focusPixelPosition);
+	_upCompositeRenderItem->GetShader()->UpdateValue("focusPixelRadius", focusPixelRadius);
+	_upCompositeRenderItem->GetShader()->UpdateValue("peripheryMultiplier", peripheryMultiplier);
+	_upCompositeRenderItem->Draw(GL_POINTS);
+
+	// Reset active slot
+	glActiveTexture(GL_TEXTURE0);
+}
+
+void PeripheryBlur::Pass(const RenderItem& rRenderItem, GLuint texture, const Framebuffer& rTarget) const
+{
+	rTarget.Bind();
+	glViewport(0, 0, rTarget.GetWidth(), rTarget.GetHeight());
+	glActiveTexture(GL_TEXTURE0);
+	glBindTexture(GL_TEXTURE_2D, texture);
+	rRenderItem.Bind();
+	rRenderItem.Draw(GL_POINTS);
+	rTarget.Unbind();
+}
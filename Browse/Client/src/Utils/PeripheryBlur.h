@@ -0,0 +1,60 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+// Foveated blur of periphery. Rendering is downsampled into a pyramid of
+// levels, each blurred by separable Gaussian. Composition picks level by
+// distance to focus, so blur grows with eccentricity. Levels are built once
+// per rendering instead of sampling neighborhood for every screen pixel.
+
+#ifndef PERIPHERYBLUR_H_
+#define PERIPHERYBLUR_H_
+
+#include "src/Utils/Framebuffer.h"
+#include "src/Utils/RenderItem.h"
+#include "src/Utils/glmWrapper.h"
+#include "externals/OGL/gl_core_3_3.h"
+#include <memory>
+#include <vector>
+
+class PeripheryBlur
+{
+public:
+
+	// Constructor, takes size of rendering to blur
+	PeripheryBlur(int width, int height);
+
+	// Destructor
+	virtual ~PeripheryBlur();
+
+	// Resize levels to size of rendering
+	void Resize(int width, int height);
+
+	// Build blurred levels from texture of rendering. Must be called whenever rendering has changed
+	void Update(GLuint sourceTexture);
+
+	// Draw rendering with blurred periphery into bound framebuffer. Focus in pixels, OpenGL coordinate system
+	void Draw(GLuint sourceTexture, glm::vec2 focusPixelPosition, float focusPixelRadius, float peripheryMultiplier) const;
+
+private:
+
+	// Level of pyramid with blurred result and intermediate one of horizontal pass
+	struct Level
+	{
+		std::shared_ptr<Framebuffer> spBlurred;
+		std::shared_ptr<Framebuffer> spIntermediate;
+	};
+
+	// Render screen filling quad with texture into framebuffer
+	void Pass(const RenderItem& rRenderItem, GLuint texture, const Framebuffer& rTarget) const;
+
+	// Levels, each with half the resolution of previous one. Leased from GPU pool
+	std::vector<Level> _levels;
+
+	// Render items
+	std::unique_ptr<RenderItem> _upDownsampleRenderItem;
+	std::unique_ptr<RenderItem> _upBlurRenderItem;
+	std::unique_ptr<RenderItem> _upCompositeRenderItem;
+};
+
+#endif // PERIPHERYBLUR_H_
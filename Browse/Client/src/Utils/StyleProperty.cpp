@@ -0,0 +1,79 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+
+#include "StyleProperty.h"
+#include "src/Utils/Helper.h"
+#include <sstream>
+
+// Key of property in registry
+static std::string PropertyKey(eyegui::GUI* pGUI, const std::string& rStyleClass, char kind, int type)
+{
+	std::ostringstream ss;
+	ss << pGUI << ':' << rStyleClass << ':' << kind << type;
+	return ss.str();
+}
+
+bool StylePropertyHandle::Flush()
+{
+	if (!_dirty) { return false; }
+	Apply();
+	_dirty = false;
+	_applied = true;
+	return true;
+}
+
+void StylePropertyVec4Handle::Set(glm::vec4 value)
+{
+	_value = value;
+	_dirty = !_applied || RGBAToHex(value) != _appliedRGBA;
+}
+
+void StylePropertyVec4Handle::Apply()
+{
+	_appliedRGBA = RGBAToHex(_value);
+	eyegui::setStyleTreePropertyValue(_pGUI, _styleClass, _type, RGBAToHexString(_value));
+}
+
+void StylePropertyFloatHandle::Set(float value)
+{
+	_value = value;
+	_dirty = !_applied || value != _appliedValue;
+}
+
+void StylePropertyFloatHandle::Apply()
+{
+	_appliedValue = _value;
+	eyegui::setStyleTreePropertyValue(_pGUI, _styleClass, _type, std::to_string(_value));
+}
+
+StylePropertyVec4Handle* StylePropertyRegistry::Get(eyegui::GUI* pGUI, std::string styleClass, eyegui::StylePropertyVec4 type)
+{
+	std::unique_ptr<StylePropertyHandle>& rupHandle = _handles[PropertyKey(pGUI, styleClass, 'v', (int)type)];
+	if (!rupHandle)
+	{
+		rupHandle = std::unique_ptr<StylePropertyHandle>(new StylePropertyVec4Handle(pGUI, styleClass, type));
+	}
+	return static_cast<StylePropertyVec4Handle*>(rupHandle.get());
+}
+
+StylePropertyFloatHandle* StylePropertyRegistry::Get(eyegui::GUI* pGUI, std::string styleClass, eyegui::StylePropertyFloat type)
+{
+	std::unique_ptr<StylePropertyHandle>& rupHandle = _handles[PropertyKey(pGUI, styleClass, 'f', (int)type)];
+	if (!rupHandle)
+	{
+		rupHandle = std::unique_ptr<StylePropertyHandle>(new StylePropertyFloatHandle(pGUI, styleClass, type));
+	}
+	return static_cast<StylePropertyFloatHandle*>(rupHandle.get());
+}
+
+int StylePropertyRegistry::Flush()
+{
+	int count = 0;
+	for (auto& rPair : _handles)
+	{
+		if (rPair.second->Flush()) { count++; }
+	}
+	return count;
+}
@@ -0,0 +1,115 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+// Handles of properties in style tree of eyeGUI. A handle is bound once to
+// GUI, style class and type and remembers the value it has passed on. eyeGUI
+// parses the value string and invalidates dependent styles at every call, so
+// values are only handed over when they differ from the applied one and only
+// once per frame, when the registry is flushed.
+
+#ifndef STYLEPROPERTY_H_
+#define STYLEPROPERTY_H_
+
+#include "src/Utils/glmWrapper.h"
+#include "submodules/eyeGUI/include/eyeGUI.h"
+#include <string>
+#include <map>
+#include <memory>
+
+// Base of handles, which are owned by registry
+class StylePropertyHandle
+{
+public:
+
+	// Constructor
+	StylePropertyHandle(eyegui::GUI* pGUI, std::string styleClass) : _pGUI(pGUI), _styleClass(styleClass) {}
+
+	// Destructor
+	virtual ~StylePropertyHandle() {}
+
+	// Pass pending value to eyeGUI. Returns whether eyeGUI was called
+	bool Flush();
+
+protected:
+
+	// Hand pending value over to eyeGUI
+	virtual void Apply() = 0;
+
+	// Members
+	eyegui::GUI* _pGUI;
+	std::string _styleClass;
+	bool _dirty = false; // pending value differs from applied one
+	bool _applied = false; // whether any value has been applied yet
+};
+
+// Handle of color property. Values are compared as eight bit per channel, which is what style stores
+class StylePropertyVec4Handle : public StylePropertyHandle
+{
+public:
+
+	// Constructor
+	StylePropertyVec4Handle(eyegui::GUI* pGUI, std::string styleClass, eyegui::StylePropertyVec4 type)
+		: StylePropertyHandle(pGUI, styleClass), _type(type) {}
+
+	// Set value, applied at next flush of registry
+	void Set(glm::vec4 value);
+
+protected:
+
+	// Hand pending value over to eyeGUI
+	virtual void Apply();
+
+private:
+
+	// Members
+	eyegui::StylePropertyVec4 _type;
+	glm::vec4 _value;
+	unsigned int _appliedRGBA = 0;
+};
+
+// Handle of float property
+class StylePropertyFloatHandle : public StylePropertyHandle
+{
+public:
+
+	// Constructor
+	StylePropertyFloatHandle(eyegui::GUI* pGUI, std::string styleClass, eyegui::StylePropertyFloat type)
+		: StylePropertyHandle(pGUI, styleClass), _type(type) {}
+
+	// Set value, applied at next flush of registry
+	void Set(float value);
+
+protected:
+
+	// Hand pending value over to eyeGUI
+	virtual void Apply();
+
+private:
+
+	// Members
+	eyegui::StylePropertyFloat _type;
+	float _value = 0.f;
+	float _appliedValue = 0.f;
+};
+
+// Owner of handles. Same property is always represented by same handle, so
+// callers setting it alternately (like multiple tabs) share applied value
+class StylePropertyRegistry
+{
+public:
+
+	// Get handle of property. Created at first call, valid as long as registry
+	StylePropertyVec4Handle* Get(eyegui::GUI* pGUI, std::string styleClass, eyegui::StylePropertyVec4 type);
+	StylePropertyFloatHandle* Get(eyegui::GUI* pGUI, std::string styleClass, eyegui::StylePropertyFloat type);
+
+	// Pass pending values of all handles to eyeGUI. Returns count of properties set
+	int Flush();
+
+private:
+
+	// Handles by GUI, style class and type
+	std::map<std::string, std::unique_ptr<StylePropertyHandle> > _handles;
+};
+
+#endif // STYLEPROPERTY_H_
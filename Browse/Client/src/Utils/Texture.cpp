@@ -121,6 +121,25 @@ void Texture::Fill(
     glBindTexture(GL_TEXTURE_2D, 0);
 }
 
+void Texture::FillFromRegion(
+    int bufferWidth,
+    int x,
+    int y,
+    int width,
+    int height,
+    GLenum inputFormat,
+    unsigned char const * pBuffer)
+{
+    // Let OpenGL skip pixels outside of region instead of copying it on CPU
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, bufferWidth);
+    glPixelStorei(GL_UNPACK_SKIP_PIXELS, x);
+    glPixelStorei(GL_UNPACK_SKIP_ROWS, y);
+    Fill(width, height, inputFormat, pBuffer);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0); // set back to standard
+    glPixelStorei(GL_UNPACK_SKIP_PIXELS, 0);
+    glPixelStorei(GL_UNPACK_SKIP_ROWS, 0);
+}
+
 int Texture::GetWidth() const
 {
     return _width;
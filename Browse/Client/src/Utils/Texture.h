@@ -53,6 +53,16 @@ public:
         int unpackAlignment = 4,
         bool forceReallocation = false);
 
+    // Fill texture with region of larger buffer. Coordinates in pixels of buffer, which has given width
+    void FillFromRegion(
+        int bufferWidth,
+        int x,
+        int y,
+        int width,
+        int height,
+        GLenum inputFormat,
+        unsigned char const * pBuffer);
+
     // Getter for width and height
     int GetWidth() const;
     int GetHeight() const;
@@ -15,10 +15,10 @@
 #include "src/Utils/Logger.h"
 
 // Execute function to have Master object on stack which might be faster than on heap
-void Execute(CefRefPtr<MainCefApp> app, std::string userDirectory)
+void Execute(CefRefPtr<MainCefApp> app, std::string userDirectory, std::string recordTraceFile, std::string replayTraceFile, std::string benchmarkDirectory)
 {
     // Initialize master
-    Master master(app.get(), userDirectory);
+    Master master(app.get(), userDirectory, recordTraceFile, replayTraceFile, benchmarkDirectory);
 
 	// Give app poiner to master (only functions exposed through interface are accessible)
 	app->SetMaster(&master);
@@ -66,13 +66,26 @@ int CommonMain(const CefMainArgs& args, CefSettings settings, CefRefPtr<MainCefA
 	settings.windowless_rendering_enabled = true;
 	settings.remote_debugging_port = 8088;
 
+	// Let CEF schedule its message loop work
+#ifdef CEF_EXTERNAL_MESSAGE_PUMP_AVAILABLE
+	settings.external_message_pump = Mediator::UsesExternalMessagePump();
+#endif
+
     // Initialize CEF
     LogInfo("Initializing CEF...");
     CefInitialize(args, settings, app.get(), windows_sandbox_info);
     LogInfo("..done.");
 
+	// Optional recording or replay of gaze trace, e.g. --replay-gaze-trace=trace.gtwt
+	CefRefPtr<CefCommandLine> commandLine = CefCommandLine::GetGlobalCommandLine();
+	std::string recordTraceFile = commandLine->GetSwitchValue("record-gaze-trace").ToString();
+	std::string replayTraceFile = commandLine->GetSwitchValue("replay-gaze-trace").ToString();
+
+	// Optional headless benchmark of suite with local pages, e.g. --benchmark=tools/benchmark
+	std::string benchmarkDirectory = commandLine->GetSwitchValue("benchmark").ToString();
+
     // Execute our code
-    Execute(app, userDirectory);
+    Execute(app, userDirectory, recordTraceFile, replayTraceFile, benchmarkDirectory);
 
     // Shutdown CEF
     LogInfo("Shutdown CEF...");
@@ -0,0 +1,218 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+// Microbenchmark of per frame traversals over DOM nodes. Compares map of
+// shared pointers, which returns copy of rects per node, with dense store
+// and its flat rect arrays. Traversals are those Tab performs every frame:
+// gathering of highlight rects, search of nearest link and hit test of
+// overflow elements. Second run moves rects of a fraction of the nodes each
+// frame, like scripted animations do, so the store rebuilds its flat arrays.
+//
+// Usage: DOMNodeStoreBenchmark [node count] [frame count] [updated fraction]
+
+#include "src/CEF/Data/DOMNodeStore.h"
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+// Synthetic node with same geometry interface as DOMNode
+class SyntheticNode
+{
+public:
+
+	SyntheticNode(int id, std::vector<Rect> rects, int fixedId) : _id(id), _rects(rects), _fixedId(fixedId) {}
+	int GetId() const { return _id; }
+	const std::vector<Rect>& GetRects() const { return _rects; }
+	std::vector<Rect> CopyRects() const { return _rects; } // former interface of DOMNode
+	int GetFixedId() const { return _fixedId; }
+	void SetRevision(std::shared_ptr<unsigned int> spRevision) { _spRevision = spRevision; }
+	void SetRects(std::vector<Rect> rects) { _rects = std::move(rects); if (_spRevision) { (*_spRevision)++; } }
+
+private:
+
+	int _id;
+	std::vector<Rect> _rects;
+	int _fixedId;
+	std::shared_ptr<unsigned int> _spRevision;
+};
+
+// Distance of point to rect, zero inside
+float Distance(const Rect& rRect, float x, float y)
+{
+	float dx = glm::max(glm::abs(x - rRect.Center().x) - (rRect.Width() / 2.f), 0.f);
+	float dy = glm::max(glm::abs(y - rRect.Center().y) - (rRect.Height() / 2.f), 0.f);
+	return glm::sqrt((dx * dx) + (dy * dy));
+}
+
+int main(int argc, char* argv[])
+{
+	const int nodeCount = (argc > 1) ? std::stoi(argv[1]) : 10000;
+	const int frameCount = (argc > 2) ? std::stoi(argv[2]) : 600;
+	const float updatedFraction = (argc > 3) ? std::stof(argv[3]) : 0.01f;
+
+	// Create nodes with one to three rects on long page. Allocations are interleaved with
+	// other ones, like nodes which are created while page is parsed
+	std::mt19937 generator(42);
+	std::uniform_real_distribution<float> position(0.f, 20000.f);
+	std::uniform_int_distribution<int> rectCount(1, 3);
+	std::map<int, std::shared_ptr<SyntheticNode> > map;
+	DOMNodeStore<SyntheticNode> store;
+	std::vector<std::shared_ptr<SyntheticNode> > nodes;
+	std::vector<std::vector<Rect> > initialRects;
+	std::vector<std::unique_ptr<char[]> > clutter;
+	for (int id = 0; id < nodeCount; id++)
+	{
+		std::vector<Rect> rects;
+		const int count = rectCount(generator);
+		for (int i = 0; i < count; i++)
+		{
+			float top = position(generator);
+			float left = position(generator) / 20.f;
+			rects.push_back(Rect(top, left, top + 20.f, left + 120.f));
+		}
+		std::shared_ptr<SyntheticNode> spNode = std::make_shared<SyntheticNode>(id, rects, (id % 50 == 0) ? 0 : -1);
+		map.emplace(id, spNode);
+		store.Add(id, spNode);
+		nodes.push_back(spNode);
+		initialRects.push_back(rects);
+		clutter.push_back(std::unique_ptr<char[]>(new char[64 + (id % 7) * 32]));
+	}
+
+	// Gaze moves over page
+	std::vector<glm::vec2> gazes;
+	for (int i = 0; i < frameCount; i++)
+	{
+		gazes.push_back(glm::vec2(position(generator) / 20.f, position(generator)));
+	}
+
+	// Move rects of some nodes depending on frame, so both containers see same geometry
+	const int updatedCount = (int)(updatedFraction * nodeCount);
+	auto updateRects = [&](int frame)
+	{
+		for (int i = 0; i < updatedCount; i++)
+		{
+			const int id = (int)(((long long)frame * updatedCount + i) % nodeCount);
+			std::vector<Rect> rects = initialRects[id];
+			for (Rect& rRect : rects)
+			{
+				rRect.top += (float)(frame % 8);
+				rRect.bottom += (float)(frame % 8);
+			}
+			nodes[id]->SetRects(std::move(rects));
+		}
+	};
+	auto resetRects = [&]()
+	{
+		for (int id = 0; id < nodeCount; id++) { nodes[id]->SetRects(initialRects[id]); }
+	};
+
+	double checksum = 0;
+
+	// Map of shared pointers
+	auto mapFrame = [&](const glm::vec2& rGaze)
+	{
+		// Highlight rects
+		std::vector<Rect> rects;
+		for (const auto& rIdNodePair : map)
+		{
+			for (const auto& rRect : rIdNodePair.second->CopyRects())
+			{
+				rects.push_back(rRect);
+			}
+		}
+		checksum += rects.size();
+
+		// Nearest link
+		float minDistance = std::numeric_limits<float>::max();
+		int nearest = -1;
+		for (const auto& rIdNodePair : map)
+		{
+			for (const auto& rRect : rIdNodePair.second->CopyRects())
+			{
+				float distance = Distance(rRect, rGaze.x, rGaze.y);
+				if (distance < minDistance) { minDistance = distance; nearest = rIdNodePair.second->GetId(); }
+			}
+		}
+		checksum += nearest;
+
+		// Hit test
+		for (const auto& rIdNodePair : map)
+		{
+			for (const auto& rRect : rIdNodePair.second->CopyRects())
+			{
+				float offset = rIdNodePair.second->GetFixedId() ? 100.f : 0.f;
+				if (rRect.IsInside(rGaze.x, rGaze.y + offset)) { checksum += 1; break; }
+			}
+		}
+	};
+
+	// Dense store
+	auto storeFrame = [&](const glm::vec2& rGaze)
+	{
+		// Highlight rects
+		std::vector<Rect> rects = store.GetRects();
+		checksum -= rects.size();
+
+		// Nearest link
+		const std::vector<Rect>& rRects = store.GetRects();
+		const std::vector<int>& rOwners = store.GetRectOwners();
+		float minDistance = std::numeric_limits<float>::max();
+		int nearestOwner = -1;
+		for (int i = 0; i < (int)rRects.size(); i++)
+		{
+			float distance = Distance(rRects[i], rGaze.x, rGaze.y);
+			if (distance < minDistance) { minDistance = distance; nearestOwner = rOwners[i]; }
+		}
+		checksum -= (nearestOwner >= 0) ? store.GetNodes()[nearestOwner]->GetId() : -1;
+
+		// Hit test
+		const std::vector<int>& rFixedIds = store.GetFixedIds();
+		int lastHitOwner = -1;
+		for (int i = 0; i < (int)rRects.size(); i++)
+		{
+			const int owner = rOwners[i];
+			if (owner == lastHitOwner) { continue; }
+			float offset = rFixedIds[owner] ? 100.f : 0.f;
+			if (rRects[i].IsInside(rGaze.x, rGaze.y + offset)) { checksum -= 1; lastHitOwner = owner; }
+		}
+	};
+
+	// Duration of all frames in milliseconds, optionally with moving rects
+	auto measure = [&](const std::function<void(const glm::vec2&)>& rFrame, bool moving)
+	{
+		resetRects();
+		auto start = std::chrono::steady_clock::now();
+		for (int i = 0; i < frameCount; i++)
+		{
+			if (moving) { updateRects(i); }
+			rFrame(gazes[i]);
+		}
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	};
+
+	double mapDuration = measure(mapFrame, false);
+	double storeDuration = measure(storeFrame, false);
+	double movingMapDuration = measure(mapFrame, true);
+	double movingStoreDuration = measure(storeFrame, true);
+
+	// Report, checksum is zero when both traversals produced same results
+	std::cout << std::fixed << std::setprecision(3);
+	std::cout << "Nodes: " << nodeCount << ", frames: " << frameCount << std::endl;
+	std::cout << "Static rects" << std::endl;
+	std::cout << "  Map of shared pointers: " << (mapDuration / frameCount) << " ms per frame" << std::endl;
+	std::cout << "  Dense store:            " << (storeDuration / frameCount) << " ms per frame" << std::endl;
+	std::cout << "  Speedup: " << (mapDuration / storeDuration) << std::endl;
+	std::cout << "Rects of " << updatedCount << " nodes moved per frame" << std::endl;
+	std::cout << "  Map of shared pointers: " << (movingMapDuration / frameCount) << " ms per frame" << std::endl;
+	std::cout << "  Dense store:            " << (movingStoreDuration / frameCount) << " ms per frame" << std::endl;
+	std::cout << "  Speedup: " << (movingMapDuration / movingStoreDuration) << std::endl;
+	std::cout << "Checksum: " << checksum << std::endl;
+	return 0;
+}
@@ -0,0 +1,216 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+// Offline benchmark of gaze filters. Replays a recorded gaze trace through
+// every available filter in frame sized batches and reports stability during
+// fixations, latency after saccades and processing cost per sample.
+//
+// Usage: FilterBenchmark [trace] [frame duration in milliseconds]
+// Trace is either a gaze trace recorded by the client (.gtwt) or a text file
+// with lines "timestamp_ms,x,y,valid" in pixel coordinates. Without trace, a
+// synthetic one with noisy fixations is generated.
+
+#include "src/Input/Filters/Filter.h"
+#include "src/Input/GazeTrace.h"
+#include "src/Setup.h"
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Saccade is assumed when raw gaze jumps further than this multiple of the fixation radius between frames
+const double SACCADE_RADIUS_MULTIPLIER = 3.0;
+
+// Read trace from file. Returns false when file could not be read
+bool ReadTrace(std::string filepath, std::vector<SampleData>& rTrace)
+{
+	// Gaze trace recorded by client
+	const std::string extension = ".gtwt";
+	if (filepath.size() > extension.size() && filepath.compare(filepath.size() - extension.size(), extension.size(), extension) == 0)
+	{
+		GazeTraceReader reader(filepath);
+		GazeTraceFrame frame;
+		while (reader.Read(frame))
+		{
+			rTrace.insert(rTrace.end(), frame.samples.begin(), frame.samples.end());
+		}
+		return !rTrace.empty();
+	}
+
+	// Text file
+	std::ifstream in(filepath);
+	if (!in.is_open()) { return false; }
+	std::string line;
+	while (std::getline(in, line))
+	{
+		if (line.empty() || line[0] == '#') { continue; }
+		std::stringstream stream(line);
+		long long timestamp = 0;
+		double x = 0, y = 0;
+		int valid = 1;
+		char separator;
+		if (stream >> timestamp >> separator >> x >> separator >> y)
+		{
+			stream >> separator >> valid;
+			rTrace.push_back(SampleData(x, y, valid != 0, std::chrono::milliseconds(timestamp)));
+		}
+	}
+	return !rTrace.empty();
+}
+
+// Generate trace at 60Hz with noisy fixations at random positions
+void GenerateTrace(std::vector<SampleData>& rTrace)
+{
+	std::mt19937 generator(42);
+	std::uniform_real_distribution<double> position(0.0, 1000.0);
+	std::uniform_int_distribution<int> fixationDuration(200, 800);
+	std::normal_distribution<double> noise(0.0, 6.0);
+	long long time = 0;
+	for (int fixation = 0; fixation < 500; fixation++)
+	{
+		double x = position(generator);
+		double y = position(generator);
+		long long end = time + fixationDuration(generator);
+		for (; time < end; time += 16)
+		{
+			rTrace.push_back(SampleData(x + noise(generator), y + noise(generator), true, std::chrono::milliseconds(time)));
+		}
+	}
+}
+
+// Results of one filter
+struct Result
+{
+	double jitter = 0; // root mean square of filtered movement during fixations in pixels
+	double latency = 0; // average time until filtered gaze reaches new fixation in milliseconds
+	int missedSaccades = 0; // saccades after which filtered gaze never reached new fixation
+	double costPerSample = 0; // nanoseconds
+};
+
+// Replay trace through filter of given type
+Result Run(FilterType type, const std::vector<SampleData>& rTrace, long long frameDuration)
+{
+	Result result;
+	std::unique_ptr<Filter> upFilter = CreateFilter(type);
+	const double radius = setup::FILTER_GAZE_FIXATION_PIXEL_RADIUS;
+
+	// State of evaluation
+	double previousRawX = 0, previousRawY = 0;
+	double previousGazeX = 0, previousGazeY = 0;
+	bool first = true;
+	bool inSaccade = false;
+	long long saccadeStart = 0;
+	double jitterSum = 0;
+	int jitterCount = 0;
+	double latencySum = 0;
+	int latencyCount = 0;
+	std::chrono::nanoseconds cost(0);
+
+	// Go over frames
+	size_t index = 0;
+	long long frameEnd = rTrace.empty() ? 0 : rTrace.front().timestamp.count() + frameDuration;
+	while (index < rTrace.size())
+	{
+		// Collect samples of frame
+		SampleQueue upSamples(new std::deque<SampleData>);
+		for (; index < rTrace.size() && rTrace[index].timestamp.count() < frameEnd; index++)
+		{
+			upSamples->push_back(rTrace[index]);
+		}
+		long long frameTime = frameEnd;
+		frameEnd += frameDuration;
+		if (upSamples->empty() || !upSamples->back().valid) { continue; }
+		double rawX = upSamples->back().x;
+		double rawY = upSamples->back().y;
+
+		// Filter
+		double gazeX = 0, gazeY = 0;
+		bool saccade = false;
+		auto start = std::chrono::steady_clock::now();
+		upFilter->Update(std::move(upSamples), gazeX, gazeY, saccade);
+		cost += std::chrono::steady_clock::now() - start;
+
+		// Evaluate
+		if (!first)
+		{
+			double rawDelta = std::hypot(rawX - previousRawX, rawY - previousRawY);
+			if (rawDelta > SACCADE_RADIUS_MULTIPLIER * radius)
+			{
+				// New saccade, previous one may have never been reached
+				if (inSaccade) { result.missedSaccades++; }
+				inSaccade = true;
+				saccadeStart = frameTime - frameDuration;
+			}
+			else if (!inSaccade)
+			{
+				// Within fixation
+				double delta = std::hypot(gazeX - previousGazeX, gazeY - previousGazeY);
+				jitterSum += delta * delta;
+				jitterCount++;
+			}
+
+			// Check whether filtered gaze reached new fixation
+			if (inSaccade && std::hypot(gazeX - rawX, gazeY - rawY) <= radius)
+			{
+				latencySum += (double)(frameTime - saccadeStart);
+				latencyCount++;
+				inSaccade = false;
+			}
+		}
+		first = false;
+		previousRawX = rawX;
+		previousRawY = rawY;
+		previousGazeX = gazeX;
+		previousGazeY = gazeY;
+	}
+
+	// Fill result
+	result.jitter = jitterCount > 0 ? std::sqrt(jitterSum / jitterCount) : 0;
+	result.latency = latencyCount > 0 ? latencySum / latencyCount : 0;
+	result.costPerSample = rTrace.empty() ? 0 : (double)cost.count() / rTrace.size();
+	return result;
+}
+
+int main(int argc, char* argv[])
+{
+	// Load or generate trace
+	std::vector<SampleData> trace;
+	if (argc > 1)
+	{
+		if (!ReadTrace(argv[1], trace))
+		{
+			std::cerr << "Could not read trace: " << argv[1] << std::endl;
+			return 1;
+		}
+	}
+	else
+	{
+		GenerateTrace(trace);
+	}
+	long long frameDuration = argc > 2 ? std::max(1, std::atoi(argv[2])) : 16;
+	std::cout << "Samples: " << trace.size() << ", frame duration: " << frameDuration << "ms" << std::endl;
+
+	// Run all filters
+	std::cout << std::left << std::setw(12) << "Filter"
+		<< std::setw(14) << "Jitter [px]"
+		<< std::setw(16) << "Latency [ms]"
+		<< std::setw(10) << "Missed"
+		<< "Cost [ns/sample]" << std::endl;
+	for (int i = 0; i < (int)FilterType::COUNT; i++)
+	{
+		FilterType type = (FilterType)i;
+		Result result = Run(type, trace, frameDuration);
+		std::cout << std::left << std::setw(12) << FilterTypeToString(type)
+			<< std::setw(14) << std::fixed << std::setprecision(3) << result.jitter
+			<< std::setw(16) << std::setprecision(1) << result.latency
+			<< std::setw(10) << result.missedSaccades
+			<< std::setprecision(1) << result.costPerSample << std::endl;
+	}
+	return 0;
+}
@@ -194,6 +194,14 @@ namespace eyegui
         int height = 0;
     };
 
+    //! Struct for statistics of floating frame pool of a layout
+    struct FloatingFramePoolStatistics
+    {
+        unsigned int hits = 0; //!< Check outs which reused an available frame
+        unsigned int misses = 0; //!< Check outs which had to parse the brick
+        unsigned int available = 0; //!< Frames checked in and waiting for reuse
+    };
+
     //! Struct for input
     struct Input
     {
@@ -232,6 +240,16 @@ namespace eyegui
     */
     Layout* addLayout(GUI* pGUI, std::string filepath, int layer = 0, bool visible = true);
 
+    //! Creates layout inside GUI asynchronously. Xml is parsed and images are decoded by a worker thread, elements are created by later update calls within a time budget.
+    /*!
+      \param pGUI pointer to GUI.
+      \param filepath is path to layout xml file.
+      \param callback is called by update of GUI when layout has been added. Gets pointer to added layout, which is NULL if loading failed.
+      \param layer is index of layer into which layout is added. Higher ones are in front.
+      \param visible shall added layout be visible.
+    */
+    void addLayoutAsync(GUI* pGUI, std::string filepath, std::function<void(Layout*)> callback, int layer = 0, bool visible = true);
+
     //! Removes layout in GUI by pointer. Is executed at update call.
     /*!
       \param pGUI pointer to GUI.
@@ -472,6 +490,37 @@ namespace eyegui
     */
     void setElementHiding(Layout* pLayout, std::string id, bool hidden);
 
+    //! Add visual state variant to element.
+    /*!
+      Variant is prepared in advance, so switching to it later on neither allocates
+      nor changes the layout. Original state of element is remembered when first
+      variant is added. Switching does not reevaluate the size of the element, so
+      images of variants should not require a different size than the original one.
+      \param pLayout pointer to layout.
+      \param id is the unique id of an element.
+      \param name of variant. Adding variant with existing name overwrites it.
+      \param styleName is name of style in stylesheet of layout. Empty keeps original style.
+      \param visible indicates, whether element is visible in variant.
+      \param imageFilepath is path to image. Empty keeps original image. Only supported by blocks (background image) and pictures.
+      \param imageAlignment is alignment of image.
+    */
+    void addVariantToElement(
+        Layout* pLayout,
+        std::string id,
+        std::string name,
+        std::string styleName = "",
+        bool visible = true,
+        std::string imageFilepath = "",
+        ImageAlignment imageAlignment = ImageAlignment::STRETCHED);
+
+    //! Switch element to variant.
+    /*!
+      \param pLayout pointer to layout.
+      \param id is the unique id of an element.
+      \param name of variant. Empty name switches back to original state.
+    */
+    void setVariantOfElement(Layout* pLayout, std::string id, std::string name);
+
     //! Check for existence of id.
     /*!
       \param pLayout pointer to layout.
@@ -1025,6 +1074,76 @@ namespace eyegui
         bool visible = true,
         bool fade = false);
 
+    //! Creates floating frame with brick inside asynchronously. Xml is parsed and images are decoded by a worker thread, elements are created by later update calls within a time budget.
+    /*!
+      \param pGUI pointer to GUI which owns the layout.
+      \param pLayout pointer to layout. Frame is not created when layout is removed before.
+      \param filepath is path to brick xml file.
+      \param relativePositionX initial relative x position.
+      \param relativePositionY initial relative y position.
+      \param relativeSizeX initial relative x size.
+      \param relativeSizeY initial relative y size.
+      \param callback is called by update of GUI when frame has been created. Gets whether loading was successful and index of created floating frame.
+      \param idMapper changes ids inside brick to ones in map.
+      \param visible indicates, whether frame should be visible or not.
+      \param fade indicates, whether frame should fade in.
+    */
+    void addFloatingFrameWithBrickAsync(
+        GUI* pGUI,
+        Layout* pLayout,
+        std::string filepath,
+        float relativePositionX,
+        float relativePositionY,
+        float relativeSizeX,
+        float relativeSizeY,
+        std::function<void(bool, unsigned int)> callback,
+        std::map<std::string, std::string> idMapper = std::map<std::string, std::string>(),
+        bool visible = true,
+        bool fade = false);
+
+    //! Checks out floating frame with brick from pool of layout
+    /*!
+      Frames which have been checked in before are reused without parsing the brick
+      again. Content of elements is kept from previous usage, so it should be set again.
+      \param pLayout pointer to layout.
+      \param filepath is path to brick xml file.
+      \param relativePositionX initial relative x position.
+      \param relativePositionY initial relative y position.
+      \param relativeSizeX initial relative x size.
+      \param relativeSizeY initial relative y size.
+      \param idMapper changes ids inside brick to ones in map.
+      \param visible indicates, whether frame should be visible or not.
+      \param fade indicates, whether frame should fade in.
+      \return index of checked out floating frame.
+    */
+    unsigned int checkOutFloatingFrameWithBrick(
+        Layout* pLayout,
+        std::string filepath,
+        float relativePositionX,
+        float relativePositionY,
+        float relativeSizeX,
+        float relativeSizeY,
+        std::map<std::string, std::string> idMapper = std::map<std::string, std::string>(),
+        bool visible = true,
+        bool fade = false);
+
+    //! Checks in floating frame to pool of layout
+    /*!
+      Frame is hidden, its ids are released and listeners registered for its elements are removed.
+      \param pLayout pointer to layout.
+      \param frameIndex index of frame returned at check out.
+    */
+    void checkInFloatingFrame(
+        Layout* pLayout,
+        unsigned int frameIndex);
+
+    //! Get statistics of floating frame pool
+    /*!
+      \param pLayout pointer to layout.
+      \return statistics with hits and misses of check outs.
+    */
+    FloatingFramePoolStatistics getFloatingFramePoolStatistics(Layout* pLayout);
+
     //! Set visibility of floating frame.
     /*!
       \param pLayout pointer to layout.
@@ -1053,6 +1172,7 @@ namespace eyegui
 
     //! Translates floating frame
     /*!
+      Only drawing and input are moved, elements are laid out again when size changes.
       \param pLayout pointer to layout.
       \param frameIndex index of frame in layout.
       \param translateX amount of translation in x direction.
@@ -1079,6 +1199,7 @@ namespace eyegui
 
     //! Set relative position of floating frame
     /*!
+      Only drawing and input are moved, elements are laid out again when size changes.
       \param pLayout pointer to layout.
       \param frameIndex index of frame in layout.
       \param relativePositionX relative x position.
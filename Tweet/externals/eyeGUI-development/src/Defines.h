@@ -37,6 +37,7 @@ namespace eyegui
     static const float FONT_CHARACTER_PADDING = 0.07f; // percentage of height
     static const int FONT_MINIMAL_CHARACTER_PADDING = 2;
     static const float RESIZE_WAIT_DURATION = 0.3f;
+    static const float ASYNC_LOAD_UPDATE_BUDGET = 0.004f; // seconds per update to create textures and elements of asynchronously loaded layouts and bricks
     static const glm::vec4 RESIZE_BLEND_COLOR = glm::vec4(0.75f, 0.75f, 0.75f, 0.75f);
     static const std::u16string LOCALIZATION_NOT_FOUND = u"";
     static const float KEY_CIRCLE_CHARACTER_SIZE_RATIO = 0.6f;
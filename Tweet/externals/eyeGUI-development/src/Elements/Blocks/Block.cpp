@@ -54,6 +54,7 @@ namespace eyegui
         {
             mupImage = mpAssetManager->createImage(mpLayout, backgroundFilepath, backgroundAlignment);
         }
+        mpImage = mupImage.get();
     }
 
     Block::~Block()
@@ -80,26 +81,21 @@ namespace eyegui
         }
 
         // Draw background image if available
-        if(mupImage != NULL)
+        if(mpImage != NULL)
         {
-            mupImage->draw(mAlpha);
+            mpImage->draw(mAlpha);
         }
     }
 
     void Block::specialTransformAndSize()
     {
-        // Background image placing
-        if(mupImage != NULL)
+        // Background image placing, variant images are placed too so they can be shown without relayout
+        std::vector<Image*> images;
+        if (mupImage != NULL) { images.push_back(mupImage.get()); }
+        for (const auto& rupImage : mVariantImages) { images.push_back(rupImage.get()); }
+        for (Image* pImage : images)
         {
-            // First, evaluate size of image (not in own evaluation method, because
-            // this element is not dependend on image size.
-            int imageWidth, imageHeight;
-            mupImage->evaluateSize(mWidth, mHeight, imageWidth, imageHeight);
-
-            // Center image in element
-            int imageDeltaX = (mWidth - imageWidth) / 2;
-            int imageDeltaY = (mHeight - imageHeight) / 2;
-            mupImage->transformAndSize(mX + imageDeltaX, mY + imageDeltaY, imageWidth, imageHeight);
+            transformAndSizeImage(pImage);
         }
 
         // Use inner border
@@ -127,4 +123,40 @@ namespace eyegui
     {
         return mConsumeInput;
     }
+
+    int Block::prepareVariantImage(std::string filepath, ImageAlignment alignment, int index)
+    {
+        std::unique_ptr<Image> upImage = mpAssetManager->createImage(mpLayout, filepath, alignment);
+        transformAndSizeImage(upImage.get());
+        if (index >= 0 && index < (int)mVariantImages.size())
+        {
+            // Replace image, which may be shown currently
+            if (mpImage == mVariantImages[index].get())
+            {
+                mpImage = upImage.get();
+            }
+            mVariantImages[index] = std::move(upImage);
+            return index;
+        }
+        mVariantImages.push_back(std::move(upImage));
+        return (int)mVariantImages.size() - 1;
+    }
+
+    void Block::showVariantImage(int index)
+    {
+        mpImage = (index >= 0) ? mVariantImages[index].get() : mupImage.get();
+    }
+
+    void Block::transformAndSizeImage(Image* pImage)
+    {
+        // First, evaluate size of image (not in own evaluation method, because
+        // this element is not dependend on image size.
+        int imageWidth, imageHeight;
+        pImage->evaluateSize(mWidth, mHeight, imageWidth, imageHeight);
+
+        // Center image in element
+        int imageDeltaX = (mWidth - imageWidth) / 2;
+        int imageDeltaY = (mHeight - imageHeight) / 2;
+        pImage->transformAndSize(mX + imageDeltaX, mY + imageDeltaY, imageWidth, imageHeight);
+    }
 }
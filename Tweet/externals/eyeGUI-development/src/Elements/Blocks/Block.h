@@ -55,6 +55,12 @@ namespace eyegui
         // Implemented by subclasses
         virtual bool mayConsumeInput();
 
+        // Prepare background image of variant
+        virtual int prepareVariantImage(std::string filepath, ImageAlignment alignment, int index);
+
+        // Show background image of variant
+        virtual void showVariantImage(int index);
+
         // Members
         int mInnerX;
         int mInnerY;
@@ -63,9 +69,14 @@ namespace eyegui
 
     private:
 
+        // Place background image centered in element
+        void transformAndSizeImage(Image* pImage);
+
         // Members
         RenderItem const * mpBackground;
         std::unique_ptr<Image> mupImage;
+        std::vector<std::unique_ptr<Image> > mVariantImages;
+        Image* mpImage; // currently shown background image, may be NULL
         float mInnerBorder; // [0..1]
         bool mConsumeInput;
     };
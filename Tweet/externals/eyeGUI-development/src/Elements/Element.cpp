@@ -140,6 +140,11 @@ namespace eyegui
         return mId;
     }
 
+    void Element::setId(std::string id)
+    {
+        mId = id;
+    }
+
     Element* Element::getParent() const
     {
         return mpParent;
@@ -369,6 +374,85 @@ namespace eyegui
         mHidden = hidden;
     }
 
+    void Element::addVariant(
+        std::string name,
+        std::string styleName,
+        bool visible,
+        std::string imageFilepath,
+        ImageAlignment imageAlignment)
+    {
+        if (name.empty())
+        {
+            throwWarning(OperationNotifier::Operation::RUNTIME, "Name of variant must not be empty, element: " + mId);
+            return;
+        }
+
+        // Remember original state at first variant
+        if (mVariants.empty())
+        {
+            Variant original;
+            original.pStyle = mpStyle;
+            original.hidden = mHidden;
+            original.imageIndex = -1;
+            mVariants.push_back(original);
+            mVariantIndices[""] = 0;
+        }
+
+        // Prepare variant
+        Variant variant = mVariants.front();
+        variant.hidden = !visible;
+        if (!styleName.empty())
+        {
+            Style const * pStyle = mpLayout->getStyleFromStylesheet(styleName);
+            if (pStyle != NULL)
+            {
+                variant.pStyle = pStyle;
+            }
+            else
+            {
+                throwWarning(OperationNotifier::Operation::RUNTIME, "Cannot find style with name: " + styleName);
+            }
+        }
+        auto iter = mVariantIndices.find(name);
+        if (!imageFilepath.empty())
+        {
+            // Image of overwritten variant is replaced instead of kept
+            int index = (iter != mVariantIndices.end()) ? mVariants[iter->second].imageIndex : -1;
+            variant.imageIndex = prepareVariantImage(imageFilepath, imageAlignment, index);
+            if (variant.imageIndex < 0)
+            {
+                throwWarning(OperationNotifier::Operation::RUNTIME, "Element does not support images in variants: " + mId);
+            }
+        }
+
+        // Add or overwrite variant with same name
+        if (iter != mVariantIndices.end())
+        {
+            mVariants[iter->second] = variant;
+        }
+        else
+        {
+            mVariantIndices[name] = (int)mVariants.size();
+            mVariants.push_back(variant);
+        }
+    }
+
+    void Element::setVariant(std::string name)
+    {
+        auto iter = mVariantIndices.find(name);
+        if (iter != mVariantIndices.end())
+        {
+            const Variant& rVariant = mVariants[iter->second];
+            mpStyle = rVariant.pStyle;
+            mHidden = rVariant.hidden;
+            showVariantImage(rVariant.imageIndex);
+        }
+        else if (!name.empty())
+        {
+            throwWarning(OperationNotifier::Operation::RUNTIME, "Cannot find variant " + name + " of element: " + mId);
+        }
+    }
+
     float Element::update(float tpf, float alpha, Input* pInput, float dim)
     {
         // *** OWN UPDATING ***
@@ -645,6 +729,17 @@ namespace eyegui
 		return false;
 	}
 
+    int Element::prepareVariantImage(std::string, ImageAlignment, int)
+    {
+        // No image in general element
+        return -1;
+    }
+
+    void Element::showVariantImage(int)
+    {
+        // No image in general element
+    }
+
     bool Element::penetratedByInput(Input const * pInput) const
     {
         // Check whether gaze is upon element
@@ -28,6 +28,7 @@
 #include <memory>
 #include <vector>
 #include <set>
+#include <map>
 
 namespace eyegui
 {
@@ -107,6 +108,9 @@ namespace eyegui
         // Id getter
         std::string getId() const;
 
+        // Id setter, used to rebind ids of pooled frames
+        void setId(std::string id);
+
         // Parent
         Element* getParent() const;
 
@@ -185,6 +189,18 @@ namespace eyegui
         // Set hiding
         void setHiding(bool hidden);
 
+        // Add visual state variant, which is prepared in advance. Empty style name or image
+        // filepath keep the ones of the original state, which is the state at first call
+        void addVariant(
+            std::string name,
+            std::string styleName,
+            bool visible,
+            std::string imageFilepath,
+            ImageAlignment imageAlignment);
+
+        // Switch to variant without any allocation or relayout. Empty name switches back to original state
+        void setVariant(std::string name);
+
         // Updating, returns adaptive scale
         float update(float tpf, float alpha, Input* pInput, float dim);
 
@@ -238,6 +254,12 @@ namespace eyegui
         // Checks, whether element is penetrated by input
         virtual bool penetratedByInput(Input const * pInput) const;
 
+        // Prepare image of variant, returns its index or -1 when element has no image. Image at given index is replaced, if valid
+        virtual int prepareVariantImage(std::string filepath, ImageAlignment alignment, int index);
+
+        // Show image of variant. Index of -1 shows original image
+        virtual void showVariantImage(int index);
+
         // Draw on top of element
         virtual void drawChildren() const;
 
@@ -273,6 +295,16 @@ namespace eyegui
         std::unique_ptr<Element> mupReplacedElement;
         bool mHidden;
         RenderingMask mRenderingMask;
+
+        // Visual state variant
+        struct Variant
+        {
+            Style const * pStyle;
+            bool hidden;
+            int imageIndex;
+        };
+        std::vector<Variant> mVariants; // first one is original state
+        std::map<std::string, int> mVariantIndices;
         RenderItem const * mpActivityItem;
         RenderItem const * mpDimItem;
         RenderItem const * mpMarkItem;
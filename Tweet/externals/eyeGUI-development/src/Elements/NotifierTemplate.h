@@ -73,6 +73,12 @@ namespace eyegui
             return success;
         }
 
+        // Remove all listeners
+        void clearListeners()
+        {
+            mListeners.clear();
+        }
+
     protected:
 
         // Notify listener about something (one need to know which method to call from listener)
@@ -40,6 +40,7 @@ namespace eyegui
 
         // Fill members
         mupImage = std::move(mpAssetManager->createImage(mpLayout, filepath, alignment));
+        mpImage = mupImage.get();
 
         // Aspect ratio of border should be preserved if necessary (only when pictue is neither zoomed nor stretched)
         if (alignment == ImageAlignment::ORIGINAL)
@@ -60,6 +61,7 @@ namespace eyegui
         int& rWidth,
         int& rHeight) const
     {
+        // Size of original image, so switching variants does not require relayout
         mupImage->evaluateSize(availableWidth, availableHeight, rWidth, rHeight);
     }
 
@@ -81,13 +83,17 @@ namespace eyegui
 
     void Picture::specialDraw() const
     {
-        // Draw image owned by this
-        mupImage->draw(mAlpha);
+        // Draw currently shown image owned by this
+        mpImage->draw(mAlpha);
     }
 
     void Picture::specialTransformAndSize()
     {
         mupImage->transformAndSize(mX, mY, mWidth, mHeight);
+        for (const auto& rupImage : mVariantImages)
+        {
+            rupImage->transformAndSize(mX, mY, mWidth, mHeight);
+        }
     }
 
     void Picture::specialReset()
@@ -99,4 +105,27 @@ namespace eyegui
     {
         return true;
     }
+
+    int Picture::prepareVariantImage(std::string filepath, ImageAlignment alignment, int index)
+    {
+        std::unique_ptr<Image> upImage = mpAssetManager->createImage(mpLayout, filepath, alignment);
+        upImage->transformAndSize(mX, mY, mWidth, mHeight);
+        if (index >= 0 && index < (int)mVariantImages.size())
+        {
+            // Replace image, which may be shown currently
+            if (mpImage == mVariantImages[index].get())
+            {
+                mpImage = upImage.get();
+            }
+            mVariantImages[index] = std::move(upImage);
+            return index;
+        }
+        mVariantImages.push_back(std::move(upImage));
+        return (int)mVariantImages.size() - 1;
+    }
+
+    void Picture::showVariantImage(int index)
+    {
+        mpImage = (index >= 0) ? mVariantImages[index].get() : mupImage.get();
+    }
 }
@@ -69,10 +69,18 @@ namespace eyegui
         // Implemented by subclasses
         virtual bool mayConsumeInput();
 
+        // Prepare image of variant
+        virtual int prepareVariantImage(std::string filepath, ImageAlignment alignment, int index);
+
+        // Show image of variant
+        virtual void showVariantImage(int index);
+
     private:
 
         // Members
         std::unique_ptr<Image> mupImage;
+        std::vector<std::unique_ptr<Image> > mVariantImages;
+        Image* mpImage; // currently shown image
     };
 }
 
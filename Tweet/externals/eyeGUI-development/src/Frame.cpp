@@ -9,6 +9,7 @@
 
 #include "Layout.h"
 #include "src/Utilities/Helper.h"
+#include "src/Rendering/ScissorStack.h"
 
 #include <cmath>
 
@@ -31,6 +32,8 @@ namespace eyegui
         mResizeNecessary = true;
         mRelativePositionX = relativePositionX;
         mRelativePositionY = relativePositionY;
+        mLayoutPositionX = relativePositionX;
+        mLayoutPositionY = relativePositionY;
         mRelativeSizeX = relativeSizeX;
         mRelativeSizeY = relativeSizeY;
         mRemoved = false;
@@ -106,6 +109,19 @@ namespace eyegui
                 pInput = NULL;
             }
 
+            // Elements are laid out at old position, so move input into their space
+            int offsetX = getTranslationOffsetX();
+            int offsetY = getTranslationOffsetY();
+            Input translatedInput;
+            Input* pOriginalInput = pInput;
+            if (pInput != NULL && (offsetX != 0 || offsetY != 0))
+            {
+                translatedInput = *pInput;
+                translatedInput.gazeX -= offsetX;
+                translatedInput.gazeY -= offsetY;
+                pInput = &translatedInput;
+            }
+
             // Update front elements (other way than expected because inner ones are added first)
             for (uint i = 0; i < mFrontElements.size(); i++)
             {
@@ -120,6 +136,13 @@ namespace eyegui
             {
                 mResizeNecessary = true;
             }
+
+            // Hand back usage of translated input
+            if (pInput == &translatedInput)
+            {
+                pOriginalInput->gazeUsed = translatedInput.gazeUsed;
+                pOriginalInput->instantInteraction = translatedInput.instantInteraction;
+            }
         }
 
         // *** DELETION OF REPLACED ELEMENTS ***
@@ -134,6 +157,16 @@ namespace eyegui
         // Use alpha because while fading it should still draw
         if (mCombinedAlpha > 0)
         {
+            // Move viewport and scissors instead of elements when only translated
+            int offsetX = getTranslationOffsetX();
+            int offsetY = getTranslationOffsetY();
+            bool translated = offsetX != 0 || offsetY != 0;
+            if (translated)
+            {
+                glViewport(offsetX, -offsetY, (GLsizei)mpLayout->getLayoutWidth(), (GLsizei)mpLayout->getLayoutHeight()); // OpenGL origin is lower left
+                setScissorOffset(offsetX, offsetY);
+            }
+
             // Draw standard elements
             mupRoot->draw();
 
@@ -143,6 +176,13 @@ namespace eyegui
                 Element const * pElement = mFrontElements[i];
                 pElement->draw();
             }
+
+            // Reset translation
+            if (translated)
+            {
+                glViewport(0, 0, (GLsizei)mpLayout->getLayoutWidth(), (GLsizei)mpLayout->getLayoutHeight());
+                setScissorOffset(0, 0);
+            }
         }
     }
 
@@ -289,7 +329,6 @@ namespace eyegui
     {
         mRelativePositionX += translateX;
         mRelativePositionY += translateY;
-        mResizeNecessary = true;
     }
 
     void Frame::scale(float scaleX, float scaleY)
@@ -304,11 +343,30 @@ namespace eyegui
     {
         mRelativePositionX = relativePositionX;
         mRelativePositionY = relativePositionY;
-        mResizeNecessary = true;
+    }
+
+    int Frame::getTranslationOffsetX() const
+    {
+        if (mResizeNecessary) { return 0; } // next layout uses current position
+        int layoutWidth = mpLayout->getLayoutWidth();
+        return (int)std::round(mRelativePositionX * (float)layoutWidth) - (int)std::round(mLayoutPositionX * (float)layoutWidth);
+    }
+
+    int Frame::getTranslationOffsetY() const
+    {
+        if (mResizeNecessary) { return 0; } // next layout uses current position
+        int layoutHeight = mpLayout->getLayoutHeight();
+        return (int)std::round(mRelativePositionY * (float)layoutHeight) - (int)std::round(mLayoutPositionY * (float)layoutHeight);
     }
 
     void Frame::setSize(float relativeSizeX, float relativeSizeY)
     {
+        // Layout only when size changes
+        if (relativeSizeX == mRelativeSizeX && relativeSizeY == mRelativeSizeY)
+        {
+            return;
+        }
+
         mRelativeSizeX = relativeSizeX;
         mRelativeSizeY = relativeSizeY;
         clampSize();
@@ -340,6 +398,8 @@ namespace eyegui
                 (int)std::round(mRelativePositionY * (float)layoutHeight + deltaY),
                 usedWidth,
                 usedHeight);
+            mLayoutPositionX = mRelativePositionX;
+            mLayoutPositionY = mRelativePositionY;
             mResizeNecessary = false;
         }
     }
@@ -112,9 +112,13 @@ namespace eyegui
         // Scaling
         void scale(float scaleX, float scaleY);
 
-        // Set position
+        // Set position. Only translates drawing and input, no relayout
         void setPosition(float relativePositionX, float relativePositionY);
 
+        // Offset in pixels between current position and position of last layout
+        int getTranslationOffsetX() const;
+        int getTranslationOffsetY() const;
+
         // Set size
         void setSize(float relativeSizeX, float relativeSizeY);
 
@@ -138,6 +142,8 @@ namespace eyegui
         bool mResizeNecessary;
         float mRelativePositionX;
         float mRelativePositionY;
+        float mLayoutPositionX; // relative position used by last layout
+        float mLayoutPositionY;
         float mRelativeSizeX;
         float mRelativeSizeY;
         bool mRemoved;
@@ -15,6 +15,7 @@
 #include "externals/OpenGLLoader/gl_core_3_3.h"
 
 #include <algorithm>
+#include <chrono>
 
 namespace eyegui
 {
@@ -85,6 +86,23 @@ namespace eyegui
         // Parse layout
         std::unique_ptr<Layout> upLayout = layout_parser::parse(this, mupAssetManager.get(), filepath);
 
+        // Add it
+        return insertLayout(std::move(upLayout), layer, visible);
+    }
+
+    void GUI::addLayoutAsync(std::string filepath, int layer, bool visible, std::function<void(Layout*)> callback)
+    {
+        std::unique_ptr<AsyncLoad> upLoad = std::unique_ptr<AsyncLoad>(new AsyncLoad);
+        upLoad->filepath = filepath;
+        upLoad->pLayout = NULL;
+        upLoad->layer = layer;
+        upLoad->visible = visible;
+        upLoad->layoutCallback = callback;
+        requestAsyncLoad(std::move(upLoad), LAYOUT_EXTENSION);
+    }
+
+    Layout* GUI::insertLayout(std::unique_ptr<Layout> upLayout, int layer, bool visible)
+    {
         // Get raw pointer to return
         Layout* pLayout = upLayout.get();
 
@@ -102,9 +120,44 @@ namespace eyegui
 
     void GUI::removeLayout(Layout const * pLayout)
     {
+        // Bricks for that layout must not be added anymore
+        for (auto& rupLoad : mAsyncLoads)
+        {
+            if (rupLoad->pLayout == pLayout)
+            {
+                rupLoad->cancelled = true;
+            }
+        }
+
         mJobs.push_back(std::move(std::unique_ptr<GUIJob>(new RemoveLayoutJob(this, pLayout))));
     }
 
+    void GUI::addFloatingFrameWithBrickAsync(
+        Layout* pLayout,
+        std::string filepath,
+        float relativePositionX,
+        float relativePositionY,
+        float relativeSizeX,
+        float relativeSizeY,
+        std::map<std::string, std::string> idMapper,
+        bool visible,
+        bool fade,
+        std::function<void(bool, uint)> callback)
+    {
+        std::unique_ptr<AsyncLoad> upLoad = std::unique_ptr<AsyncLoad>(new AsyncLoad);
+        upLoad->filepath = filepath;
+        upLoad->pLayout = pLayout;
+        upLoad->visible = visible;
+        upLoad->relativePositionX = relativePositionX;
+        upLoad->relativePositionY = relativePositionY;
+        upLoad->relativeSizeX = relativeSizeX;
+        upLoad->relativeSizeY = relativeSizeY;
+        upLoad->idMapper = idMapper;
+        upLoad->fade = fade;
+        upLoad->brickCallback = callback;
+        requestAsyncLoad(std::move(upLoad), BRICK_EXTENSION);
+    }
+
     void GUI::resize(int width, int height)
     {
         // Not necessary but saves one from resizing after minimizing
@@ -153,6 +206,9 @@ namespace eyegui
 
     Input GUI::update(float tpf, const Input input)
     {
+        // Finish asynchronous loads, which may add jobs
+        finishAsyncLoads();
+
         // Execute all jobs
         for (std::unique_ptr<GUIJob>& rupJob : mJobs)
         {
@@ -392,6 +448,113 @@ namespace eyegui
         mResizeCallbackSet = true;
     }
 
+    void GUI::requestAsyncLoad(std::unique_ptr<AsyncLoad> upLoad, std::string extension)
+    {
+        // Start worker thread at first usage
+        if (mupAsyncParser == NULL)
+        {
+            mupAsyncParser = std::unique_ptr<AsyncParser>(new AsyncParser());
+        }
+
+        // Images with existing textures are not decoded again
+        upLoad->cancelled = false;
+        upLoad->stagedImageCount = 0;
+        mupAsyncParser->request(upLoad->filepath, extension, mVectorGraphicsDPI, mupAssetManager->getTextureFilepaths());
+        mAsyncLoads.push_back(std::move(upLoad));
+    }
+
+    void GUI::finishAsyncLoads()
+    {
+        // Each step checks the budget before it starts, so at least one step is done per update
+        auto start = std::chrono::steady_clock::now();
+        auto budgetLeft = [&]()
+        {
+            return std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count() < ASYNC_LOAD_UPDATE_BUDGET;
+        };
+
+        while (!mAsyncLoads.empty())
+        {
+            // Results arrive in order of requests
+            AsyncLoad* pLoad = mAsyncLoads.front().get();
+            if (pLoad->upResult == NULL)
+            {
+                pLoad->upResult = mupAsyncParser->poll();
+                if (pLoad->upResult == NULL)
+                {
+                    return;
+                }
+            }
+            AsyncParser::Result* pResult = pLoad->upResult.get();
+
+            // Create textures out of decoded images
+            if (!pLoad->cancelled && pResult->upDocument != NULL)
+            {
+                while (pLoad->stagedImageCount < pResult->images.size())
+                {
+                    if (!budgetLeft())
+                    {
+                        return;
+                    }
+                    auto& rImage = pResult->images[pLoad->stagedImageCount];
+                    mupAssetManager->stageTexture(rImage.first, *(rImage.second.get()));
+                    rImage.second.reset();
+                    pLoad->stagedImageCount++;
+                }
+                if (!budgetLeft())
+                {
+                    return;
+                }
+            }
+
+            // Take load out of queue, since callback may request further loads
+            std::unique_ptr<AsyncLoad> upLoad = std::move(mAsyncLoads.front());
+            mAsyncLoads.pop_front();
+            if (upLoad->cancelled)
+            {
+                continue;
+            }
+
+            // Report failure of worker
+            if (pResult->upDocument == NULL)
+            {
+                throwError(OperationNotifier::Operation::PARSING, pResult->error, pResult->filepath);
+                if (upLoad->pLayout == NULL)
+                {
+                    if (upLoad->layoutCallback) { upLoad->layoutCallback(NULL); }
+                }
+                else
+                {
+                    if (upLoad->brickCallback) { upLoad->brickCallback(false, 0); }
+                }
+                continue;
+            }
+
+            // Create elements and attach them
+            if (upLoad->pLayout == NULL)
+            {
+                Layout* pLayout = insertLayout(
+                    layout_parser::parse(this, mupAssetManager.get(), *(pResult->upDocument.get()), upLoad->filepath),
+                    upLoad->layer,
+                    upLoad->visible);
+                if (upLoad->layoutCallback) { upLoad->layoutCallback(pLayout); }
+            }
+            else
+            {
+                uint frameIndex = upLoad->pLayout->addFloatingFrameWithBrick(
+                    upLoad->filepath,
+                    upLoad->relativePositionX,
+                    upLoad->relativePositionY,
+                    upLoad->relativeSizeX,
+                    upLoad->relativeSizeY,
+                    upLoad->idMapper,
+                    upLoad->visible,
+                    upLoad->fade,
+                    pResult->upDocument.get());
+                if (upLoad->brickCallback) { upLoad->brickCallback(true, frameIndex); }
+            }
+        }
+    }
+
     void GUI::internalResizing()
     {
         // Actual resizing action
@@ -17,6 +17,7 @@
 #include "Layer.h"
 #include "Parser/ConfigParser.h"
 #include "Parser/LocalizationParser.h"
+#include "Parser/AsyncParser.h"
 #include "Rendering/AssetManager.h"
 #include "Rendering/GLSetup.h"
 #include "Config.h"
@@ -26,6 +27,7 @@
 #include <memory>
 #include <vector>
 #include <functional>
+#include <deque>
 
 namespace eyegui
 {
@@ -55,9 +57,26 @@ namespace eyegui
         // Load layout from xml, returns NULL if fails
         Layout* addLayout(std::string filepath, int layer, bool visible);
 
+        // Load layout from xml on worker thread. Callback is called at later update with pointer to layout, NULL if fails
+        void addLayoutAsync(std::string filepath, int layer, bool visible, std::function<void(Layout*)> callback);
+
         // Remove layout
         void removeLayout(Layout const * pLayout);
 
+        // Load brick from xml on worker thread and add it as floating frame to layout. Callback is called
+        // at later update with whether successful and index of frame
+        void addFloatingFrameWithBrickAsync(
+            Layout* pLayout,
+            std::string filepath,
+            float relativePositionX,
+            float relativePositionY,
+            float relativeSizeX,
+            float relativeSizeY,
+            std::map<std::string, std::string> idMapper,
+            bool visible,
+            bool fade,
+            std::function<void(bool, uint)> callback);
+
         // Resize whole gui
         void resize(int width, int height);
 
@@ -221,6 +240,35 @@ namespace eyegui
 
         // #####################################################################
 
+        // Layout or brick loaded by worker thread, waiting for creation of textures and elements
+        struct AsyncLoad
+        {
+            std::string filepath;
+            Layout* pLayout; // target of brick, NULL for layout
+            bool cancelled; // target layout has been removed meanwhile
+            int layer;
+            bool visible;
+            std::function<void(Layout*)> layoutCallback;
+            float relativePositionX;
+            float relativePositionY;
+            float relativeSizeX;
+            float relativeSizeY;
+            std::map<std::string, std::string> idMapper;
+            bool fade;
+            std::function<void(bool, uint)> brickCallback;
+            std::unique_ptr<AsyncParser::Result> upResult; // NULL while worker is busy
+            uint stagedImageCount;
+        };
+
+        // Add parsed layout to GUI
+        Layout* insertLayout(std::unique_ptr<Layout> upLayout, int layer, bool visible);
+
+        // Hand load over to worker thread
+        void requestAsyncLoad(std::unique_ptr<AsyncLoad> upLoad, std::string extension);
+
+        // Create textures and elements of loads finished by worker thread, as long as time budget allows
+        void finishAsyncLoads();
+
         // Internal resizing
         void internalResizing();
 
@@ -253,6 +301,8 @@ namespace eyegui
 		bool mResizeInvisibleLayouts;
 		std::function<void(int, int)> mResizeCallbackFunction;
 		bool mResizeCallbackSet;
+        std::unique_ptr<AsyncParser> mupAsyncParser; // created at first asynchronous load
+        std::deque<std::unique_ptr<AsyncLoad> > mAsyncLoads;
     };
 }
 
@@ -31,6 +31,8 @@ namespace eyegui
         mupMainFrame = std::unique_ptr<Frame>(new Frame(this, 0, 0, 1, 1));
         mupNotificationQueue = std::unique_ptr<NotificationQueue>(new NotificationQueue(this));
         mForceResize = false;
+        mFramePoolHits = 0;
+        mFramePoolMisses = 0;
 
         // Parse style file
         mupStyles = stylesheet_parser::parse(stylesheetFilepath);
@@ -250,8 +252,10 @@ namespace eyegui
         Element* pElement = fetchElement(id);
         if (pElement != NULL)
         {
-            result.x = pElement->getRelativePositionOnLayoutX();
-            result.y = pElement->getRelativePositionOnLayoutY();
+            // Add translation of frame which has not been laid out, yet
+            Frame const * pFrame = pElement->getFrame();
+            result.x = pElement->getRelativePositionOnLayoutX() + ((float)pFrame->getTranslationOffsetX() / (float)getLayoutWidth());
+            result.y = pElement->getRelativePositionOnLayoutY() + ((float)pFrame->getTranslationOffsetY() / (float)getLayoutHeight());
             result.width = pElement->getRelativeSizeOnLayoutX();
             result.height = pElement->getRelativeSizeOnLayoutY();
         }
@@ -268,8 +272,10 @@ namespace eyegui
         Element* pElement = fetchElement(id);
         if (pElement != NULL)
         {
-            result.x = pElement->getX();
-            result.y = pElement->getY();
+            // Add translation of frame which has not been laid out, yet
+            Frame const * pFrame = pElement->getFrame();
+            result.x = pElement->getX() + pFrame->getTranslationOffsetX();
+            result.y = pElement->getY() + pFrame->getTranslationOffsetY();
             result.width = pElement->getWidth();
             result.height = pElement->getHeight();
         }
@@ -352,6 +358,38 @@ namespace eyegui
         }
     }
 
+    void Layout::addVariantToElement(
+        std::string id,
+        std::string name,
+        std::string styleName,
+        bool visible,
+        std::string imageFilepath,
+        ImageAlignment imageAlignment)
+    {
+        Element* pElement = fetchElement(id);
+        if (pElement != NULL)
+        {
+            pElement->addVariant(name, styleName, visible, imageFilepath, imageAlignment);
+        }
+        else
+        {
+            throwWarning(OperationNotifier::Operation::RUNTIME, "Cannot find element with id: " + id);
+        }
+    }
+
+    void Layout::setVariantOfElement(std::string id, std::string name)
+    {
+        Element* pElement = fetchElement(id);
+        if (pElement != NULL)
+        {
+            pElement->setVariant(name);
+        }
+        else
+        {
+            throwWarning(OperationNotifier::Operation::RUNTIME, "Cannot find element with id: " + id);
+        }
+    }
+
     void Layout::setStyleOfElement(std::string id, std::string style)
     {
         Element* pElement = fetchElement(id);
@@ -1270,6 +1308,38 @@ namespace eyegui
     }
 
     uint Layout::addFloatingFrameWithBrick(
+        std::string filepath,
+        float relativePositionX,
+        float relativePositionY,
+        float relativeSizeX,
+        float relativeSizeY,
+        std::map<std::string, std::string> idMapper,
+        bool visible,
+        bool fade,
+        tinyxml2::XMLDocument const * pDocument)
+    {
+        // Create frame
+        std::unique_ptr<idMap> upIdMap;
+        uint frameIndex = createFloatingFrameWithBrick(
+            filepath,
+            relativePositionX,
+            relativePositionY,
+            relativeSizeX,
+            relativeSizeY,
+            idMapper,
+            visible,
+            fade,
+            upIdMap,
+            pDocument);
+
+        // Insert ids
+        insertIds(std::move(upIdMap));
+
+        // Return index
+        return frameIndex;
+    }
+
+    uint Layout::checkOutFloatingFrameWithBrick(
         std::string filepath,
         float relativePositionX,
         float relativePositionY,
@@ -1278,6 +1348,142 @@ namespace eyegui
         std::map<std::string, std::string> idMapper,
         bool visible,
         bool fade)
+    {
+        uint frameIndex = 0;
+        std::vector<uint>& rAvailable = mAvailablePooledFrames[filepath];
+        if (!rAvailable.empty())
+        {
+            // Reuse available frame
+            mFramePoolHits++;
+            frameIndex = rAvailable.back();
+            rAvailable.pop_back();
+            Frame* pFrame = mFloatingFrames[frameIndex].get();
+            pFrame->setPosition(relativePositionX, relativePositionY);
+            pFrame->setSize(relativeSizeX, relativeSizeY);
+            pFrame->setVisibility(visible, fade);
+            moveFloatingFrameToFront(frameIndex);
+        }
+        else
+        {
+            // Create new frame with ids as written in brick
+            mFramePoolMisses++;
+            std::unique_ptr<idMap> upIdMap;
+            frameIndex = createFloatingFrameWithBrick(
+                filepath,
+                relativePositionX,
+                relativePositionY,
+                relativeSizeX,
+                relativeSizeY,
+                std::map<std::string, std::string>(),
+                visible,
+                fade,
+                upIdMap);
+
+            // Remember ids for rebinding
+            PooledFrame pooledFrame;
+            pooledFrame.filepath = filepath;
+            pooledFrame.checkedOut = false;
+            for (const auto& rIdElement : *(upIdMap.get()))
+            {
+                pooledFrame.ids.push_back(std::make_pair(rIdElement.first, rIdElement.first));
+            }
+            mPooledFrames[frameIndex] = pooledFrame;
+        }
+
+        // Bind ids with mapper. Elements replaced by ones without bound id are skipped
+        PooledFrame& rPooledFrame = mPooledFrames[frameIndex];
+        std::map<std::string, Element*> elements = mapIdsOfFrame(mFloatingFrames[frameIndex].get());
+        for (auto& rIds : rPooledFrame.ids)
+        {
+            auto element = elements.find(rIds.second);
+            if (element == elements.end()) { continue; }
+            auto mapped = idMapper.find(rIds.first);
+            rIds.second = (mapped != idMapper.end()) ? mapped->second : rIds.first;
+            element->second->setId(rIds.second);
+            insertId(element->second);
+        }
+        rPooledFrame.checkedOut = true;
+
+        return frameIndex;
+    }
+
+    void Layout::checkInFloatingFrame(uint frameIndex)
+    {
+        auto iter = mPooledFrames.find(frameIndex);
+        Frame* pFrame = fetchFloatingFrame(frameIndex);
+        if (iter == mPooledFrames.end() || !iter->second.checkedOut || pFrame == NULL)
+        {
+            throwWarning(OperationNotifier::Operation::RUNTIME, "Floating frame is not checked out from pool: " + std::to_string(frameIndex));
+            return;
+        }
+
+        // Unbind ids and forget listeners, which are registered for those ids
+        std::map<std::string, Element*> elements = mapIdsOfFrame(pFrame);
+        for (const auto& rIds : iter->second.ids)
+        {
+            auto element = elements.find(rIds.second);
+            if (element == elements.end()) { continue; }
+            Element* pElement = element->second;
+            mupIds->erase(rIds.second);
+            if (Button* pButton = toButton(pElement)) { pButton->clearListeners(); }
+            else if (Sensor* pSensor = toSensor(pElement)) { pSensor->clearListeners(); }
+            else if (Keyboard* pKeyboard = toKeyboard(pElement)) { pKeyboard->clearListeners(); }
+            else if (WordSuggest* pWordSuggest = toWordSuggest(pElement)) { pWordSuggest->clearListeners(); }
+        }
+
+        // Deselected element if it is in frame
+        std::set<Element*> children = pFrame->getAllElements();
+        if (children.find(mpSelectedInteractiveElement) != children.end())
+        {
+            deselectInteractiveElement();
+        }
+
+        // Hide and reset frame until next check out
+        pFrame->setVisibility(false, false);
+        pFrame->resetElements();
+        iter->second.checkedOut = false;
+        mAvailablePooledFrames[iter->second.filepath].push_back(frameIndex);
+    }
+
+    std::map<std::string, Element*> Layout::mapIdsOfFrame(Frame const * pFrame) const
+    {
+        std::map<std::string, Element*> elements;
+        for (Element* pElement : pFrame->getAllElements())
+        {
+            if (pElement->getId() != EMPTY_STRING_ATTRIBUTE)
+            {
+                elements[pElement->getId()] = pElement;
+            }
+        }
+        return elements;
+    }
+
+    FloatingFramePoolStatistics Layout::getFloatingFramePoolStatistics() const
+    {
+        FloatingFramePoolStatistics statistics;
+        statistics.hits = mFramePoolHits;
+        statistics.misses = mFramePoolMisses;
+        for (const auto& rPooledFrame : mPooledFrames)
+        {
+            if (!rPooledFrame.second.checkedOut)
+            {
+                statistics.available++;
+            }
+        }
+        return statistics;
+    }
+
+    uint Layout::createFloatingFrameWithBrick(
+        std::string filepath,
+        float relativePositionX,
+        float relativePositionY,
+        float relativeSizeX,
+        float relativeSizeY,
+        std::map<std::string, std::string> idMapper,
+        bool visible,
+        bool fade,
+        std::unique_ptr<idMap>& rupIdMap,
+        tinyxml2::XMLDocument const * pDocument)
     {
         // Push back new frame
         auto upFrame = std::unique_ptr<Frame>(
@@ -1318,15 +1524,30 @@ namespace eyegui
         mFloatingFramesOrderingIndices.push_back(frameIndex);
 
         // Create brick
-        std::unique_ptr<elementsAndIds> upPair = std::move(
-            brick_parser::parse(
+        std::unique_ptr<elementsAndIds> upPair;
+        if (pDocument != NULL)
+        {
+            upPair = brick_parser::parse(
+                this,
+                pFrame,
+                mpAssetManager,
+                mupNotificationQueue.get(),
+                NULL,
+                *pDocument,
+                filepath,
+                idMapper);
+        }
+        else
+        {
+            upPair = brick_parser::parse(
                 this,
                 pFrame,
                 mpAssetManager,
                 mupNotificationQueue.get(),
                 NULL,
                 filepath,
-                idMapper));
+                idMapper);
+        }
 
         // Attach elements to root of frame
         pFrame->attachRoot(std::move(upPair->first));
@@ -1334,8 +1555,8 @@ namespace eyegui
         // Set visibility
         pFrame->setVisibility(visible, fade);
 
-        // Insert ids
-        insertIds(std::move(upPair->second));
+        // Hand over ids
+        rupIdMap = std::move(upPair->second);
 
         // Do some initial resize to be ok for first draw
         pFrame->makeResizeNecessary(true);
@@ -1367,10 +1588,24 @@ namespace eyegui
         Frame* pFrame = fetchFloatingFrame(frameIndex);
         if (pFrame != NULL)
         {
+            // Forget about pooled frame, its ids are not bound when checked in
+            bool idsBound = true;
+            auto iter = mPooledFrames.find(frameIndex);
+            if (iter != mPooledFrames.end())
+            {
+                idsBound = iter->second.checkedOut;
+                std::vector<uint>& rAvailable = mAvailablePooledFrames[iter->second.filepath];
+                rAvailable.erase(std::remove(rAvailable.begin(), rAvailable.end(), frameIndex), rAvailable.end());
+                mPooledFrames.erase(iter);
+            }
+
             // Remove ids
-            for (std::string id : pFrame->getAllElementsIds())
+            if (idsBound)
             {
-                mupIds->erase(id);
+                for (std::string id : pFrame->getAllElementsIds())
+                {
+                    mupIds->erase(id);
+                }
             }
 
             // Reminder for removed frame
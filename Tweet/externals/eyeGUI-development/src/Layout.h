@@ -114,6 +114,18 @@ namespace eyegui
         // Set hiding of element
         void setElementHiding(std::string id, bool hidden);
 
+        // Add visual state variant to element
+        void addVariantToElement(
+            std::string id,
+            std::string name,
+            std::string styleName,
+            bool visible,
+            std::string imageFilepath,
+            ImageAlignment imageAlignment);
+
+        // Switch element to variant
+        void setVariantOfElement(std::string id, std::string name);
+
         // Check whether element is dimming
         bool isElementDimming(std::string id) const;
 
@@ -282,8 +294,20 @@ namespace eyegui
         // Replace any element with a brick of elements
         void replaceElementWithBrick(std::string id, std::string filepath, std::map<std::string, std::string> idMapper, bool fade);
 
-        // Add floating frame with brick
+        // Add floating frame with brick. Document of brick may be given when loaded in advance
         uint addFloatingFrameWithBrick(
+            std::string filepath,
+            float relativePositionX,
+            float relativePositionY,
+            float relativeSizeX,
+            float relativeSizeY,
+            std::map<std::string, std::string> idMapper,
+            bool visible,
+            bool fade,
+            tinyxml2::XMLDocument const * pDocument = NULL);
+
+        // Check out floating frame with brick from pool, parses brick only when no frame is available
+        uint checkOutFloatingFrameWithBrick(
             std::string filepath,
             float relativePositionX,
             float relativePositionY,
@@ -293,6 +317,12 @@ namespace eyegui
             bool visible,
             bool fade);
 
+        // Check in floating frame to pool, hides it and unbinds its ids
+        void checkInFloatingFrame(uint frameIndex);
+
+        // Get statistics of floating frame pool
+        FloatingFramePoolStatistics getFloatingFramePoolStatistics() const;
+
         // Set visibilty of floating frame
         void setVisibiltyOfFloatingFrame(uint frameIndex, bool visible, bool fade);
 
@@ -343,6 +373,19 @@ namespace eyegui
         // Internal replacement helper, returns whether successful
         bool replaceElement(Element* pTarget, std::unique_ptr<Element> upElement, bool fade);
 
+        // Create floating frame with brick without inserting its ids
+        uint createFloatingFrameWithBrick(
+            std::string filepath,
+            float relativePositionX,
+            float relativePositionY,
+            float relativeSizeX,
+            float relativeSizeY,
+            std::map<std::string, std::string> idMapper,
+            bool visible,
+            bool fade,
+            std::unique_ptr<idMap>& rupIdMap,
+            tinyxml2::XMLDocument const * pDocument = NULL);
+
         // Insert id of element
         void insertId(Element* pElement);
 
@@ -355,6 +398,9 @@ namespace eyegui
         // Move floating frame by id
         void moveFloatingFrame(int oldIndex, int newIndex);
 
+        // Map of ids to elements of frame
+        std::map<std::string, Element*> mapIdsOfFrame(Frame const * pFrame) const;
+
         // Members
         GUI const * mpGUI;
         AssetManager* mpAssetManager;
@@ -371,6 +417,19 @@ namespace eyegui
         InteractiveElement* mpSelectedInteractiveElement;
         std::unique_ptr<NotificationQueue> mupNotificationQueue;
         bool mForceResize;
+
+        // Pool of floating frames. Keeps ids of elements as written in brick and as currently
+        // bound to rebind them. Elements are resolved through frame, since they may be replaced
+        struct PooledFrame
+        {
+            std::string filepath;
+            std::vector<std::pair<std::string, std::string> > ids; // brick id and bound id
+            bool checkedOut;
+        };
+        std::map<uint, PooledFrame> mPooledFrames;
+        std::map<std::string, std::vector<uint> > mAvailablePooledFrames;
+        uint mFramePoolHits;
+        uint mFramePoolMisses;
     };
 }
 
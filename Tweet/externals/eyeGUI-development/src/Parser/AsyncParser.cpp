@@ -0,0 +1,153 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "AsyncParser.h"
+
+#include "Rendering/AssetManager.h"
+#include "src/Utilities/Helper.h"
+#include "src/Utilities/PathBuilder.h"
+
+namespace eyegui
+{
+    // Attributes of elements which contain filepath of image
+    static const char* IMAGE_ATTRIBUTES[] = { "src", "icon", "backgroundsrc" };
+
+    AsyncParser::AsyncParser()
+    {
+        // Start worker
+        mStop = false;
+        mWorker = std::thread(&AsyncParser::work, this);
+    }
+
+    AsyncParser::~AsyncParser()
+    {
+        // Stop worker after current request
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mStop = true;
+        }
+        mCondition.notify_one();
+        mWorker.join();
+    }
+
+    void AsyncParser::request(std::string filepath, std::string extension, float vectorGraphicsDPI, std::set<std::string> knownImages)
+    {
+        Request request;
+        request.filepath = filepath;
+        request.extension = extension;
+        request.vectorGraphicsDPI = vectorGraphicsDPI;
+        request.knownImages = std::move(knownImages);
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mRequests.push_back(std::move(request));
+        }
+        mCondition.notify_one();
+    }
+
+    std::unique_ptr<AsyncParser::Result> AsyncParser::poll()
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (mResults.empty())
+        {
+            return NULL;
+        }
+        std::unique_ptr<Result> upResult = std::move(mResults.front());
+        mResults.pop_front();
+        return upResult;
+    }
+
+    void AsyncParser::work()
+    {
+        while (true)
+        {
+            // Wait for request
+            Request request;
+            {
+                std::unique_lock<std::mutex> lock(mMutex);
+                mCondition.wait(lock, [this] { return mStop || !mRequests.empty(); });
+                if (mStop)
+                {
+                    return;
+                }
+                request = std::move(mRequests.front());
+                mRequests.pop_front();
+            }
+
+            // Process it without holding the lock
+            std::unique_ptr<Result> upResult = process(request);
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                mResults.push_back(std::move(upResult));
+            }
+        }
+    }
+
+    std::unique_ptr<AsyncParser::Result> AsyncParser::process(const Request& rRequest) const
+    {
+        std::unique_ptr<Result> upResult = std::unique_ptr<Result>(new Result);
+        upResult->filepath = rRequest.filepath;
+
+        // Check file name
+        if (!checkFileNameExtension(rRequest.filepath, rRequest.extension))
+        {
+            upResult->error = "Extension of file not as expected";
+            return upResult;
+        }
+
+        // Read file
+        std::unique_ptr<tinyxml2::XMLDocument> upDocument = std::unique_ptr<tinyxml2::XMLDocument>(new tinyxml2::XMLDocument);
+        upDocument->LoadFile(buildPath(rRequest.filepath).c_str());
+        if (upDocument->Error())
+        {
+            upResult->error = std::string("XML could not be parsed: ") + upDocument->ErrorName();
+            return upResult;
+        }
+
+        // Go over all xml elements and decode referenced images. Failed ones are left for
+        // fetching on main thread, which reports the error
+        std::set<std::string> visitedImages = rRequest.knownImages;
+        tinyxml2::XMLElement const * xmlElement = upDocument->FirstChildElement();
+        while (xmlElement != NULL)
+        {
+            for (const char* pAttribute : IMAGE_ATTRIBUTES)
+            {
+                const char* pValue = xmlElement->Attribute(pAttribute);
+                if (pValue == NULL || std::string(pValue).empty() || !visitedImages.insert(pValue).second)
+                {
+                    continue;
+                }
+                std::unique_ptr<DecodedImage> upImage = std::unique_ptr<DecodedImage>(new DecodedImage);
+                if (AssetManager::decodeImage(pValue, rRequest.vectorGraphicsDPI, *(upImage.get())))
+                {
+                    upResult->images.push_back(std::make_pair(std::string(pValue), std::move(upImage)));
+                }
+            }
+
+            // Depth first traversal
+            if (xmlElement->FirstChildElement() != NULL)
+            {
+                xmlElement = xmlElement->FirstChildElement();
+            }
+            else
+            {
+                while (xmlElement != NULL && xmlElement->NextSiblingElement() == NULL)
+                {
+                    tinyxml2::XMLNode const * pParent = xmlElement->Parent();
+                    xmlElement = (pParent != NULL) ? pParent->ToElement() : NULL;
+                }
+                if (xmlElement != NULL)
+                {
+                    xmlElement = xmlElement->NextSiblingElement();
+                }
+            }
+        }
+
+        // Document is ready for element creation
+        upResult->upDocument = std::move(upDocument);
+        return upResult;
+    }
+}
@@ -0,0 +1,82 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Worker thread which loads layout and brick files in advance. XML is parsed
+// and referenced images are decoded into memory, so only creation of OpenGL
+// textures and elements is left for the thread owning the context. Results
+// are handed out in order of requests. Does not report errors itself, since
+// callbacks of operation notifier are expected on main thread.
+
+#ifndef ASYNC_PARSER_H_
+#define ASYNC_PARSER_H_
+
+#include "Rendering/Textures/Texture.h"
+#include "externals/TinyXML2/tinyxml2.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <set>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+namespace eyegui
+{
+    class AsyncParser
+    {
+    public:
+
+        // Staged description of file, ready to be turned into elements
+        struct Result
+        {
+            std::string filepath;
+            std::unique_ptr<tinyxml2::XMLDocument> upDocument; // NULL if loading failed
+            std::string error; // reason of failure
+            std::vector<std::pair<std::string, std::unique_ptr<DecodedImage> > > images; // decoded images referenced by elements
+        };
+
+        // Constructor
+        AsyncParser();
+
+        // Destructor, waits for current request
+        virtual ~AsyncParser();
+
+        // Request loading of file with expected extension. Images in set of known filepaths are not decoded
+        void request(std::string filepath, std::string extension, float vectorGraphicsDPI, std::set<std::string> knownImages);
+
+        // Get result of oldest request when it is ready. Returns NULL otherwise
+        std::unique_ptr<Result> poll();
+
+    private:
+
+        // Request waiting for worker
+        struct Request
+        {
+            std::string filepath;
+            std::string extension;
+            float vectorGraphicsDPI;
+            std::set<std::string> knownImages;
+        };
+
+        // Loop of worker thread
+        void work();
+
+        // Load and decode request
+        std::unique_ptr<Result> process(const Request& rRequest) const;
+
+        // Members
+        std::deque<Request> mRequests;
+        std::deque<std::unique_ptr<Result> > mResults;
+        std::thread mWorker;
+        std::mutex mMutex;
+        std::condition_variable mCondition;
+        bool mStop;
+    };
+}
+
+#endif // ASYNC_PARSER_H_
@@ -31,8 +31,14 @@ namespace eyegui
                 throwError(OperationNotifier::Operation::PARSING, std::string("XML could not be parsed: ") + doc.ErrorName(), filepath);
             }
 
+            // Parse document
+            return parse(pLayout, pFrame, pAssetManager, pNotificationQueue, pParent, doc, filepath, idMapper);
+        }
+
+        std::unique_ptr<elementsAndIds> parse(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, Element* pParent, tinyxml2::XMLDocument const & rDocument, std::string filepath, std::map<std::string, std::string> idMapper)
+        {
             // Get first xml element
-            tinyxml2::XMLElement* xmlElement = doc.FirstChildElement();
+            tinyxml2::XMLElement const * xmlElement = rDocument.FirstChildElement();
 
             // Collect values to return
             std::unique_ptr<elementsAndIds> upPair = std::unique_ptr<elementsAndIds>(new elementsAndIds);
@@ -17,6 +17,9 @@ namespace eyegui
     {
         // Parsing
         std::unique_ptr<elementsAndIds> parse(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, Element* pParent, std::string filepath, std::map<std::string, std::string> idMapper);
+
+        // Parsing of document which has been loaded from filepath in advance
+        std::unique_ptr<elementsAndIds> parse(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, Element* pParent, tinyxml2::XMLDocument const & rDocument, std::string filepath, std::map<std::string, std::string> idMapper);
     }
 }
 
@@ -33,8 +33,14 @@ namespace eyegui
                 throwError(OperationNotifier::Operation::PARSING, std::string("XML could not be parsed: ") + doc.ErrorName(), filepath);
             }
 
+            // Parse document
+            return parse(pGUI, pAssetManager, doc, filepath);
+        }
+
+        std::unique_ptr<Layout> parse(GUI* pGUI, AssetManager* pAssetManager, tinyxml2::XMLDocument const & rDocument, std::string filepath)
+        {
             // First xml element should be a layout
-            tinyxml2::XMLElement* xmlLayout = doc.FirstChildElement();
+            tinyxml2::XMLElement const * xmlLayout = rDocument.FirstChildElement();
             if (!element_parser::validateElement(xmlLayout, "layout"))
             {
                 throwError(OperationNotifier::Operation::PARSING, "No layout node as root in XML found", filepath);
@@ -47,7 +53,7 @@ namespace eyegui
             std::unique_ptr<Layout> upLayout = std::unique_ptr<Layout>(new Layout(pGUI, pAssetManager, stylesheetFilepath));
 
             // Then there should be an element
-            tinyxml2::XMLElement* xmlRoot = xmlLayout->FirstChildElement();
+            tinyxml2::XMLElement const * xmlRoot = xmlLayout->FirstChildElement();
 
             // Check for existence
             if (xmlRoot == NULL)
@@ -21,6 +21,9 @@ namespace eyegui
 	{
 		// Parsing
 		std::unique_ptr<Layout> parse(GUI* pGUI, AssetManager* pAssetManager, std::string filepath);
+
+		// Parsing of document which has been loaded from filepath in advance
+		std::unique_ptr<Layout> parse(GUI* pGUI, AssetManager* pAssetManager, tinyxml2::XMLDocument const & rDocument, std::string filepath);
 	}
 }
 
@@ -101,18 +101,7 @@ namespace eyegui
             else
             {
                 // Determine image type
-                std::string delimiter = ".";
-                std::string input = filepath;
-                size_t pos = 0;
-                std::string token;
-                while ((pos = input.find(delimiter)) != std::string::npos)
-                {
-                    token = input.substr(0, pos);
-                    input.erase(0, pos + delimiter.length());
-                }
-
-                // File format case is not relevant
-                std::transform(input.begin(), input.end(), input.begin(), ::tolower);
+                std::string input = getFileExtension(filepath);
 
                 // Check token
                 if (input.compare("svg") == 0)
@@ -185,6 +174,44 @@ namespace eyegui
         return pTexture;
     }
 
+    void AssetManager::stageTexture(std::string filepath, DecodedImage const & rImage)
+    {
+        // Texture may have been fetched meanwhile
+        std::unique_ptr<Texture>& rupTexture = mTextures[filepath];
+        if (rupTexture == NULL)
+        {
+            rupTexture = std::unique_ptr<Texture>(new PixelTexture(rImage, Texture::Filtering::LINEAR, Texture::Wrap::CLAMP, filepath));
+        }
+    }
+
+    std::set<std::string> AssetManager::getTextureFilepaths() const
+    {
+        std::set<std::string> filepaths;
+        for (const auto& rTexture : mTextures)
+        {
+            if (rTexture.second != NULL)
+            {
+                filepaths.insert(rTexture.first);
+            }
+        }
+        return filepaths;
+    }
+
+    bool AssetManager::decodeImage(std::string filepath, float vectorGraphicsDPI, DecodedImage& rImage)
+    {
+        // Same decision about image type as in fetching of texture
+        std::string input = getFileExtension(filepath);
+        if (input.compare("svg") == 0)
+        {
+            return VectorTexture::decode(filepath, vectorGraphicsDPI, rImage);
+        }
+        else if (input.compare("png") == 0 || input.compare("jpg") == 0 || input.compare("jpeg") == 0 || input.compare("tga") == 0 || input.compare("bmp") == 0)
+        {
+            return PixelTexture::decode(filepath, input.compare("png") == 0 ? 4 : 3, rImage);
+        }
+        return false;
+    }
+
     Shader const * AssetManager::fetchShader(shaders::Type shader)
     {
         // Search in map for shader and create if needed
@@ -417,4 +444,20 @@ namespace eyegui
                     filepath,
                     alignment)));
     }
+
+    std::string AssetManager::getFileExtension(std::string filepath)
+    {
+        // Go over tokens separated by dot
+        std::string delimiter = ".";
+        std::string input = filepath;
+        size_t pos = 0;
+        while ((pos = input.find(delimiter)) != std::string::npos)
+        {
+            input.erase(0, pos + delimiter.length());
+        }
+
+        // File format case is not relevant
+        std::transform(input.begin(), input.end(), input.begin(), ::tolower);
+        return input;
+    }
 }
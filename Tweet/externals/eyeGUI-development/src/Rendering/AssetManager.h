@@ -27,6 +27,7 @@
 
 #include <memory>
 #include <map>
+#include <set>
 
 namespace eyegui
 {
@@ -67,6 +68,16 @@ namespace eyegui
         // Fetch graphics
         Texture const * fetchTexture(graphics::Type graphic);
 
+        // Create texture for filepath out of image decoded by other thread, unless texture exists
+        void stageTexture(std::string filepath, DecodedImage const & rImage);
+
+        // Get filepaths of textures which already exist
+        std::set<std::string> getTextureFilepaths() const;
+
+        // Decode image file into memory. Does not touch members or OpenGL, so may be called
+        // from any thread. Returns whether successful
+        static bool decodeImage(std::string filepath, float vectorGraphicsDPI, DecodedImage& rImage);
+
         // Fetch shader
         Shader const * fetchShader(shaders::Type shader);
 
@@ -101,6 +112,9 @@ namespace eyegui
 
     private:
 
+        // Lower case extension of filepath
+        static std::string getFileExtension(std::string filepath);
+
         // Members
         GUI const * mpGUI;
         FT_Library mFreeTypeLibrary;
@@ -21,6 +21,7 @@
 #define pushScissor eyegui::ScissorStack::push
 #define popScissor eyegui::ScissorStack::pop
 #define initScissorStack eyegui::ScissorStack::initForDrawing
+#define setScissorOffset eyegui::ScissorStack::setOffset
 
 namespace eyegui
 {
@@ -40,6 +41,12 @@ namespace eyegui
 			getInstance()->internalPop();
 		}
 
+		// Offset added to pushed scissors, used by translated frames
+		static void setOffset(int x, int y)
+		{
+			getInstance()->internalSetOffset(x, y);
+		}
+
 		// Init for drawing (should be called only by GUI)
 		static void initForDrawing(int width, int height)
 		{
@@ -70,6 +77,8 @@ namespace eyegui
 		{
 			mWindowWidth = 0;
 			mWindowHeight = 0;
+			mOffsetX = 0;
+			mOffsetY = 0;
 		}
 
 		// Destructor
@@ -81,7 +90,7 @@ namespace eyegui
 		// Push scissor on stack
 		void internalPush(int x, int y, int width, int height)
 		{
-			mRects.push_back(Rect(x, y, width, height));
+			mRects.push_back(Rect(x + mOffsetX, y + mOffsetY, width, height));
 			scissor();
 		}
 
@@ -99,11 +108,20 @@ namespace eyegui
 			}	
 		}
 
+		// Set offset
+		void internalSetOffset(int x, int y)
+		{
+			mOffsetX = x;
+			mOffsetY = y;
+		}
+
 		// Set window size
 		void internalInitForDrawing(int width, int height)
 		{
 			mWindowWidth = width;
 			mWindowHeight = height;
+			mOffsetX = 0;
+			mOffsetY = 0;
 
 			// Clear stack
 			mRects.clear();
@@ -160,6 +178,8 @@ namespace eyegui
 		std::vector<Rect> mRects; // stack implemented using vector
 		int mWindowWidth;
 		int mWindowHeight;
+		int mOffsetX;
+		int mOffsetY;
 	};
 }
 
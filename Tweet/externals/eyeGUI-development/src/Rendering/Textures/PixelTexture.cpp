@@ -24,48 +24,21 @@ namespace eyegui
 		Wrap wrap,
 		int suspectedChannels) : Texture()
     {
-        // Setup stb_image
-        stbi_set_flip_vertically_on_load(true);
+		// Check channels
+		if (suspectedChannels != 1 && suspectedChannels != 3 && suspectedChannels != 4)
+		{
+			throwWarning(OperationNotifier::Operation::IMAGE_LOADING, "Unknown number of color channels", filepath);
+		}
 
         // Try to load image
-        int width, height, channelCount;
-        unsigned char* data = stbi_load(buildPath(filepath).c_str(), &width, &height, &channelCount, suspectedChannels);
-
-        // Check whether file was found and parsed
-        if (data == NULL)
+        DecodedImage image;
+        if (!decode(filepath, suspectedChannels, image))
         {
             throwError(OperationNotifier::Operation::IMAGE_LOADING, "Image file not found or error at parsing", filepath);
         }
 
-		// Decide format
-		GLenum glFormat;
-		GLenum glInternalFormat;
-		switch (suspectedChannels)
-		{
-		case 1:
-			glFormat = GL_RED;
-			glInternalFormat = GL_R8;
-			break;
-		case 3:
-			glFormat = GL_RGB;
-			glInternalFormat = GL_RGB8;
-			break;
-		case 4:
-			glFormat = GL_RGBA;
-			glInternalFormat = GL_RGBA8;
-			break;
-		default:
-			glFormat= GL_RGB; 
-			glInternalFormat = GL_R8;
-			throwWarning(OperationNotifier::Operation::IMAGE_LOADING, "Unknown number of color channels", filepath);
-			break;
-		}
-
         // Create OpenGL texture
-        createOpenGLTexture(data, filtering, wrap, width, height, channelCount, glFormat, glInternalFormat, false, filepath);
-
-        // Delete raw image data
-        stbi_image_free(data);
+        createOpenGLTexture(image.data.data(), filtering, wrap, image.width, image.height, image.channelCount, image.format, image.internalFormat, image.flipY, filepath);
     }
 
     PixelTexture::PixelTexture(
@@ -98,8 +71,67 @@ namespace eyegui
         createOpenGLTexture(pData, filtering, wrap, width, height, channelCount, glFormat, glInternalFormat, flipY, "No filepath");
     }
 
+    PixelTexture::PixelTexture(
+		DecodedImage const & rImage,
+		Filtering filtering,
+		Wrap wrap,
+		std::string filepath) : Texture()
+	{
+		// Only move decoded image to GPU
+		createOpenGLTexture(rImage.data.data(), filtering, wrap, rImage.width, rImage.height, rImage.channelCount, rImage.format, rImage.internalFormat, rImage.flipY, filepath);
+	}
+
     PixelTexture::~PixelTexture()
     {
         // Nothing to do
     }
+
+    bool PixelTexture::decode(std::string filepath, int suspectedChannels, DecodedImage& rImage)
+    {
+        // Setup stb_image
+        stbi_set_flip_vertically_on_load(true);
+
+        // Try to load image
+        int width, height, channelCount;
+        unsigned char* data = stbi_load(buildPath(filepath).c_str(), &width, &height, &channelCount, suspectedChannels);
+
+        // Check whether file was found and parsed
+        if (data == NULL)
+        {
+            return false;
+        }
+
+		// Decide format
+		switch (suspectedChannels)
+		{
+		case 1:
+			rImage.format = GL_RED;
+			rImage.internalFormat = GL_R8;
+			break;
+		case 3:
+			rImage.format = GL_RGB;
+			rImage.internalFormat = GL_RGB8;
+			break;
+		case 4:
+			rImage.format = GL_RGBA;
+			rImage.internalFormat = GL_RGBA8;
+			break;
+		default:
+			rImage.format = GL_RGB;
+			rImage.internalFormat = GL_R8;
+			break;
+		}
+
+        // Copy raw image data
+        uint channels = (suspectedChannels > 0) ? (uint)suspectedChannels : (uint)channelCount;
+        rImage.width = (uint)width;
+        rImage.height = (uint)height;
+        rImage.channelCount = (uint)channelCount;
+        rImage.flipY = false;
+        rImage.data.assign(data, data + (width * height * channels));
+
+        // Delete raw image data
+        stbi_image_free(data);
+        return true;
+    }
 }
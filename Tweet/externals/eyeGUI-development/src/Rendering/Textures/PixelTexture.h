@@ -33,8 +33,18 @@ namespace eyegui
 			Filtering filtering,
 			Wrap wrap);
 
+        // Constructor for image decoded in advance
+        PixelTexture(
+			DecodedImage const & rImage,
+			Filtering filtering,
+			Wrap wrap,
+			std::string filepath);
+
         // Destructor
         virtual ~PixelTexture();
+
+        // Decode image file into memory. Does not need OpenGL context. Returns whether successful
+        static bool decode(std::string filepath, int suspectedChannels, DecodedImage& rImage);
     };
 }
 
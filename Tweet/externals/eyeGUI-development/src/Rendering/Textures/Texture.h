@@ -19,6 +19,19 @@
 
 namespace eyegui
 {
+    // Image decoded into memory. Creation needs no OpenGL context, so it may
+    // happen on other thread than rendering
+    struct DecodedImage
+    {
+        uint width = 0;
+        uint height = 0;
+        uint channelCount = 0;
+        GLenum format = GL_RGBA;
+        GLenum internalFormat = GL_RGBA;
+        bool flipY = false;
+        std::vector<uchar> data;
+    };
+
     class Texture
     {
     public:
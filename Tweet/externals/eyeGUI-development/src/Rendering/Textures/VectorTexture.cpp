@@ -22,20 +22,15 @@ namespace eyegui
 {
     VectorTexture::VectorTexture(std::string filepath, Filtering filtering, Wrap wrap, float dpi) : Texture()
     {
-        // Parse file
-        NSVGimage* svg = nsvgParseFromFile(buildPath(filepath).c_str(), "px", dpi);
-
-        // Check whether file found and parsed
-        if (svg == NULL)
+        // Parse file and rasterize it
+        DecodedImage image;
+        if (!decode(filepath, dpi, image))
         {
             throwError(OperationNotifier::Operation::IMAGE_LOADING, "Graphics file not found or error while parsing", filepath);
         }
 
-        // Rasterize it and create OpenGL texture
-        rasterizeGraphics(svg, filtering, wrap, filepath);
-
-        // Delete graphics
-        nsvgDelete(svg);
+        // Create OpenGL texture
+        createOpenGLTexture(image.data.data(), filtering, wrap, image.width, image.height, image.channelCount, image.format, image.internalFormat, image.flipY, filepath);
     }
 
     VectorTexture::VectorTexture(std::string const * pGraphic, Filtering filtering, Wrap wrap, float dpi)
@@ -47,7 +42,9 @@ namespace eyegui
         free(str);
 
         // Rasterize it and create OpenGL texture
-        rasterizeGraphics(svg, filtering, wrap, "");
+        DecodedImage image;
+        rasterizeGraphics(svg, image);
+        createOpenGLTexture(image.data.data(), filtering, wrap, image.width, image.height, image.channelCount, image.format, image.internalFormat, image.flipY, "");
 
         // Delete graphics
         nsvgDelete(svg);
@@ -58,7 +55,26 @@ namespace eyegui
         // Nothing to do
     }
 
-    void VectorTexture::rasterizeGraphics(NSVGimage* svg, Filtering filtering, Wrap wrap, std::string filepath)
+    bool VectorTexture::decode(std::string filepath, float dpi, DecodedImage& rImage)
+    {
+        // Parse file
+        NSVGimage* svg = nsvgParseFromFile(buildPath(filepath).c_str(), "px", dpi);
+
+        // Check whether file found and parsed
+        if (svg == NULL)
+        {
+            return false;
+        }
+
+        // Rasterize it
+        rasterizeGraphics(svg, rImage);
+
+        // Delete graphics
+        nsvgDelete(svg);
+        return true;
+    }
+
+    void VectorTexture::rasterizeGraphics(NSVGimage* svg, DecodedImage& rImage)
     {
         uint width = (uint)(svg->width);
         uint height = (uint)(svg->height);
@@ -68,14 +84,16 @@ namespace eyegui
         NSVGrasterizer* rast = nsvgCreateRasterizer();
 
         // Prepare memory for image
-        std::vector<uchar> image;
-        image.resize(width * height * channelCount);
+        rImage.width = width;
+        rImage.height = height;
+        rImage.channelCount = channelCount;
+        rImage.format = GL_RGBA;
+        rImage.internalFormat = GL_RGBA;
+        rImage.flipY = true;
+        rImage.data.resize(width * height * channelCount);
 
         // Rasterize
-        nsvgRasterize(rast, svg, 0, 0, 1, image.data(), width, height, width * channelCount);
-
-        // Create OpenGL from image
-		createOpenGLTexture(image.data(), filtering, wrap, width, height, channelCount, GL_RGBA, GL_RGBA, true, filepath);
+        nsvgRasterize(rast, svg, 0, 0, 1, rImage.data.data(), width, height, width * channelCount);
 
         // Delete NanoSVG stuff
         nsvgDeleteRasterizer(rast);
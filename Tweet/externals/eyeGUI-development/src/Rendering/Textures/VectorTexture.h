@@ -28,10 +28,13 @@ namespace eyegui
         // Destructor
         virtual ~VectorTexture();
 
+        // Parse and rasterize graphics file into memory. Does not need OpenGL context. Returns whether successful
+        static bool decode(std::string filepath, float dpi, DecodedImage& rImage);
+
     private:
 
-        // Rasterize
-        void rasterizeGraphics(NSVGimage* svg, Filtering filtering, Wrap wrap, std::string filepath);
+        // Rasterize into memory
+        static void rasterizeGraphics(NSVGimage* svg, DecodedImage& rImage);
 
     };
 }
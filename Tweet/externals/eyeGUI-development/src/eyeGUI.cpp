@@ -38,6 +38,11 @@ namespace eyegui
         return pGUI->addLayout(filepath, layer, visible);
     }
 
+    void addLayoutAsync(GUI* pGUI, std::string filepath, std::function<void(Layout*)> callback, int layer, bool visible)
+    {
+        pGUI->addLayoutAsync(filepath, layer, visible, callback);
+    }
+
     void removeLayout(GUI* pGUI, Layout const * pLayout)
     {
         pGUI->removeLayout(pLayout);
@@ -209,6 +214,23 @@ namespace eyegui
         pLayout->setElementHiding(id, hidden);
     }
 
+    void addVariantToElement(
+        Layout* pLayout,
+        std::string id,
+        std::string name,
+        std::string styleName,
+        bool visible,
+        std::string imageFilepath,
+        ImageAlignment imageAlignment)
+    {
+        pLayout->addVariantToElement(id, name, styleName, visible, imageFilepath, imageAlignment);
+    }
+
+    void setVariantOfElement(Layout* pLayout, std::string id, std::string name)
+    {
+        pLayout->setVariantOfElement(id, name);
+    }
+
     bool checkForId(Layout const * pLayout, std::string id)
     {
         return pLayout->checkForId(id);
@@ -559,6 +581,46 @@ namespace eyegui
         return pLayout->addFloatingFrameWithBrick(filepath, relativePositionX, relativePositionY, relativeSizeX, relativeSizeY, idMapper, visible, fade);
     }
 
+    void addFloatingFrameWithBrickAsync(
+        GUI* pGUI,
+        Layout* pLayout,
+        std::string filepath,
+        float relativePositionX,
+        float relativePositionY,
+        float relativeSizeX,
+        float relativeSizeY,
+        std::function<void(bool, unsigned int)> callback,
+        std::map<std::string, std::string> idMapper,
+        bool visible,
+        bool fade)
+    {
+        pGUI->addFloatingFrameWithBrickAsync(pLayout, filepath, relativePositionX, relativePositionY, relativeSizeX, relativeSizeY, idMapper, visible, fade, callback);
+    }
+
+    unsigned int checkOutFloatingFrameWithBrick(
+        Layout* pLayout,
+        std::string filepath,
+        float relativePositionX,
+        float relativePositionY,
+        float relativeSizeX,
+        float relativeSizeY,
+        std::map<std::string, std::string> idMapper,
+        bool visible,
+        bool fade)
+    {
+        return pLayout->checkOutFloatingFrameWithBrick(filepath, relativePositionX, relativePositionY, relativeSizeX, relativeSizeY, idMapper, visible, fade);
+    }
+
+    void checkInFloatingFrame(Layout* pLayout, unsigned int frameIndex)
+    {
+        pLayout->checkInFloatingFrame(frameIndex);
+    }
+
+    FloatingFramePoolStatistics getFloatingFramePoolStatistics(Layout* pLayout)
+    {
+        return pLayout->getFloatingFramePoolStatistics();
+    }
+
     void setVisibilityOFloatingFrame(Layout* pLayout, unsigned int frameIndex, bool visible, bool reset, bool fade)
     {
         pLayout->setVisibiltyOfFloatingFrame(frameIndex, visible, fade);
@@ -26,6 +26,10 @@ void ConnectPageArea::show() {
 		Element::show();
 		for (int i = 0; i <4; i++)
 		{
+			// Prepare selected state of messages, so selection only switches between states
+			eyegui::addVariantToElement(pLayout, "message" + std::to_string(i), "selected", "", true, "Eprojekt_Design/tweetSelected.png");
+			eyegui::addVariantToElement(pLayout, "rightSide" + std::to_string(i), "selected", "", true, "Eprojekt_Design/tweetConnection.png");
+
 			textFrames[i] = eyegui::addFloatingFrameWithBrick(pLayout, "bricks/ConnectPageArea/floatingTweetBlock" + std::to_string(i + 1) + ".beyegui", 0.178125f, 0.265f + (0.18f*i), 0.65f, 0.1675f);
 			buttonFrames[i] = eyegui::addFloatingFrameWithBrick(pLayout, "bricks/ConnectPageArea/floatingButton" + std::to_string(i + 1) + ".beyegui", 0.178125f, 0.265f + (0.18f*i), 0.65f, 0.1675f);
 			eyegui::registerButtonListener(pLayout, std::to_string(i), connectButtonListener);
@@ -49,10 +53,8 @@ void ConnectPageArea::selectContent(std::string id) {
 		{
 			if (currentlySelected.compare("none"))
 			{
-				eyegui::ImageAlignment alignment = eyegui::ImageAlignment::STRETCHED;
-				eyegui::replaceElementWithPicture(pLayout, "message" + currentlySelected, "menuebar_elements/tweet_content2.png", alignment);
-				eyegui::setStyleOfElement(pLayout, "message" + currentlySelected, "block");
-				eyegui::replaceElementWithBlock(pLayout, "rightSide" + currentlySelected, false);
+				eyegui::setVariantOfElement(pLayout, "message" + currentlySelected, "");
+				eyegui::setVariantOfElement(pLayout, "rightSide" + currentlySelected, "");
 			}
 			currentlySelected = id;
 			if (id.compare("none"))
@@ -71,13 +73,12 @@ void ConnectPageArea::selectContent(std::string id) {
 				}
 
 				eyegui::ImageAlignment alignment = eyegui::ImageAlignment::STRETCHED;
-				eyegui::replaceElementWithPicture(pLayout, "message" + currentlySelected, "Eprojekt_Design/tweetSelected.png", alignment);
-				eyegui::setStyleOfElement(pLayout, "message" + currentlySelected, "block");
+				eyegui::setVariantOfElement(pLayout, "message" + currentlySelected, "selected");
 
 				eyegui::replaceElementWithPicture(pLayout, "action_button_area", "actionbar_elements/WallActionBar/actionBarWall" +currentlySelected + ".png", alignment);
 				eyegui::setStyleOfElement(pLayout, "action_button_area", "block");
 
-				eyegui::replaceElementWithPicture(pLayout, "rightSide" + currentlySelected, "Eprojekt_Design/tweetConnection.png", alignment);
+				eyegui::setVariantOfElement(pLayout, "rightSide" + currentlySelected, "selected");
 
 				std::cout << "Result " + id + " has been hit" << std::endl;
 				if (stoi(currentlySelected) >= counter)
@@ -26,6 +26,18 @@ void DiscoverPageArea::show() {
     if (!active)
     {
         Element::show();
+
+        // Prepare selected state of hashtags and suggestions, so selection only switches between states
+        for (int i = 0; i < 4; i++)
+        {
+            eyegui::addVariantToElement(pLayout, "hashtag" + std::to_string(i), "selected", "", true, "Eprojekt_Design/selectedHashtag.png");
+        }
+        for (int i = 4; i < 7; i++)
+        {
+            eyegui::addVariantToElement(pLayout, "suggestion" + std::to_string(i), "selected", "", true, "Eprojekt_Design/selectedProfile.png");
+            eyegui::addVariantToElement(pLayout, "rightSide" + std::to_string(i), "selected", "", true, "Eprojekt_Design/profileConnection.png");
+        }
+
         for (int i = 0; i <4; i++)
         {
             textFrames[i] = eyegui::addFloatingFrameWithBrick(pLayout, "bricks/DiscoverPageArea/floatingTweetBlock" + std::to_string(i + 1) + ".beyegui", 0.18125f+(0.328125f*(i % 2)), 0.2675f + (0.105f*(i/2)), 0.321875f, 0.095f);
@@ -182,16 +194,12 @@ void DiscoverPageArea::selectTweet(std::string id) {
             {
                 if (stoi(currentlySelected)<4)
                 {
-                    eyegui::ImageAlignment alignment = eyegui::ImageAlignment::STRETCHED;
-                    eyegui::replaceElementWithPicture(pLayout, "hashtag" + currentlySelected, "menuebar_elements/tweet_content3.png", alignment);
-                    eyegui::setStyleOfElement(pLayout, "hashtag" + currentlySelected, "invisible");
+                    eyegui::setVariantOfElement(pLayout, "hashtag" + currentlySelected, "");
 
                 }
                 else {
-                    eyegui::ImageAlignment alignment = eyegui::ImageAlignment::STRETCHED;
-                    eyegui::replaceElementWithPicture(pLayout, "suggestion" + currentlySelected, "menuebar_elements/tweet_content4.png", alignment);
-                    eyegui::setStyleOfElement(pLayout, "suggestion" + currentlySelected, "invisible");
-                    eyegui::replaceElementWithBlock(pLayout, "rightSide" + currentlySelected, false);
+                    eyegui::setVariantOfElement(pLayout, "suggestion" + currentlySelected, "");
+                    eyegui::setVariantOfElement(pLayout, "rightSide" + currentlySelected, "");
 
                 }
             }
@@ -204,8 +212,7 @@ void DiscoverPageArea::selectTweet(std::string id) {
             {
                 eyegui::replaceElementWithPicture(pLayout, "action_button_area", "actionbar_elements/DiscoverActionBar/actionBarDiscover0.png", alignment);
                 eyegui::setStyleOfElement(pLayout, "action_button_area", "invisible");
-                eyegui::replaceElementWithPicture(pLayout, "hashtag" + currentlySelected, "Eprojekt_Design/selectedHashtag.png", alignment);
-                eyegui::setStyleOfElement(pLayout, "hashtag" + currentlySelected, "invisible");
+                eyegui::setVariantOfElement(pLayout, "hashtag" + currentlySelected, "selected");
 
                 TwitterApp::getInstance()->actionButtonArea->changeToHashtags(content[0]["trends"][selection]["name"].GetString());
                 std::cout << "hashtag "+currentlySelected+" hit" << std::endl;
@@ -215,9 +222,8 @@ void DiscoverPageArea::selectTweet(std::string id) {
 
                 eyegui::replaceElementWithPicture(pLayout, "action_button_area", "actionbar_elements/DiscoverActionBar/actionBarDiscover" + currentlySelected + ".png", alignment);
                 eyegui::setStyleOfElement(pLayout, "action_button_area", "invisible");
-                eyegui::replaceElementWithPicture(pLayout, "suggestion" + currentlySelected, "Eprojekt_Design/selectedProfile.png", alignment);
-                eyegui::setStyleOfElement(pLayout, "suggestion" + currentlySelected, "invisible");
-                eyegui::replaceElementWithPicture(pLayout, "rightSide" + currentlySelected, "Eprojekt_Design/profileConnection.png", alignment);
+                eyegui::setVariantOfElement(pLayout, "suggestion" + currentlySelected, "selected");
+                eyegui::setVariantOfElement(pLayout, "rightSide" + currentlySelected, "selected");
                 TwitterApp::getInstance()->actionButtonArea->changeToProfilesWithGo(suggestions["users"][(selection - 4+suggestionnmbr)]["id_str"].GetString(),suggestions["users"][(selection-4+ suggestionnmbr)]["following"].GetBool());
                 std::cout << "profile " + currentlySelected + " hit" << std::endl;
             }
@@ -29,6 +29,10 @@ void ProfilePageArea::show() {
         Element::show();
         for (int i = 1; i <4; i++)
         {
+            // Prepare selected state of contents, so selection only switches between states
+            eyegui::addVariantToElement(pLayout, "content" + std::to_string(i), "selected", "", true, "Eprojekt_Design/tweetSelected.png");
+            eyegui::addVariantToElement(pLayout, "rightSide" + std::to_string(i), "selected", "", true, "Eprojekt_Design/tweetConnection.png");
+
             textFrames[i] = eyegui::addFloatingFrameWithBrick(pLayout, "bricks/ProfilePageArea/floatingTweetBlock" + std::to_string(i + 1) + ".beyegui", 0.1765625f, 0.3575f + (0.155f*i), 0.6484375f, 0.1425f);
             buttonFrames[i] = eyegui::addFloatingFrameWithBrick(pLayout, "bricks/ProfilePageArea/floatingButton" + std::to_string(i + 1) + ".beyegui", 0.1765625f, 0.3575f + (0.155f*i), 0.6484375f, 0.1425f);
             eyegui::registerButtonListener(pLayout, std::to_string(i), profileButtonListener);
@@ -147,10 +151,8 @@ void ProfilePageArea::selectContent(std::string id) {
     {
         if (currentlySelected.compare("none")&& currentlySelected.compare("0"))
         {
-            eyegui::ImageAlignment alignment = eyegui::ImageAlignment::STRETCHED;
-            eyegui::replaceElementWithPicture(pLayout, "content" + currentlySelected, "menuebar_elements/tweet_content2.png", alignment);
-            eyegui::setStyleOfElement(pLayout, "content" + currentlySelected, "block");
-            eyegui::replaceElementWithBlock(pLayout, "rightSide" + currentlySelected, false);
+            eyegui::setVariantOfElement(pLayout, "content" + currentlySelected, "");
+            eyegui::setVariantOfElement(pLayout, "rightSide" + currentlySelected, "");
         }
         currentlySelected = id;
         if (id.compare("none"))
@@ -175,9 +177,8 @@ void ProfilePageArea::selectContent(std::string id) {
             eyegui::setStyleOfElement(pLayout, "action_button_area", "block");
             if (currentlySelected.compare("0"))
             {
-                eyegui::replaceElementWithPicture(pLayout, "content" + currentlySelected, "Eprojekt_Design/tweetSelected.png", alignment);
-                eyegui::setStyleOfElement(pLayout, "content" + currentlySelected, "block");
-                eyegui::replaceElementWithPicture(pLayout, "rightSide" + currentlySelected, "Eprojekt_Design/tweetConnection.png", alignment);
+                eyegui::setVariantOfElement(pLayout, "content" + currentlySelected, "selected");
+                eyegui::setVariantOfElement(pLayout, "rightSide" + currentlySelected, "selected");
 
 
             }
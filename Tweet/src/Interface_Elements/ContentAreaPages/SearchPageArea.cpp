@@ -27,14 +27,18 @@ void SearchPageArea::show() {
         Element::show();
         for (int i = 0; i <4; i++)
         {
-            textFrames[i] = eyegui::addFloatingFrameWithBrick(pLayout, "bricks/SearchPageArea/floatingTweetBlock" + std::to_string(i + 1) + ".beyegui", 0.175f, 0.41f + 0.14125f*i, 0.65f, 0.1325f);
-            buttonFrames[i] = eyegui::addFloatingFrameWithBrick(pLayout, "bricks/SearchPageArea/floatingButton" + std::to_string(i + 1) + ".beyegui", 0.175f, 0.41f + 0.14125f*i, 0.65f, 0.1325f);
+            // Prepare selected state of results, so selection only switches between states
+            eyegui::addVariantToElement(pLayout, "result" + std::to_string(i), "selected", "", true, "Eprojekt_Design/tweetSelected.png");
+            eyegui::addVariantToElement(pLayout, "rightSide" + std::to_string(i), "selected", "", true, "Eprojekt_Design/tweetConnection.png");
+
+            textFrames[i] = eyegui::checkOutFloatingFrameWithBrick(pLayout, "bricks/SearchPageArea/floatingTweetBlock" + std::to_string(i + 1) + ".beyegui", 0.175f, 0.41f + 0.14125f*i, 0.65f, 0.1325f);
+            buttonFrames[i] = eyegui::checkOutFloatingFrameWithBrick(pLayout, "bricks/SearchPageArea/floatingButton" + std::to_string(i + 1) + ".beyegui", 0.175f, 0.41f + 0.14125f*i, 0.65f, 0.1325f);
             eyegui::registerButtonListener(pLayout, std::to_string(i), searchButtonListener);
         }
-        textFrames[4] = eyegui::addFloatingFrameWithBrick(pLayout, "bricks/SearchPageArea/searchText.beyegui", 0.175f, 0.2875f, 0.65f, 0.11f);
-        buttonFrames[4] = eyegui::addFloatingFrameWithBrick(pLayout, "bricks/SearchPageArea/searchButton.beyegui", 0.175f , 0.2875f , 0.65f, 0.11f);
-        buttonFrames[5] = eyegui::addFloatingFrameWithBrick(pLayout, "bricks/SearchPageArea/tweetSearchButton.beyegui", 0.0f, 0.26f, 0.125f, 0.101f);
-        buttonFrames[6] = eyegui::addFloatingFrameWithBrick(pLayout, "bricks/SearchPageArea/profileSearchButton.beyegui", 0.0f, 0.39f, 0.125f, 0.101f);
+        textFrames[4] = eyegui::checkOutFloatingFrameWithBrick(pLayout, "bricks/SearchPageArea/searchText.beyegui", 0.175f, 0.2875f, 0.65f, 0.11f);
+        buttonFrames[4] = eyegui::checkOutFloatingFrameWithBrick(pLayout, "bricks/SearchPageArea/searchButton.beyegui", 0.175f , 0.2875f , 0.65f, 0.11f);
+        buttonFrames[5] = eyegui::checkOutFloatingFrameWithBrick(pLayout, "bricks/SearchPageArea/tweetSearchButton.beyegui", 0.0f, 0.26f, 0.125f, 0.101f);
+        buttonFrames[6] = eyegui::checkOutFloatingFrameWithBrick(pLayout, "bricks/SearchPageArea/profileSearchButton.beyegui", 0.0f, 0.39f, 0.125f, 0.101f);
         eyegui::registerButtonListener(pLayout, "searchKeyboard", searchButtonListener);
         eyegui::registerButtonListener(pLayout, "tweetSearchButton", searchButtonListener);
         eyegui::registerButtonListener(pLayout, "profileSearchButton", searchButtonListener);
@@ -67,10 +71,8 @@ void SearchPageArea::selectContent(std::string id) {
     {
         if (currentlySelected.compare("none"))
         {
-            eyegui::ImageAlignment alignment = eyegui::ImageAlignment::STRETCHED;
-            eyegui::replaceElementWithPicture(pLayout, "result" + currentlySelected, "menuebar_elements/tweet_content2.png", alignment);
-            eyegui::setStyleOfElement(pLayout, "result" + currentlySelected, "block");
-            eyegui::replaceElementWithBlock(pLayout, "rightSide" + currentlySelected, false);
+            eyegui::setVariantOfElement(pLayout, "result" + currentlySelected, "");
+            eyegui::setVariantOfElement(pLayout, "rightSide" + currentlySelected, "");
         }
         currentlySelected = id;
         if (id.compare("none"))
@@ -97,13 +99,12 @@ void SearchPageArea::selectContent(std::string id) {
                 return;
             }
             eyegui::ImageAlignment alignment = eyegui::ImageAlignment::STRETCHED;
-            eyegui::replaceElementWithPicture(pLayout, "result" + currentlySelected, "Eprojekt_Design/tweetSelected.png", alignment);
-            eyegui::setStyleOfElement(pLayout, "result" + currentlySelected, "block");
+            eyegui::setVariantOfElement(pLayout, "result" + currentlySelected, "selected");
 
             eyegui::replaceElementWithPicture(pLayout, "action_button_area", "actionbar_elements/SearchActionBar/actionBarSearch" + currentlySelected + ".png", alignment);
             eyegui::setStyleOfElement(pLayout, "action_button_area", "block");
 
-            eyegui::replaceElementWithPicture(pLayout, "rightSide" + currentlySelected, "Eprojekt_Design/tweetConnection.png", alignment);
+            eyegui::setVariantOfElement(pLayout, "rightSide" + currentlySelected, "selected");
 
             std::cout << "Result " + id + " has been hit" << std::endl;
             if (stoi(currentlySelected)>=counter)
@@ -410,7 +411,7 @@ void SearchPageArea::setKeyWord(std::string word) {
 
 /**
 * hide function
-* hides the instances of the ProfilePageArea and delets the floating frames
+* hides the instances of the ProfilePageArea and checks the floating frames back in for the next show
 */
 void SearchPageArea::hide() {
     if (active)
@@ -418,11 +419,11 @@ void SearchPageArea::hide() {
         currentlySelected = "none";
         for (int i = 0; i < 5; i++)
         {
-            eyegui::removeFloatingFrame(pLayout, textFrames[i]);
-            eyegui::removeFloatingFrame(pLayout, buttonFrames[i]);
+            eyegui::checkInFloatingFrame(pLayout, textFrames[i]);
+            eyegui::checkInFloatingFrame(pLayout, buttonFrames[i]);
         }
-        eyegui::removeFloatingFrame(pLayout, buttonFrames[5]);
-        eyegui::removeFloatingFrame(pLayout, buttonFrames[6]);
+        eyegui::checkInFloatingFrame(pLayout, buttonFrames[5]);
+        eyegui::checkInFloatingFrame(pLayout, buttonFrames[6]);
         index = 0;
 
     }
@@ -25,6 +25,10 @@ void WallContentArea::show() {
         Element::show();
         for (int i = 0; i <4; i++)
         {
+            // Prepare selected state of tweets, so selection only switches between states
+            eyegui::addVariantToElement(pLayout, "tweet" + std::to_string(i), "selected", "", true, "Eprojekt_Design/tweetSelected.png");
+            eyegui::addVariantToElement(pLayout, "rightSide" + std::to_string(i), "selected", "", true, "Eprojekt_Design/tweetConnection.png");
+
             textFrames[i] = eyegui::addFloatingFrameWithBrick(pLayout, "bricks/WallContentArea/floatingTweetBlock" + std::to_string(i + 1) + ".beyegui", 0.178125f, 0.265f + (0.18f*i), 0.65f, 0.1675f);
             buttonFrames[i] = eyegui::addFloatingFrameWithBrick(pLayout, "bricks/WallContentArea/floatingButton" + std::to_string(i + 1) + ".beyegui", 0.178125f, 0.265f + (0.18f*i), 0.65f, 0.1675f);
             eyegui::registerButtonListener(pLayout, std::to_string(i), wallButtonListener);
@@ -207,10 +211,8 @@ void WallContentArea::selectTweet(std::string id) {
         {
             if (currentlySelected.compare("none"))
             {
-                eyegui::ImageAlignment alignment = eyegui::ImageAlignment::STRETCHED;
-                eyegui::replaceElementWithPicture(pLayout, "tweet" + currentlySelected, "menuebar_elements/tweet_content2.png", alignment);
-                eyegui::setStyleOfElement(pLayout, "tweet" + currentlySelected, "block");
-                eyegui::replaceElementWithBlock(pLayout, "rightSide" + currentlySelected, false);
+                eyegui::setVariantOfElement(pLayout, "tweet" + currentlySelected, "");
+                eyegui::setVariantOfElement(pLayout, "rightSide" + currentlySelected, "");
             }
             currentlySelected = id;
             if (id.compare("none"))
@@ -229,14 +231,13 @@ void WallContentArea::selectTweet(std::string id) {
                 }
 
                 eyegui::ImageAlignment alignment = eyegui::ImageAlignment::STRETCHED;
-                eyegui::replaceElementWithPicture(pLayout, "tweet" + currentlySelected, "Eprojekt_Design/tweetSelected.png", alignment);
-                eyegui::setStyleOfElement(pLayout, "tweet" + currentlySelected, "block");
+                eyegui::setVariantOfElement(pLayout, "tweet" + currentlySelected, "selected");
 
                 eyegui::replaceElementWithPicture(pLayout, "action_button_area", "actionbar_elements/WallActionBar/actionBarWall" + currentlySelected+".png", alignment);
                 eyegui::setStyleOfElement(pLayout, "action_button_area", "block");
 
 
-                eyegui::replaceElementWithPicture(pLayout, "rightSide"+currentlySelected, "Eprojekt_Design/tweetConnection.png", alignment);
+                eyegui::setVariantOfElement(pLayout, "rightSide" + currentlySelected, "selected");
 
                 std::cout << "Tweet " + id + " has been hit" << std::endl;
                 if (content[stoi(currentlySelected)+tweetIndex]["entities"].HasMember("media"))